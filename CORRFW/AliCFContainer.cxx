@@ -123,6 +123,37 @@ void AliCFContainer::Fill(const Double_t *var, Int_t istep, Double_t weight)
   fGrid[istep]->Fill(var,weight);
 }
 
+//____________________________________________________________________
+void AliCFContainer::Fill(Int_t nEntries, const Double_t *var, const Int_t *steps, const Double_t *weights)
+{
+  //
+  // Fills nEntries entries at once: entry i has the GetNVar() values
+  // var[i*GetNVar()...], is filled at selection step steps[i]
+  // with weight weights[i] (by default w=1)
+  //
+  Int_t nVar = GetNVar();
+  for (Int_t iEntry=0; iEntry<nEntries; iEntry++) {
+    Int_t istep = steps[iEntry];
+    if(istep >= fNStep || istep < 0){
+      AliError("Non-existent selection step, grid was not filled");
+      continue;
+    }
+    fGrid[istep]->Fill(var+iEntry*nVar, weights ? weights[iEntry] : 1.);
+  }
+}
+
+//____________________________________________________________________
+void AliCFContainer::SetFillBuffer(Int_t maxBins)
+{
+  //
+  // Buffers the fills of each selection step in a hash table of
+  // at most maxBins bins, maxBins=0 switches the buffers off.
+  // The THnBase sums of the fills of the grids are not updated for
+  // buffered fills, see AliCFGridSparse::SetFillBuffer()
+  //
+  for (Int_t istep=0; istep<fNStep; istep++) fGrid[istep]->SetFillBuffer(maxBins);
+}
+
 //____________________________________________________________________
 TH1* AliCFContainer::Project(Int_t istep, Int_t ivar1, Int_t ivar2, Int_t ivar3) const
 {
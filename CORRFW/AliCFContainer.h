@@ -62,6 +62,8 @@ class AliCFContainer : public AliCFFrame
   virtual Int_t GetNStep() const {return fNStep;};
   virtual void  SetNStep(Int_t nStep) {fNStep=nStep;}
   virtual void  Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void  Fill(Int_t nEntries, const Double_t *var, const Int_t *steps, const Double_t *weights=0x0) ;
+  virtual void  SetFillBuffer(Int_t maxBins=100000) ; // buffer the fills of all steps, see AliCFGridSparse::SetFillBuffer()
 
   virtual Float_t  GetOverFlows (Int_t var,Int_t istep,Bool_t excl=kFALSE) const;
   virtual Float_t  GetUnderFlows(Int_t var,Int_t istep,Bool_t excl=kFALSE) const ;
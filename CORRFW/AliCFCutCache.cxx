@@ -0,0 +1,119 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/ 
+// Per-event cache of the decisions of the particle-level cuts.
+// AliCFManager::CheckParticleCuts() asks the cache instead of the cut
+// when a cache is set (AliCFManager::SetCutCache()), so that a cut
+// used at several selection steps, or by several managers sharing the
+// cache, is evaluated once per particle and per event.
+// The particles are identified by their class and by their index in the
+// event (AliCFManager::CheckParticleCuts(isel,obj,index)), so that the
+// MC particles and the tracks are cached separately, and temporary copies
+// created in the track loop, whose addresses are reused, are identified by
+// the index of their track. A track and a modified copy of it (e.g. the
+// TPC-only track) must therefore not be checked with the same index.
+// Particles checked without index are not cached. Cuts with QA histograms
+// switched on are always evaluated, so that their QA is unchanged.
+
+#include "TClass.h"
+#include "AliCFCutBase.h"
+#include "AliCFCutCache.h"
+
+ClassImp(AliCFCutCache)
+
+//___________________________________________________________________________
+AliCFCutCache::AliCFCutCache():
+  TObject(),
+  fCuts(),
+  fClasses(),
+  fDecisions(),
+  fNEvaluations(0),
+  fNReused(0)
+{
+  //
+  // Default constructor
+  //
+}
+
+//___________________________________________________________________________
+Int_t AliCFCutCache::GetCutIndex(const AliCFCutBase* cut)
+{
+  //
+  // returns the bit of the cut in the decision bitmaps, -1 if the cut cannot be cached
+  //
+  for (UInt_t i=0; i<fCuts.size(); i++) if (fCuts[i]==cut) return i;
+  if (fCuts.size()>=kMaxCuts) return -1;
+  fCuts.push_back(cut);
+  return fCuts.size()-1;
+}
+
+//___________________________________________________________________________
+Int_t AliCFCutCache::GetClassIndex(const TClass* cl)
+{
+  //
+  // returns the index of the class in the decision tables
+  //
+  for (UInt_t i=0; i<fClasses.size(); i++) if (fClasses[i]==cl) return i;
+  fClasses.push_back(cl);
+  fDecisions.resize(fClasses.size());
+  return fClasses.size()-1;
+}
+
+//___________________________________________________________________________
+Bool_t AliCFCutCache::IsSelected(AliCFCutBase* cut, TObject* obj, Int_t index)
+{
+  //
+  // returns the decision of the cut for obj, the index-th object of its
+  // class in the event; the cut is evaluated only if it was not yet for
+  // this object since the last Reset(). Negative indices are not cached.
+  //
+  Int_t iCut = (cut->IsQAOn() || !obj || index<0) ? -1 : GetCutIndex(cut);
+  if (iCut<0) {
+    fNEvaluations++;
+    return cut->IsSelected(obj);
+  }
+
+  std::vector<std::pair<UInt_t,UInt_t> >& decisions = fDecisions[GetClassIndex(obj->IsA())];
+  if (index>=(Int_t)decisions.size()) decisions.resize(index+1);
+  UInt_t bit = 1u<<iCut;
+  std::pair<UInt_t,UInt_t>& decision = decisions[index];
+  if (decision.first & bit) {
+    fNReused++;
+    return (decision.second & bit) != 0;
+  }
+
+  fNEvaluations++;
+  Bool_t isSelected = cut->IsSelected(obj);
+  decision.first |= bit;
+  if (isSelected) decision.second |= bit;
+  return isSelected;
+}
+
+//___________________________________________________________________________
+void AliCFCutCache::Reset()
+{
+  //
+  // forgets the decisions of the previous event, the counters are kept
+  //
+  for (UInt_t i=0; i<fDecisions.size(); i++) fDecisions[i].clear();
+}
+
+//___________________________________________________________________________
+void AliCFCutCache::Print(Option_t*) const
+{
+  //
+  // prints the number of evaluated and reused cut decisions
+  //
+  printf("AliCFCutCache: %u cuts cached, %lld evaluations, %lld saved\n",(UInt_t)fCuts.size(),fNEvaluations,fNReused);
+}
@@ -0,0 +1,45 @@
+#ifndef ALICFCUTCACHE_H
+#define ALICFCUTCACHE_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+// Per-event cache of the decisions of the particle-level cuts,
+// shared by the selection steps of one or several AliCFManager.
+
+#include <vector>
+#include <utility>
+#include "TObject.h"
+
+class TClass;
+class AliCFCutBase;
+//___________________________________________________________________________
+class AliCFCutCache : public TObject
+{
+ public:
+  AliCFCutCache(); //default ctor
+  virtual ~AliCFCutCache() {;} //dtor
+
+  Bool_t   IsSelected(AliCFCutBase* cut, TObject* obj, Int_t index); // decision of the cut for obj, the index-th object of its class, evaluated once per event
+  void     Reset();                                     // to be called at each new event
+  Long64_t GetNEvaluations() const {return fNEvaluations;} // number of calls to AliCFCutBase::IsSelected()
+  Long64_t GetNReused()      const {return fNReused;}      // number of decisions taken from the cache
+  virtual void Print(Option_t* opt="") const;
+
+ private:
+  AliCFCutCache(const AliCFCutCache& c); //not implemented
+  AliCFCutCache& operator=(const AliCFCutCache& c); //not implemented
+
+  Int_t GetCutIndex(const AliCFCutBase* cut);
+  Int_t GetClassIndex(const TClass* cl);
+
+  enum {kMaxCuts=32}; // number of cuts whose decisions can be cached
+
+  std::vector<const AliCFCutBase*> fCuts; //! cuts registered in the cache, the index is the bit of the cut
+  std::vector<const TClass*> fClasses; //! classes of the cached objects
+  std::vector<std::vector<std::pair<UInt_t,UInt_t> > > fDecisions; //! per class and object index: bits of the evaluated cuts, bits of the passed cuts
+  Long64_t fNEvaluations; // number of cut evaluations
+  Long64_t fNReused;      // number of cut evaluations saved
+
+  ClassDef(AliCFCutCache,2); // per-event cache of CF cut decisions
+};
+
+#endif
@@ -34,6 +34,9 @@
 #include "TH3D.h"
 #include "TAxis.h"
 #include "AliCFUnfolding.h"
+#include "TBuffer.h"
+#include <algorithm>
+#include <vector>
 
 //____________________________________________________________________
 ClassImp(AliCFGridSparse)
@@ -42,7 +45,10 @@ ClassImp(AliCFGridSparse)
 AliCFGridSparse::AliCFGridSparse() : 
   AliCFFrame(),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fFillBufferSize(0),
+  fFillBuffer(),
+  fFillBufferEntries(0)
 {
   // default constructor
 }
@@ -50,7 +56,10 @@ AliCFGridSparse::AliCFGridSparse() :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) : 
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fFillBufferSize(0),
+  fFillBuffer(),
+  fFillBufferEntries(0)
 {
   // default constructor
 }
@@ -58,7 +67,10 @@ AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title, Int_t nVarIn, const Int_t * nBinIn) :  
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fFillBufferSize(0),
+  fFillBuffer(),
+  fFillBufferEntries(0)
 {
   //
   // main constructor
@@ -80,7 +92,10 @@ AliCFGridSparse::~AliCFGridSparse()
 AliCFGridSparse::AliCFGridSparse(const AliCFGridSparse& c) :
   AliCFFrame(c),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fFillBufferSize(0),
+  fFillBuffer(),
+  fFillBufferEntries(0)
 {
   //
   // copy constructor
@@ -107,7 +122,7 @@ void AliCFGridSparse::SetBinLimits(Int_t ivar, Double_t min, Double_t max)
   Int_t nBins = GetNBins(ivar);
   Double_t * array = new Double_t[nBins+1];
   for (Int_t iEdge=0; iEdge<=nBins; iEdge++) array[iEdge] = min + iEdge * (max-min)/nBins ;
-  fData->SetBinEdges(ivar, array);
+  Data()->SetBinEdges(ivar, array);
   delete [] array ;
 } 
 
@@ -117,7 +132,7 @@ void AliCFGridSparse::SetBinLimits(Int_t ivar, const Double_t *array)
   //
   // setting the arrays containing the bin limits 
   //
-  fData->SetBinEdges(ivar, array);
+  Data()->SetBinEdges(ivar, array);
 } 
 
 //____________________________________________________________________
@@ -128,7 +143,114 @@ void AliCFGridSparse::Fill(const Double_t *var, Double_t weight)
   // given a set of values of the input variable, 
   // with weight (by default w=1)
   //
-  fData->Fill(var,weight);
+  if (fFillBufferSize<=0) {
+    fData->Fill(var,weight);
+    return;
+  }
+
+  // buffered fill: the bin is identified by its global index over all
+  // the bins (under/overflow included) and looked up in a hash table
+  Long64_t index = 0;
+  for (Int_t iVar=GetNVar()-1; iVar>=0; iVar--) {
+    TAxis* axis = fData->GetAxis(iVar);
+    index = index*(axis->GetNbins()+2) + axis->FindFixBin(var[iVar]);
+  }
+  std::pair<Double_t,Double_t>& sums = fFillBuffer[index];
+  sums.first  += weight;
+  sums.second += weight*weight;
+  fFillBufferEntries++;
+  if ((Int_t)fFillBuffer.size() >= fFillBufferSize) FlushFillBuffer();
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::Fill(Int_t nEntries, const Double_t *var, const Double_t *weights)
+{
+  //
+  // Fill the grid with nEntries entries at once,
+  // var holds the GetNVar() values of each entry one after the other,
+  // weights the weight of each entry (by default w=1)
+  //
+  Int_t nVar = GetNVar();
+  for (Int_t iEntry=0; iEntry<nEntries; iEntry++) Fill(var+iEntry*nVar, weights ? weights[iEntry] : 1.);
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::SetFillBuffer(Int_t maxBins)
+{
+  //
+  // Buffer the fills in a hash table of at most maxBins bins instead of filling
+  // the THnSparse at each entry. The buffer is added to the THnSparse when it is
+  // full, and before the grid is accessed, merged, copied or written.
+  // Bin contents, bin errors and the number of entries are the same as without
+  // buffer. The THnBase sums of the fills (GetSumw(), GetSumw2(), GetSumwx() and
+  // GetSumwx2()) are not updated for the buffered fills, so that consumers of these
+  // sums, e.g. the statistics added by THnBase::Add() when merging, do not see
+  // the buffered entries. maxBins=0 switches the buffer off.
+  //
+  FlushFillBuffer();
+  fFillBufferSize = 0;
+  if (maxBins<=0) return;
+
+  Double_t nBins = 1.;
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) nBins *= fData->GetAxis(iVar)->GetNbins()+2;
+  if (nBins > 1.e18) {
+    AliWarning(Form("Too many bins (%e) to index, fills are not buffered",nBins));
+    return;
+  }
+  fFillBufferSize = maxBins;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::FlushFillBuffer() const
+{
+  //
+  // add the buffered fills to the THnSparse, in the order of the bin indices
+  //
+  if (fFillBufferEntries<=0) return;
+
+  std::vector<Long64_t> indices;
+  indices.reserve(fFillBuffer.size());
+  for (std::unordered_map<Long64_t, std::pair<Double_t,Double_t> >::const_iterator it=fFillBuffer.begin(); it!=fFillBuffer.end(); ++it)
+    indices.push_back(it->first);
+  std::sort(indices.begin(),indices.end());
+
+  Int_t nVar = GetNVar();
+  Int_t* bin = new Int_t[nVar];
+  Double_t entries = fData->GetEntries();
+  Bool_t   errors  = fData->GetCalculateErrors();
+  for (UInt_t i=0; i<indices.size(); i++) {
+    Long64_t index = indices[i];
+    for (Int_t iVar=0; iVar<nVar; iVar++) {
+      Int_t nBins = fData->GetAxis(iVar)->GetNbins()+2;
+      bin[iVar] = index % nBins;
+      index /= nBins;
+    }
+    const std::pair<Double_t,Double_t>& sums = fFillBuffer[indices[i]];
+    Long64_t iBin = fData->GetBin(bin,kTRUE);
+    fData->SetBinContent(iBin,fData->GetBinContent(iBin)+sums.first);
+    if (errors) fData->SetBinError2(iBin,fData->GetBinError2(iBin)+sums.second);
+  }
+  fData->SetEntries(entries+fFillBufferEntries);
+  delete [] bin;
+
+  ClearFillBuffer();
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::Streamer(TBuffer &R__b)
+{
+  //
+  // Stream an object of class AliCFGridSparse,
+  // the buffered fills are added to the THnSparse before writing
+  //
+  if (R__b.IsReading()) {
+    R__b.ReadClassBuffer(AliCFGridSparse::Class(),this);
+    ClearFillBuffer();
+  }
+  else {
+    FlushFillBuffer();
+    R__b.WriteClassBuffer(AliCFGridSparse::Class(),this);
+  }
 }
 
 //___________________________________________________________________
@@ -150,7 +272,7 @@ AliCFGridSparse* AliCFGridSparse::MakeSlice(Int_t nVars, const Int_t* vars, cons
   AliCFGridSparse* out = new AliCFGridSparse(fName,fTitle,nVars,bins);
 
   //set the range in the THnSparse to project
-  THnSparse* clone = ((THnSparse*)fData->Clone());
+  THnSparse* clone = ((THnSparse*)Data()->Clone());
   if (varMin && varMax) {
     for (Int_t iAxis=0; iAxis<GetNVar(); iAxis++) {
       SetAxisRange(clone->GetAxis(iAxis),varMin[iAxis],varMax[iAxis],useBins);
@@ -192,7 +314,7 @@ Float_t AliCFGridSparse::GetEntries() const
   // total entries (including overflows and underflows)
   //
 
-  return fData->GetEntries();
+  return Data()->GetEntries();
 }
 
 //____________________________________________________________________
@@ -202,7 +324,7 @@ Float_t AliCFGridSparse::GetElement(Long_t index) const
   // Returns content of grid element index 
   //
   
-  return fData->GetBinContent(index);
+  return Data()->GetBinContent(index);
 }
 //____________________________________________________________________
 Float_t AliCFGridSparse::GetElement(const Int_t *bin) const
@@ -210,7 +332,7 @@ Float_t AliCFGridSparse::GetElement(const Int_t *bin) const
   //
   // Get the content in a bin corresponding to a set of bin indexes
   //
-  return fData->GetBinContent(bin);
+  return Data()->GetBinContent(bin);
 
 }  
 //____________________________________________________________________
@@ -220,9 +342,9 @@ Float_t AliCFGridSparse::GetElement(const Double_t *var) const
   // Get the content in a bin corresponding to a set of input variables
   //
 
-  Long_t index = fData->GetBin(var,kFALSE);
+  Long_t index = Data()->GetBin(var,kFALSE);
   if (index<0) return 0.;
-  return fData->GetBinContent(index);
+  return Data()->GetBinContent(index);
 } 
 
 //____________________________________________________________________
@@ -232,7 +354,7 @@ Float_t AliCFGridSparse::GetElementError(Long_t index) const
   // Returns the error on the content 
   //
 
-  return fData->GetBinError(index);
+  return Data()->GetBinError(index);
 }
 //____________________________________________________________________
 Float_t AliCFGridSparse::GetElementError(const Int_t *bin) const
@@ -240,7 +362,7 @@ Float_t AliCFGridSparse::GetElementError(const Int_t *bin) const
  //
   // Get the error in a bin corresponding to a set of bin indexes
   //
-  return fData->GetBinError(bin);
+  return Data()->GetBinError(bin);
 
 }  
 //____________________________________________________________________
@@ -250,9 +372,9 @@ Float_t AliCFGridSparse::GetElementError(const Double_t *var) const
   // Get the error in a bin corresponding to a set of input variables
   //
 
-  Long_t index=fData->GetBin(var,kFALSE); //this is the THnSparse index (do not allocate new cells if content is empy)
+  Long_t index=Data()->GetBin(var,kFALSE); //this is the THnSparse index (do not allocate new cells if content is empy)
   if (index<0) return 0.;
-  return fData->GetBinError(index);
+  return Data()->GetBinError(index);
 } 
 
 //____________________________________________________________________
@@ -262,7 +384,7 @@ void AliCFGridSparse::SetElement(Long_t index, Float_t val)
   // Sets grid element value
   //
   Int_t* bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin); //affects the bin coordinates
+  Data()->GetBinContent(index,bin); //affects the bin coordinates
   SetElement(bin,val);
   delete [] bin ;
 }
@@ -273,7 +395,7 @@ void AliCFGridSparse::SetElement(const Int_t *bin, Float_t val)
   //
   // Sets grid element of bin indeces bin to val
   //
-  fData->SetBinContent(bin,val);
+  Data()->SetBinContent(bin,val);
 }
 //____________________________________________________________________
 void AliCFGridSparse::SetElement(const Double_t *var, Float_t val) 
@@ -281,9 +403,9 @@ void AliCFGridSparse::SetElement(const Double_t *var, Float_t val)
   //
   // Set the content in a bin to value val corresponding to a set of input variables
   //
-  Long_t index=fData->GetBin(var,kTRUE); //THnSparse index: allocate the cell
+  Long_t index=Data()->GetBin(var,kTRUE); //THnSparse index: allocate the cell
   Int_t *bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin); //trick to access the array of bins
+  Data()->GetBinContent(index,bin); //trick to access the array of bins
   SetElement(bin,val);
   delete [] bin;
 }
@@ -295,7 +417,7 @@ void AliCFGridSparse::SetElementError(Long_t index, Float_t val)
   // Sets grid element iel error to val (linear indexing) in AliCFFrame
   //
   Int_t *bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin);
+  Data()->GetBinContent(index,bin);
   SetElementError(bin,val);
   delete [] bin;
 }
@@ -306,7 +428,7 @@ void AliCFGridSparse::SetElementError(const Int_t *bin, Float_t val)
   //
   // Sets grid element error of bin indeces bin to val
   //
-  fData->SetBinError(bin,val);
+  Data()->SetBinError(bin,val);
 }
 //____________________________________________________________________
 void AliCFGridSparse::SetElementError(const Double_t *var, Float_t val) 
@@ -314,9 +436,9 @@ void AliCFGridSparse::SetElementError(const Double_t *var, Float_t val)
   //
   // Set the error in a bin to value val corresponding to a set of input variables
   //
-  Long_t index=fData->GetBin(var); //THnSparse index
+  Long_t index=Data()->GetBin(var); //THnSparse index
   Int_t *bin = new Int_t[GetNVar()];
-  fData->GetBinContent(index,bin); //trick to access the array of bins
+  Data()->GetBinContent(index,bin); //trick to access the array of bins
   SetElementError(bin,val);
   delete [] bin;
 }
@@ -328,7 +450,7 @@ void AliCFGridSparse::SumW2()
   //set calculation of the squared sum of the weighted entries
   //
   if(!fSumW2){
-    fData->CalculateErrors(kTRUE); 
+    Data()->CalculateErrors(kTRUE); 
   }
   fSumW2=kTRUE;
 }
@@ -346,7 +468,7 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid, Double_t c)
   } 
   
   if (!fSumW2  && aGrid->GetSumW2()) SumW2();
-  fData->Add(aGrid->GetGrid(),c);
+  Data()->Add(aGrid->GetGrid(),c);
 }
 
 //____________________________________________________________________
@@ -363,9 +485,9 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid1, const AliCFGridSparse*
   
   if (!fSumW2  && (aGrid1->GetSumW2() || aGrid2->GetSumW2())) SumW2();
 
-  fData->Reset();
-  fData->Add(aGrid1->GetGrid(),c1);
-  fData->Add(aGrid2->GetGrid(),c2);
+  Data()->Reset();
+  Data()->Add(aGrid1->GetGrid(),c1);
+  Data()->Add(aGrid2->GetGrid(),c2);
 }
 
 //____________________________________________________________________
@@ -382,8 +504,8 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid, Double_t c)
   
   if(!fSumW2  && aGrid->GetSumW2()) SumW2();
   THnSparse *h = aGrid->GetGrid();
-  fData->Multiply(h);
-  fData->Scale(c);
+  Data()->Multiply(h);
+  Data()->Scale(c);
 }
 
 //____________________________________________________________________
@@ -400,12 +522,12 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid1, const AliCFGridSpa
   
   if(!fSumW2  && (aGrid1->GetSumW2() || aGrid2->GetSumW2())) SumW2();
 
-  fData->Reset();
+  Data()->Reset();
   THnSparse *h1 = aGrid1->GetGrid();
   THnSparse *h2 = aGrid2->GetGrid();
   h2->Multiply(h1);
   h2->Scale(c1*c2);
-  fData->Add(h2);
+  Data()->Add(h2);
 }
 
 //____________________________________________________________________
@@ -423,9 +545,9 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid, Double_t c)
   if (!fSumW2  && aGrid->GetSumW2()) SumW2();
 
   THnSparse *h1 = aGrid->GetGrid();
-  THnSparse *h2 = (THnSparse*)fData->Clone();
-  fData->Divide(h2,h1);
-  fData->Scale(c);
+  THnSparse *h2 = (THnSparse*)Data()->Clone();
+  Data()->Divide(h2,h1);
+  Data()->Scale(c);
 }
 
 //____________________________________________________________________
@@ -445,7 +567,7 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid1, const AliCFGridSpars
 
   THnSparse *h1= aGrid1->GetGrid();
   THnSparse *h2= aGrid2->GetGrid();
-  fData->Divide(h1,h2,c1,c2,option);
+  Data()->Divide(h1,h2,c1,c2,option);
 }
 
 
@@ -462,8 +584,8 @@ void AliCFGridSparse::Rebin(const Int_t* group)
     if (group[i]!=1) AliInfo(Form(" merging bins along dimension %i in groups of %i bins", i,group[i]));
   }
 
-  THnSparse *rebinned =fData->Rebin(group);
-  fData->Reset();
+  THnSparse *rebinned =Data()->Rebin(group);
+  Data()->Reset();
   fData = rebinned;
 }
 //____________________________________________________________________
@@ -553,7 +675,7 @@ Double_t AliCFGridSparse::GetIntegral() const
   //
   // Get full Integral
   //
-  return fData->ComputeIntegral();  
+  return Data()->ComputeIntegral();  
 } 
 
 //____________________________________________________________________
@@ -606,8 +728,10 @@ void AliCFGridSparse::Copy(TObject& c) const
   AliCFFrame::Copy(c);
   AliCFGridSparse& target = (AliCFGridSparse &) c;
   target.fSumW2 = fSumW2 ;
+  target.fFillBufferSize = fFillBufferSize ;
+  target.ClearFillBuffer();
   if (fData) {
-    target.fData = (THnSparse*)fData->Clone();
+    target.fData = (THnSparse*)Data()->Clone();
   }
 }
 
@@ -621,7 +745,7 @@ TH1* AliCFGridSparse::Slice(Int_t iVar1, Int_t iVar2, Int_t iVar3, const Double_
   // If useBins=true, varMin and varMax are taken as bin numbers
   // if varmin or varmax point to null, all the range is taken, including over- and underflows
 
-  THnSparse* clone = (THnSparse*)fData->Clone();
+  THnSparse* clone = (THnSparse*)Data()->Clone();
   if (varMin != 0x0 && varMax != 0x0) {
     for (Int_t iAxis=0; iAxis<GetNVar(); iAxis++) SetAxisRange(clone->GetAxis(iAxis),varMin[iAxis],varMax[iAxis],useBins);
   }
@@ -712,9 +836,9 @@ void AliCFGridSparse::SetRangeUser(Int_t iVar, Double_t varMin, Double_t varMax,
   //
   // set range of axis iVar. 
   //
-  SetAxisRange(fData->GetAxis(iVar),varMin,varMax,useBins);
+  SetAxisRange(Data()->GetAxis(iVar),varMin,varMax,useBins);
 	//AliInfo(Form("AliCFGridSparse axis %d range has been modified",iVar));
-	TAxis* currAxis = fData->GetAxis(iVar);
+	TAxis* currAxis = Data()->GetAxis(iVar);
   TString outString = Form("%s new range: %.5f < %s < %.5f", GetName(), currAxis->GetBinLowEdge(currAxis->GetFirst()), currAxis->GetTitle(), currAxis->GetBinUpEdge(currAxis->GetLast()));
   TString binLabel = currAxis->GetBinLabel(currAxis->GetFirst());
   if ( ! binLabel.IsNull() ) {
@@ -749,8 +873,8 @@ Float_t AliCFGridSparse::GetOverFlows(Int_t ivar, Bool_t exclusive) const
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t ovfl=0.;
-  for (Long64_t i = 0; i < fData->GetNbins(); i++) {
-    Double_t v = fData->GetBinContent(i, bin);
+  for (Long64_t i = 0; i < Data()->GetNbins(); i++) {
+    Double_t v = Data()->GetBinContent(i, bin);
     Bool_t add=kTRUE;
     if (exclusive) {
       for(Int_t j=0;j<GetNVar();j++){
@@ -775,8 +899,8 @@ Float_t AliCFGridSparse::GetUnderFlows(Int_t ivar, Bool_t exclusive) const
   Int_t* bin = new Int_t[GetNVar()];
   memset(bin, 0, sizeof(Int_t) * GetNVar());
   Float_t unfl=0.;
-  for (Long64_t i = 0; i < fData->GetNbins(); i++) {
-    Double_t v = fData->GetBinContent(i, bin);
+  for (Long64_t i = 0; i < Data()->GetNbins(); i++) {
+    Double_t v = Data()->GetBinContent(i, bin);
     Bool_t add=kTRUE;
     if (exclusive) {
       for(Int_t j=0;j<GetNVar();j++){
@@ -801,5 +925,5 @@ void AliCFGridSparse::Smooth() {
   AliInfo("Your GridSparse is going to be smoothed");
   AliInfo(Form("N TOTAL  BINS : %li",GetNBinsTotal()));
   AliInfo(Form("N FILLED BINS : %li",GetNFilledBins()));
-  AliCFUnfolding::SmoothUsingNeighbours(fData);
+  AliCFUnfolding::SmoothUsingNeighbours(Data());
 }
@@ -8,6 +8,8 @@
 // Author:S.Arcelli, silvia.arcelli@cern.ch
 //--------------------------------------------------------------------//
 
+#include <unordered_map>
+#include <utility>
 #include "AliCFFrame.h"
 #include "THnSparse.h"
 #include "AliLog.h"
@@ -37,7 +39,7 @@ class AliCFGridSparse : public AliCFFrame
   virtual void       GetBinLimits(Int_t ivar, Double_t * array) const ;
   virtual Double_t * GetBinLimits(Int_t ivar) const ;
   virtual Long_t     GetNBinsTotal() const ;
-  virtual Long_t     GetNFilledBins() const {return fData->GetNbins();}
+  virtual Long_t     GetNFilledBins() const {return Data()->GetNbins();}
   virtual Int_t      GetNBins(Int_t ivar) const {return fData->GetAxis(ivar)->GetNbins();}
   virtual Int_t *    GetNBins() const ;
   virtual Float_t    GetBinCenter(Int_t ivar,Int_t ibin) const ;
@@ -56,6 +58,10 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Int_t      GetBinIndex(Int_t ivar, Int_t ind) const ;
 
   virtual void    Fill(const Double_t *var, Double_t weight=1.);
+  virtual void    Fill(Int_t nEntries, const Double_t *var, const Double_t *weights=0x0); // var: nEntries x GetNVar() values
+  virtual void    SetFillBuffer(Int_t maxBins=100000); // accumulate fills in a hash table of at most maxBins bins (0: off)
+  virtual Int_t   GetFillBufferSize() const {return fFillBufferSize;}
+  virtual void    FlushFillBuffer() const ;           // adds the buffered fills to the THnSparse
   virtual Float_t GetEntries()const;
   virtual Float_t GetElement(Long_t iel)               const; 
   virtual Float_t GetElement(const Int_t *bin)         const; 
@@ -99,8 +105,8 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Double_t GetIntegral(const Double_t *varMin, const Double_t *varMax) const;
   virtual Long64_t Merge(TCollection* list);
 
-  virtual void     SetGrid(THnSparse* grid) {if (fData) delete fData ; fData=grid;}
-  THnSparse   *    GetGrid() const {return fData;}
+  virtual void     SetGrid(THnSparse* grid) {ClearFillBuffer(); if (fData) delete fData ; fData=grid;}
+  THnSparse   *    GetGrid() const {return Data();}
 
   virtual Float_t GetOverFlows (Int_t var, Bool_t excl=kFALSE) const;
   virtual Float_t GetUnderFlows(Int_t var, Bool_t excl=kFALSE) const;
@@ -118,12 +124,17 @@ class AliCFGridSparse : public AliCFFrame
   void     SetAxisRange(TAxis* axis, Double_t min, Double_t max, Bool_t useBins) const;
   void     GetProjectionName (TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
   void     GetProjectionTitle(TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
+  THnSparse* Data() const {if (fFillBufferEntries>0) FlushFillBuffer(); return fData;} // the THnSparse, with the buffered fills
+  void     ClearFillBuffer() const {fFillBuffer.clear(); fFillBufferEntries=0;}
 
   // data members:
   Bool_t      fSumW2    ; // Flag to check if calculation of squared weights enabled
   THnSparse  *fData     ; // The data Container: a THnSparse  
+  Int_t       fFillBufferSize ; // Maximum number of bins in the fill buffer, 0 if fills go directly to the THnSparse
+  mutable std::unordered_map<Long64_t, std::pair<Double_t,Double_t> > fFillBuffer; //! sum of weights and squared weights of the buffered fills per bin
+  mutable Double_t fFillBufferEntries; //! number of buffered fills
 
-  ClassDef(AliCFGridSparse,3);
+  ClassDef(AliCFGridSparse,4);
 };
 
 
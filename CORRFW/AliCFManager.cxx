@@ -23,6 +23,7 @@
 ///////////////////////////////////////////////////////////////////////////
 #include "AliCFCutBase.h"
 #include "AliCFManager.h"
+#include "AliCFCutCache.h"
 
 ClassImp(AliCFManager)
 
@@ -34,7 +35,8 @@ AliCFManager::AliCFManager() :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fCutCache(0x0)
 { 
   //
   // ctor
@@ -48,7 +50,8 @@ AliCFManager::AliCFManager(const Char_t* name, const Char_t* title) :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fCutCache(0x0)
 { 
    //
    // ctor
@@ -62,7 +65,8 @@ AliCFManager::AliCFManager(const AliCFManager& c) :
   fEvtContainer(c.fEvtContainer),
   fPartContainer(c.fPartContainer),
   fEvtCutList(c.fEvtCutList),
-  fPartCutList(c.fPartCutList)
+  fPartCutList(c.fPartCutList),
+  fCutCache(c.fCutCache)
 { 
    //
    //copy ctor
@@ -84,6 +88,7 @@ AliCFManager& AliCFManager::operator=(const AliCFManager& c)
   this->fPartContainer=c.fPartContainer;
   this->fEvtCutList=c.fEvtCutList;
   this->fPartCutList=c.fPartCutList;
+  this->fCutCache=c.fCutCache;
   return *this ;
 }
 
@@ -97,7 +102,17 @@ AliCFManager::~AliCFManager() {
 //_____________________________________________________________________________
 Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, const TString  &selcuts) const {
   //
-  // check whether object obj passes particle-level selection isel
+  // check whether object obj passes particle-level selection isel,
+  // the decisions are not cached
+  //
+  return CheckParticleCuts(isel,obj,-1,selcuts);
+}
+
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, Int_t index, const TString  &selcuts) const {
+  //
+  // check whether object obj, with index index in the event, passes
+  // particle-level selection isel
   //
 
   if(isel>=fNStepPart){
@@ -110,7 +125,9 @@ Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, const TString
   while ( (cut = (AliCFCutBase*)iter.Next()) ) {
     TString cutName=cut->GetName();
     Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+    if(!checkCut) continue;
+    Bool_t isSelected = fCutCache ? fCutCache->IsSelected(cut,obj,index) : cut->IsSelected(obj);
+    if(!isSelected) return kFALSE;   
   }
   return kTRUE;
 }
@@ -139,6 +156,9 @@ Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &se
 //_____________________________________________________________________________
 void  AliCFManager::SetMCEventInfo(const TObject *obj) const {
 
+  //new event: the cached cut decisions are obsolete
+  if (fCutCache) fCutCache->Reset();
+
   //Particle level cuts
 
   if (!fPartCutList) {
@@ -174,6 +194,9 @@ void  AliCFManager::SetMCEventInfo(const TObject *obj) const {
 //_____________________________________________________________________________
 void  AliCFManager::SetRecEventInfo(const TObject *obj) const {
 
+  //new event: the cached cut decisions are obsolete
+  if (fCutCache) fCutCache->Reset();
+
   //Particle level cuts
 
   if (!fPartCutList) {
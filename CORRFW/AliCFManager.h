@@ -28,6 +28,8 @@
 #include "AliCFContainer.h"
 #include "AliLog.h"
 
+class AliCFCutCache;
+
 //____________________________________________________________________________
 class AliCFManager : public TNamed 
 {
@@ -87,6 +89,11 @@ class AliCFManager : public TNamed
   //Setter for particle-level selection cut list at selection step isel
   virtual void SetParticleCutsList(Int_t isel, TObjArray* array) ;
 
+  //Per-event cache of the particle-level cut decisions (not owned), can be
+  //shared between managers. It is reset by SetMCEventInfo/SetRecEventInfo,
+  //only the particles checked with their index in the event are cached
+  virtual void SetCutCache(AliCFCutCache* cache) {fCutCache=cache;}
+
   //
   //Getters
   //
@@ -101,6 +108,9 @@ class AliCFManager : public TNamed
 
 //pointer to the particle-level cut list for particle selection step isel
   virtual TObjArray* GetParticleCutsList(Int_t isel) const {return fPartCutList[isel];};
+
+  //pointer to the cache of the particle-level cut decisions
+  virtual AliCFCutCache* GetCutCache() const {return fCutCache;}
   
 
   //Pass the pointer to obj to the selections (used to access MC/rec global
@@ -115,6 +125,9 @@ class AliCFManager : public TNamed
  
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
+  //same with the index of obj in the event (MC particle or track index),
+  //which identifies obj in the cut cache
+  virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, Int_t index, const TString &selcuts="all") const;
 
  private:
   
@@ -129,10 +142,12 @@ class AliCFManager : public TNamed
   TObjArray **fEvtCutList;   //[fNStepEvt] arrays of cuts for each event-selection level
   //Particle-level selections
   TObjArray **fPartCutList ; //[fNStepPart] arrays of cuts for each particle-selection level
+  //cache of the particle-level cut decisions
+  AliCFCutCache *fCutCache ; //! per-event cache of particle-level cut decisions (not owned)
 
   Bool_t CompareStrings(const TString  &cutname,const TString  &selcuts) const;
 
-  ClassDef(AliCFManager,2);
+  ClassDef(AliCFManager,3);
 };
 
 
@@ -92,6 +92,8 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TRandom3.h"
+#include "TROOT.h"
+#include <thread>
 
 
 ClassImp(AliCFUnfolding)
@@ -130,7 +132,15 @@ AliCFUnfolding::AliCFUnfolding() :
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(0)
+  fRandomSeed(0),
+  fUseDenseMatrices(kFALSE),
+  fMaxDenseCells(1000000),
+  fNThreads(1),
+  fDenseNBinsM(),
+  fDenseNBinsT(),
+  fDenseM(),
+  fDenseT(),
+  fDenseCond()
 {
   //
   // default constructor
@@ -174,7 +184,15 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(randomSeed)
+  fRandomSeed(randomSeed),
+  fUseDenseMatrices(kFALSE),
+  fMaxDenseCells(1000000),
+  fNThreads(1),
+  fDenseNBinsM(),
+  fDenseNBinsT(),
+  fDenseM(),
+  fDenseT(),
+  fDenseCond()
 {
   //
   // named constructor
@@ -350,6 +368,11 @@ void AliCFUnfolding::Unfold() {
   // several iterations are performed until a reasonable chi2 or convergence criterion is reached
   //
 
+  if (fUseDenseMatrices && fNCalcCorrErrors == 0 && BuildDenseConditional()) {
+    UnfoldDense();
+    return;
+  }
+
   Int_t iIterBayes     = 0 ;
   Double_t convergence = 0.;
 
@@ -862,3 +885,381 @@ void AliCFUnfolding::CreateFlatPrior() {
   delete [] bin;
   delete [] bins;
 }
+
+//______________________________________________________________
+
+Bool_t AliCFUnfolding::BuildDenseConditional() {
+  //
+  // Matrix backend : the spectra are held as vectors over the measured and true
+  // spaces (under/overflow bins included), and the conditional matrix as the list
+  // of its non-empty elements. Each bayes iteration then consists of two passes
+  // on the matrix elements, without coordinate conversion.
+  // Returns kFALSE (and the THnSparse are used) if the spaces are too large.
+  //
+
+  if (fDenseNBinsT.size()>0) return kTRUE; // already built
+
+  std::vector<Int_t> nBinsM(fNVariables), nBinsT(fNVariables);
+  Long64_t nCellsM = 1, nCellsT = 1;
+  for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+    nBinsM[iVar] = fMeasured->GetAxis(iVar)->GetNbins() + 2;
+    nBinsT[iVar] = fPrior   ->GetAxis(iVar)->GetNbins() + 2;
+    if (fConditional->GetAxis(iVar)            ->GetNbins()+2 != nBinsM[iVar] ||
+	fConditional->GetAxis(iVar+fNVariables)->GetNbins()+2 != nBinsT[iVar] ||
+	fEfficiency ->GetAxis(iVar)            ->GetNbins()+2 != nBinsT[iVar]) {
+      AliWarning(Form("Different binnings in dimension %d, not using the matrix backend",iVar));
+      return kFALSE;
+    }
+    nCellsM *= nBinsM[iVar];
+    nCellsT *= nBinsT[iVar];
+  }
+  if (nCellsM > fMaxDenseCells || nCellsT > fMaxDenseCells || TMath::Max(nCellsM,nCellsT) > kMaxInt) {
+    AliWarning(Form("Measured (%lld cells) or true (%lld cells) space larger than %lld cells, not using the matrix backend",nCellsM,nCellsT,fMaxDenseCells));
+    return kFALSE;
+  }
+
+  Long64_t nElements = fConditional->GetNbins();
+  fDenseM   .reserve(nElements);
+  fDenseT   .reserve(nElements);
+  fDenseCond.reserve(nElements);
+  for (Long_t iBin=0; iBin<nElements; iBin++) {
+    Double_t conditionalValue = fConditional->GetBinContent(iBin,fCoordinates2N);
+    if (!(conditionalValue>0.)) continue; // cannot contribute, see CreateEstMeasured() and CreateUnfolded()
+    GetCoordinates();
+    fDenseM   .push_back(GetDenseIndex(nBinsM,fCoordinatesN_M));
+    fDenseT   .push_back(GetDenseIndex(nBinsT,fCoordinatesN_T));
+    fDenseCond.push_back(conditionalValue);
+  }
+  fDenseNBinsM = nBinsM;
+  fDenseNBinsT = nBinsT;
+
+  AliInfo(Form("Matrix backend : %lld measured cells, %lld true cells, %d conditional matrix elements",nCellsM,nCellsT,(Int_t)fDenseCond.size()));
+  return kTRUE;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::UnfoldDense() {
+  //
+  // Unfold() with the matrix backend : same iterations, convergence criterion
+  // and smoothing. The internal THnSparse (prior, measured estimate, inverse
+  // response, unfolded) are updated at the end of the iterations.
+  //
+
+  std::vector<Double_t> prior, eff, meas, unfolded, estMeasured, priorTimesEff;
+  std::vector<Char_t>   priorMask;
+  FillDenseVector(fPrior     ,fDenseNBinsT,prior   ,&priorMask);
+  FillDenseVector(fEfficiency,fDenseNBinsT,eff     ,0x0);
+  FillDenseVector(fMeasured  ,fDenseNBinsM,meas    ,0x0);
+  FillDenseVector(fUnfolded  ,fDenseNBinsT,unfolded,0x0);
+
+  Int_t    iIterBayes  = 0;
+  Double_t convergence = 0.;
+  Short_t  status = DenseIterations(prior,&priorMask,eff,meas,unfolded,estMeasured,priorTimesEff,iIterBayes,convergence);
+
+  // update the internal THnSparse
+  FillFromDenseVector(fUnfolded,fDenseNBinsT,unfolded,0x0);
+  if (iIterBayes>0) FillFromDenseVector(fPrior,fDenseNBinsT,prior,&priorMask);
+  if (estMeasured.size()>0) {
+    FillFromDenseVector(fMeasuredEstimate,fDenseNBinsM,estMeasured,0x0);
+    Int_t* coord2N = new Int_t[2*fNVariables];
+    for (UInt_t iEl=0; iEl<fDenseCond.size(); iEl++) {
+      Double_t estMeasuredValue = estMeasured[fDenseM[iEl]];
+      Double_t fill = (estMeasuredValue>0. ? fDenseCond[iEl] * priorTimesEff[fDenseT[iEl]] / estMeasuredValue : 0.);
+      GetDenseCoordinates(fDenseNBinsM,fDenseM[iEl],coord2N);
+      GetDenseCoordinates(fDenseNBinsT,fDenseT[iEl],coord2N+fNVariables);
+      if (fill>0. || fInverseResponse->GetBinContent(coord2N)>0.) {
+	fInverseResponse->SetBinContent(coord2N,fill);
+	fInverseResponse->SetBinError  (coord2N,0.);
+      }
+    }
+    delete [] coord2N;
+  }
+
+  if (status == 1) {
+    fNRandomIterations = iIterBayes;
+    AliDebug(0,Form("convergence is met at iteration %d",iIterBayes));
+  }
+  else if (status == 2) {
+    AliError("Couldn't smooth the unfolded spectrum!!");
+    AliInfo(Form("\n\n=======================\nFinish at iteration %d : convergence is %e and you required it to be < %e\n=======================\n\n",iIterBayes,convergence,fMaxConvergence));
+    return;
+  }
+
+  fUnfoldedFinal = (THnSparse*) fUnfolded->Clone() ;
+
+  AliInfo("\n================================================\nFinished bayes iteration, now calculating errors...\n================================================\n");
+  fNCalcCorrErrors = 1;
+  CalculateCorrelatedErrorsDense();
+
+  AliInfo(Form("\n\n=======================\nFinished at iteration %d : convergence is %e and you required it to be < %e\n=======================\n\n",iIterBayes,convergence,fMaxConvergence));
+}
+
+//______________________________________________________________
+
+Short_t AliCFUnfolding::DenseIterations(std::vector<Double_t>& prior, std::vector<Char_t>* priorMask,
+					const std::vector<Double_t>& eff, const std::vector<Double_t>& meas,
+					std::vector<Double_t>& unfolded, std::vector<Double_t>& estMeasured,
+					std::vector<Double_t>& priorTimesEff, Int_t& iIterBayes, Double_t& convergence) {
+  //
+  // Bayes iterations of the matrix backend, the prior is updated after each iteration.
+  // The convergence criterion is only used if the filled bins of the prior (priorMask)
+  // are given, i.e. for the unfolding of the original spectrum.
+  // Returns 1 if the convergence is met, 2 if the smoothing failed, 0 otherwise.
+  // Without smoothing no data member is modified, so it can run in several threads.
+  //
+
+  convergence = 0.;
+  for (iIterBayes=0; iIterBayes<fMaxNumIterations; iIterBayes++) {
+
+    DenseBayesStep(prior,eff,meas,priorTimesEff,estMeasured,unfolded);
+
+    if (priorMask) {
+      convergence = GetDenseConvergence(prior,*priorMask,unfolded);
+      AliDebug(0,Form("convergence at iteration %d is %e",iIterBayes,convergence));
+      if (fMaxConvergence>0. && convergence<fMaxConvergence) return 1;
+    }
+
+    if (fUseSmoothing) {
+      FillFromDenseVector(fUnfolded,fDenseNBinsT,unfolded,0x0);
+      if (Smooth()) return 2;
+      FillDenseVector(fUnfolded,fDenseNBinsT,unfolded,priorMask);
+    }
+    else if (priorMask) {
+      for (UInt_t iCell=0; iCell<unfolded.size(); iCell++) (*priorMask)[iCell] = (unfolded[iCell]>0.);
+    }
+
+    // update the prior distribution
+    prior = unfolded;
+  }
+  return 0;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::DenseBayesStep(const std::vector<Double_t>& prior, const std::vector<Double_t>& eff,
+				    const std::vector<Double_t>& meas, std::vector<Double_t>& priorTimesEff,
+				    std::vector<Double_t>& estMeasured, std::vector<Double_t>& unfolded) const {
+  //
+  // One bayes iteration with the matrix backend, see CreateEstMeasured(),
+  // CreateInvResponse() and CreateUnfolded() :
+  //   M(i) = SUM_k { COND(i,k) * T(k) * E(k) }
+  //   U(j) = SUM_i { COND(i,j) * T(j) * E(j) / M(i) * MEAS(i) / E(j) }
+  //
+
+  UInt_t nCellsT = prior.size();
+  priorTimesEff.resize(nCellsT);
+  for (UInt_t iCell=0; iCell<nCellsT; iCell++) priorTimesEff[iCell] = prior[iCell] * eff[iCell];
+
+  estMeasured.assign(meas.size(),0.);
+  UInt_t nElements = fDenseCond.size();
+  for (UInt_t iEl=0; iEl<nElements; iEl++) {
+    Double_t fill = fDenseCond[iEl] * priorTimesEff[fDenseT[iEl]];
+    if (fill>0.) estMeasured[fDenseM[iEl]] += fill;
+  }
+
+  unfolded.assign(nCellsT,0.);
+  for (UInt_t iEl=0; iEl<nElements; iEl++) {
+    Double_t estMeasuredValue = estMeasured[fDenseM[iEl]];
+    Double_t effValue         = eff[fDenseT[iEl]];
+    if (!(estMeasuredValue>0.) || !(effValue>0.)) continue;
+    Double_t invResponseValue = fDenseCond[iEl] * priorTimesEff[fDenseT[iEl]] / estMeasuredValue;
+    Double_t fill = invResponseValue * meas[fDenseM[iEl]] / effValue;
+    if (fill>0.) unfolded[fDenseT[iEl]] += fill;
+  }
+}
+
+//______________________________________________________________
+
+Double_t AliCFUnfolding::GetDenseConvergence(const std::vector<Double_t>& prior, const std::vector<Char_t>& priorMask,
+					     const std::vector<Double_t>& unfolded) const {
+  //
+  // GetConvergence() with the matrix backend, summed over the filled bins of the prior
+  //
+  Double_t convergence = 0.;
+  for (UInt_t iCell=0; iCell<prior.size(); iCell++) {
+    if (!priorMask[iCell]) continue;
+    Double_t priorValue = prior[iCell];
+    if (priorValue > 0.)
+      convergence += ((priorValue-unfolded[iCell])/priorValue)*((priorValue-unfolded[iCell])/priorValue);
+    else
+      AliWarning(Form("priorValue = %f. Adding 0 to convergence criterion.",priorValue));
+  }
+  return convergence;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::CalculateCorrelatedErrorsDense() {
+  //
+  // CalculateCorrelatedErrors() with the matrix backend.
+  // Each randomized unfolding gets its own seed, drawn from fRandomSeed, and the
+  // unfoldings run on fNThreads threads (only one if smoothing is used).
+  // The deltas are added to the profile in the order of the unfoldings, so the
+  // result does not depend on the number of threads.
+  // The randomized response matrix is not drawn : the conditional matrix
+  // is computed once from the original response.
+  //
+
+  Int_t* coord = new Int_t[fNVariables];
+
+  // bins of the final unfolded spectrum
+  Int_t nFinal = fUnfoldedFinal->GetNbins();
+  std::vector<Int_t>    finalCell (nFinal);
+  std::vector<Double_t> finalValue(nFinal);
+  for (Long_t iBin=0; iBin<nFinal; iBin++) {
+    finalValue[iBin] = fUnfoldedFinal->GetBinContent(iBin,coord);
+    finalCell [iBin] = GetDenseIndex(fDenseNBinsT,coord);
+  }
+
+  // mean and sigma of the original efficiency and measured spectrum, in the order of the bins
+  std::vector<Int_t>    effCell (fEfficiencyOrig->GetNbins()), measCell (fMeasuredOrig->GetNbins());
+  std::vector<Double_t> effValue(effCell.size()),              measValue(measCell.size());
+  std::vector<Double_t> effError(effCell.size()),              measError(measCell.size());
+  for (Long_t iBin=0; iBin<(Long_t)effCell.size(); iBin++) {
+    effValue[iBin] = fEfficiencyOrig->GetBinContent(iBin,coord);
+    effError[iBin] = fEfficiencyOrig->GetBinError(iBin);
+    effCell [iBin] = GetDenseIndex(fDenseNBinsT,coord);
+  }
+  for (Long_t iBin=0; iBin<(Long_t)measCell.size(); iBin++) {
+    measValue[iBin] = fMeasuredOrig->GetBinContent(iBin,coord);
+    measError[iBin] = fMeasuredOrig->GetBinError(iBin);
+    measCell [iBin] = GetDenseIndex(fDenseNBinsM,coord);
+  }
+
+  std::vector<Double_t> priorOrig;
+  FillDenseVector(fPriorOrig,fDenseNBinsT,priorOrig,0x0);
+  Int_t nCellsM = 1;
+  for (Int_t iVar=0; iVar<fNVariables; iVar++) nCellsM *= fDenseNBinsM[iVar];
+
+  Int_t nRandom = TMath::Max(fNRandomIterations,0);
+  std::vector<UInt_t> seeds(nRandom);
+  for (Int_t i=0; i<nRandom; i++) seeds[i] = 1 + fRandom3->Integer(kMaxInt);
+
+  Int_t nThreads = (fUseSmoothing ? 1 : TMath::Max(1,TMath::Min(fNThreads,nRandom)));
+  if (nThreads>1) {
+    ROOT::EnableThreadSafety();
+    AliInfo(Form("Running %d randomized unfoldings on %d threads",nRandom,nThreads));
+  }
+
+  // work space and deltas of each thread
+  std::vector<std::vector<Double_t> > eff(nThreads), meas(nThreads), prior(nThreads), unfolded(nThreads);
+  std::vector<std::vector<Double_t> > estMeasured(nThreads), priorTimesEff(nThreads), delta(nThreads);
+
+  // randomized unfolding i in slot iSlot
+  auto unfoldRandomized = [&](Int_t i, Int_t iSlot) {
+    TRandom3 random(seeds[i]);
+    eff [iSlot].assign(priorOrig.size(),0.);
+    meas[iSlot].assign(nCellsM,0.);
+    for (UInt_t iBin=0; iBin<effCell .size(); iBin++) eff [iSlot][effCell [iBin]] = random.Gaus(effValue [iBin],effError [iBin]);
+    for (UInt_t iBin=0; iBin<measCell.size(); iBin++) meas[iSlot][measCell[iBin]] = random.Gaus(measValue[iBin],measError[iBin]);
+    prior[iSlot] = priorOrig;
+    Int_t    iIterBayes  = 0;
+    Double_t convergence = 0.;
+    DenseIterations(prior[iSlot],0x0,eff[iSlot],meas[iSlot],unfolded[iSlot],estMeasured[iSlot],priorTimesEff[iSlot],iIterBayes,convergence);
+    delta[iSlot].resize(nFinal);
+    for (Int_t iBin=0; iBin<nFinal; iBin++) delta[iSlot][iBin] = finalValue[iBin] - unfolded[iSlot][finalCell[iBin]];
+  };
+
+  // mean and mean of squares of the deltas, see FillDeltaUnfoldedProfile()
+  std::vector<Double_t> mean(nFinal,0.), meanx2(nFinal,0.);
+  Double_t entriesInBin = 0.;
+  for (Int_t first=0; first<nRandom; first+=nThreads) {
+    Int_t nBatch = TMath::Min(nThreads,nRandom-first);
+    if (nBatch==1) unfoldRandomized(first,0);
+    else {
+      std::vector<std::thread> workers;
+      for (Int_t iSlot=0; iSlot<nBatch; iSlot++) workers.push_back(std::thread(unfoldRandomized,first+iSlot,iSlot));
+      for (UInt_t iw=0; iw<workers.size(); iw++) workers[iw].join();
+    }
+    for (Int_t iSlot=0; iSlot<nBatch; iSlot++) {
+      for (Int_t iBin=0; iBin<nFinal; iBin++) {
+	Double_t deltaInBin = delta[iSlot][iBin];
+	mean  [iBin] = (mean  [iBin]*entriesInBin + deltaInBin)           / (entriesInBin+1);
+	meanx2[iBin] = (meanx2[iBin]*entriesInBin + deltaInBin*deltaInBin) / (entriesInBin+1);
+      }
+      entriesInBin++;
+    }
+  }
+
+  // fill the delta profile and the errors of the final unfolded spectrum
+  for (Int_t iBin=0; iBin<nFinal; iBin++) {
+    GetDenseCoordinates(fDenseNBinsT,finalCell[iBin],coord);
+    if (entriesInBin>0.) {
+      fDeltaUnfoldedP->SetBinError  (coord,meanx2[iBin]);
+      fDeltaUnfoldedP->SetBinContent(coord,mean[iBin]);
+      fDeltaUnfoldedN->SetBinContent(coord,entriesInBin);
+    }
+    Double_t sigma = 0.;
+    if (entriesInBin > 1.) sigma = TMath::Sqrt((entriesInBin/(entriesInBin-1.))*TMath::Abs(meanx2[iBin]-mean[iBin]*mean[iBin]));
+    fUnfoldedFinal->SetBinError(coord,sigma);
+  }
+  delete [] coord;
+
+  // now errors are calculated
+  fNCalcCorrErrors = 2;
+}
+
+//______________________________________________________________
+
+Int_t AliCFUnfolding::GetDenseIndex(const std::vector<Int_t>& nBins, const Int_t* coord) const {
+  //
+  // index in the vectors of the matrix backend of the cell with coordinates coord
+  //
+  Int_t index = 0;
+  for (Int_t iVar=fNVariables-1; iVar>=0; iVar--) index = index*nBins[iVar] + coord[iVar];
+  return index;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::GetDenseCoordinates(const std::vector<Int_t>& nBins, Int_t index, Int_t* coord) const {
+  //
+  // coordinates of the cell with index in the vectors of the matrix backend
+  //
+  for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+    coord[iVar] = index % nBins[iVar];
+    index /= nBins[iVar];
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::FillDenseVector(const THnSparse* hist, const std::vector<Int_t>& nBins,
+				     std::vector<Double_t>& values, std::vector<Char_t>* filled) const {
+  //
+  // copies the content of hist to values; filled (if given) flags the filled bins of hist
+  //
+  Int_t nCells = 1;
+  for (Int_t iVar=0; iVar<fNVariables; iVar++) nCells *= nBins[iVar];
+  values.assign(nCells,0.);
+  if (filled) filled->assign(nCells,0);
+
+  Int_t* coord = new Int_t[fNVariables];
+  for (Long_t iBin=0; iBin<hist->GetNbins(); iBin++) {
+    Double_t content = hist->GetBinContent(iBin,coord);
+    Int_t    index   = GetDenseIndex(nBins,coord);
+    values[index] = content;
+    if (filled) (*filled)[index] = 1;
+  }
+  delete [] coord;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::FillFromDenseVector(THnSparse* hist, const std::vector<Int_t>& nBins,
+					 const std::vector<Double_t>& values, const std::vector<Char_t>* filled) const {
+  //
+  // resets hist and sets the bins flagged in filled (if given), or else the positive values,
+  // with zero error
+  //
+  hist->Reset();
+  Int_t* coord = new Int_t[fNVariables];
+  for (UInt_t iCell=0; iCell<values.size(); iCell++) {
+    if (filled ? !(*filled)[iCell] : !(values[iCell]>0.)) continue;
+    GetDenseCoordinates(nBins,iCell,coord);
+    hist->SetBinContent(coord,values[iCell]);
+    hist->SetBinError  (coord,0.);
+  }
+  delete [] coord;
+}
@@ -10,6 +10,7 @@
 // Author : renaud.vernet@cern.ch                                     //
 //--------------------------------------------------------------------//
 
+#include <vector>
 #include "TNamed.h"
 #include "THnSparse.h"
 #include "AliLog.h"
@@ -37,6 +38,12 @@ class AliCFUnfolding : public TNamed {
 
   void SetNRandomIterations(Int_t n = 100) {fNRandomIterations = n;};
 
+  void SetUseDenseMatrices(Bool_t b = kTRUE, Long64_t maxCells = 1000000) { // spectra held as vectors over the N-dim space, used if
+    fUseDenseMatrices=b;                                                    // the measured and true spaces have at most maxCells cells
+    fMaxDenseCells=maxCells;                                                // (under/overflow included)
+  }
+  void SetNumberOfThreads(Int_t n = 1) {fNThreads = (n>0 ? n : 1);}         // threads for the randomized unfoldings (dense matrices only)
+
   void UseSmoothing(TF1* fcn=0x0, Option_t* opt="iremn") { // if fcn=0x0 then smooth using neighbouring bins 
     fUseSmoothing=kTRUE;                                   // this function must NOT be used if fNVariables > 3
     fSmoothFunction=fcn;                                   // the option "opt" is used if "fcn" is specified
@@ -112,6 +119,16 @@ class AliCFUnfolding : public TNamed {
   Short_t        fNCalcCorrErrors;   // Book-keeping to prevend infinite loop
   UInt_t         fRandomSeed;        // Random seed
 
+  /* matrix backend */
+  Bool_t                fUseDenseMatrices; // Use the matrix backend when the spaces are small enough
+  Long64_t              fMaxDenseCells;    // Maximum number of cells of the measured and true spaces for the matrix backend
+  Int_t                 fNThreads;         // Number of threads for the randomized unfoldings of the matrix backend
+  std::vector<Int_t>    fDenseNBinsM;      //! Number of bins (with under/overflow) per variable in measured space
+  std::vector<Int_t>    fDenseNBinsT;      //! Number of bins (with under/overflow) per variable in true space
+  std::vector<Int_t>    fDenseM;           //! Measured cell of each non-empty element of the conditional matrix
+  std::vector<Int_t>    fDenseT;           //! True cell of each non-empty element of the conditional matrix
+  std::vector<Double_t> fDenseCond;        //! Non-empty elements of the conditional matrix
+
 
   // functions
   void     Init();                  // initialisation of the internal settings
@@ -132,7 +149,27 @@ class AliCFUnfolding : public TNamed {
   void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
   void     SetMaxConvergencePerDOF (Double_t val);
 
-  ClassDef(AliCFUnfolding,1);
+  /* matrix backend */
+  Bool_t   BuildDenseConditional();     // creates the list of non-empty elements of the conditional matrix
+  void     UnfoldDense();               // Unfold() with the matrix backend
+  Short_t  DenseIterations(std::vector<Double_t>& prior, std::vector<Char_t>* priorMask,
+			    const std::vector<Double_t>& eff, const std::vector<Double_t>& meas,
+			    std::vector<Double_t>& unfolded, std::vector<Double_t>& estMeasured,
+			    std::vector<Double_t>& priorTimesEff, Int_t& iIterBayes, Double_t& convergence); // bayes iterations
+  void     DenseBayesStep(const std::vector<Double_t>& prior, const std::vector<Double_t>& eff,
+			  const std::vector<Double_t>& meas, std::vector<Double_t>& priorTimesEff,
+			  std::vector<Double_t>& estMeasured, std::vector<Double_t>& unfolded) const; // one bayes iteration
+  Double_t GetDenseConvergence(const std::vector<Double_t>& prior, const std::vector<Char_t>& priorMask,
+			       const std::vector<Double_t>& unfolded) const;
+  void     CalculateCorrelatedErrorsDense(); // CalculateCorrelatedErrors() with the matrix backend
+  Int_t    GetDenseIndex(const std::vector<Int_t>& nBins, const Int_t* coord) const;
+  void     GetDenseCoordinates(const std::vector<Int_t>& nBins, Int_t index, Int_t* coord) const;
+  void     FillDenseVector(const THnSparse* hist, const std::vector<Int_t>& nBins,
+			   std::vector<Double_t>& values, std::vector<Char_t>* filled) const;
+  void     FillFromDenseVector(THnSparse* hist, const std::vector<Int_t>& nBins,
+			       const std::vector<Double_t>& values, const std::vector<Char_t>* filled) const;
+
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
@@ -5,12 +5,13 @@
 #pragma link off all functions;
 
 #pragma link C++ class  AliCFFrame+;
-#pragma link C++ class  AliCFGridSparse+;
+#pragma link C++ class  AliCFGridSparse-;
 #pragma link C++ class  AliCFEffGrid+;
 #pragma link C++ class  AliCFDataGrid+;
 #pragma link C++ class  AliCFContainer+;
 #pragma link C++ class  AliCFManager+;
 #pragma link C++ class  AliCFCutBase+;
+#pragma link C++ class  AliCFCutCache+;
 #pragma link C++ class  AliCFEventClassCuts+;
 #pragma link C++ class  AliCFEventClassCuts+;
 #pragma link C++ class  AliCFEventGenCuts+;
@@ -42,6 +42,7 @@
 #include "TChain.h"
 #include "AliESDtrack.h"
 #include "AliLog.h"
+#include <vector>
 
 ClassImp(AliCFSingleTrackTask)
 
@@ -149,24 +150,32 @@ void AliCFSingleTrackTask::UserExec(Option_t *)
 
   // MC-event selection
   Double_t containerInput[2] ;
+  // the entries of each loop are collected and filled at once in the container
+  std::vector<Double_t> entryVars ;
+  std::vector<Int_t>    entrySteps ;
         
   //loop on the MC event
   for (Int_t ipart=0; ipart<fMCEvent->GetNumberOfTracks(); ipart++) { 
     AliMCParticle *mcPart  = (AliMCParticle*)fMCEvent->GetTrack(ipart);
 
     //check the MC-level cuts
-    if (!fCFManager->CheckParticleCuts(AliCFManager::kPartGenCuts,mcPart)) continue;
+    if (!fCFManager->CheckParticleCuts(AliCFManager::kPartGenCuts,mcPart,ipart)) continue;
 
     containerInput[0] = (Float_t)mcPart->Pt();
     containerInput[1] = mcPart->Eta() ;
     //fill the container for Gen-level selection
-    fCFManager->GetParticleContainer()->Fill(containerInput,kStepGenerated);
+    entryVars.insert(entryVars.end(),containerInput,containerInput+2);
+    entrySteps.push_back(kStepGenerated);
 
     //check the Acceptance-level cuts
-    if (!fCFManager->CheckParticleCuts(AliCFManager::kPartAccCuts,mcPart)) continue;
+    if (!fCFManager->CheckParticleCuts(AliCFManager::kPartAccCuts,mcPart,ipart)) continue;
     //fill the container for Acceptance-level selection
-    fCFManager->GetParticleContainer()->Fill(containerInput,kStepReconstructible);
+    entryVars.insert(entryVars.end(),containerInput,containerInput+2);
+    entrySteps.push_back(kStepReconstructible);
   }    
+  if (entrySteps.size()) fCFManager->GetParticleContainer()->Fill(entrySteps.size(),&entryVars[0],&entrySteps[0]);
+  entryVars.clear();
+  entrySteps.clear();
 
   //Now go to rec level
   for (Int_t iTrack = 0; iTrack<fEvent->GetNumberOfTracks(); iTrack++) {
@@ -187,7 +196,7 @@ void AliCFSingleTrackTask::UserExec(Option_t *)
       track = esdTrackTPC ;
     }
 
-    if (!fCFManager->CheckParticleCuts(AliCFManager::kPartRecCuts,track)) continue;
+    if (!fCFManager->CheckParticleCuts(AliCFManager::kPartRecCuts,track,iTrack)) continue;
     
     // is track associated to particle ?
 
@@ -197,7 +206,7 @@ void AliCFSingleTrackTask::UserExec(Option_t *)
     AliMCParticle *mcPart  = (AliMCParticle*)fMCEvent->GetTrack(label);
     
     // check if this track was part of the signal
-    if (!fCFManager->CheckParticleCuts(AliCFManager::kPartGenCuts,mcPart)) continue; 
+    if (!fCFManager->CheckParticleCuts(AliCFManager::kPartGenCuts,mcPart,label)) continue; 
     
     //fill the container
     Double_t mom[3];
@@ -205,13 +214,16 @@ void AliCFSingleTrackTask::UserExec(Option_t *)
     Double_t pt=TMath::Sqrt(mom[0]*mom[0]+mom[1]*mom[1]);
     containerInput[0] = pt ;
     containerInput[1] = track->Eta();
-    fCFManager->GetParticleContainer()->Fill(containerInput,kStepReconstructed) ;   
+    entryVars.insert(entryVars.end(),containerInput,containerInput+2);
+    entrySteps.push_back(kStepReconstructed);
 
-    if (!fCFManager->CheckParticleCuts(AliCFManager::kPartSelCuts,track)) continue ;
-    fCFManager->GetParticleContainer()->Fill(containerInput,kStepSelected);
+    if (!fCFManager->CheckParticleCuts(AliCFManager::kPartSelCuts,track,iTrack)) continue ;
+    entryVars.insert(entryVars.end(),containerInput,containerInput+2);
+    entrySteps.push_back(kStepSelected);
 
     if (fReadTPCTracks) delete track;
   }
+  if (entrySteps.size()) fCFManager->GetParticleContainer()->Fill(entrySteps.size(),&entryVars[0],&entrySteps[0]);
   
   fHistEventsProcessed->Fill(0);
 
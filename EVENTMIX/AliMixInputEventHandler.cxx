@@ -12,6 +12,9 @@
 #include <TChainElement.h>
 #include <TSystem.h>
 
+#include <map>
+#include <vector>
+
 #include "AliLog.h"
 #include "AliAnalysisManager.h"
 #include "AliInputEventHandler.h"
@@ -37,13 +40,22 @@ AliMixInputEventHandler::AliMixInputEventHandler(const Int_t size, const Int_t m
    fDoMixExtra(kTRUE),
    fDoMixIfNotEnoughEvents(kTRUE),
    fDoMixEventGetEntryAuto(kTRUE),
+   fReadAhead(kFALSE),
+   fReadAheadCacheSize(10000000),
+   fReadAheadMaxOpenFiles(2),
+   fReadAheadParallelUnzip(kTRUE),
    fCurrentEntry(0),
    fCurrentEntryMain(0),
    fCurrentEntryMix(0),
    fCurrentBinIndex(-1),
    fOfflineTriggerMask(0),
    fCurrentMixEntry(),
-   fCurrentEntryMainTree(0)
+   fCurrentEntryMainTree(0),
+   fStatRequests(0),
+   fStatEntryHits(0),
+   fStatFileSwitches(0),
+   fStatFileHits(0),
+   fStatBytesRead(0)
 {
    //
    // Default constructor.
@@ -97,7 +109,8 @@ Bool_t AliMixInputEventHandler::Init(TTree *tree, Option_t *opt)
       AliWarning("fDoMixIfNotEnoughEvents=kFALSE -> setting fDoMixExtra=kFALSE");
    }
 
-   // clears array of input handlers
+   // clears array of input handlers (keeping their read statistics)
+   for (Int_t i = 0; i < fMixTrees.GetEntries(); i++) AddReadStatistics((AliMixInputHandlerInfo *) fMixTrees.At(i));
    fMixTrees.Delete();
    // create AliMixInputHandlerInfo
    if (!fMixIntupHandlerInfoTmp) {
@@ -153,6 +166,7 @@ Bool_t AliMixInputEventHandler::Notify(const char *path)
    for (Int_t i = 0; i < fInputHandlers.GetEntries(); i++) {
       AliDebug(AliLog::kDebug + 5, Form("fInputHandlers[%d]", i));
       mixIHI = new AliMixInputHandlerInfo(fMixIntupHandlerInfoTmp->GetName(), fMixIntupHandlerInfoTmp->GetTitle());
+      if (fReadAhead) mixIHI->SetReadAhead(fReadAheadMaxOpenFiles, fReadAheadCacheSize, fReadAheadParallelUnzip);
       if (doPrepareEntry) mixIHI->PrepareEntry(che, -1, (AliInputEventHandler *)InputEventHandler(i), fAnalysisType);
       AliDebug(AliLog::kDebug + 5, Form("chain[%d]->GetEntries() = %lld", i, mixIHI->GetChain()->GetEntries()));
       fMixTrees.Add(mixIHI);
@@ -248,6 +262,11 @@ Bool_t AliMixInputEventHandler::MixStd()
    AliMixInputHandlerInfo *mihi = 0;
    Long64_t entryMix = 0, entryMixReal = 0;
    Int_t counter = 0;
+   if (fReadAhead && fDoMixEventGetEntryAuto) {
+      std::vector<Long64_t> entries;
+      for (counter = 0; counter < mixNum && fEntryCounter - 1 - counter >= 0; counter++) entries.push_back(fEntryCounter - 1 - counter);
+      if (!entries.empty()) PrefetchMixEntries((AliMixInputHandlerInfo *) fMixTrees.At(0), &entries[0], entries.size());
+   }
    for (counter = 0; counter < mixNum; counter++) {
       entryMix = fEntryCounter - 1 - counter ;
       AliDebug(AliLog::kDebug + 5, Form("Handler[%d] entryMix %lld ", counter, entryMix));
@@ -263,6 +282,7 @@ Bool_t AliMixInputEventHandler::MixStd()
          fNumberMixed++;
          UserExecMixAllTasks(fEntryCounter, 1, fEntryCounter, entryMixReal, fNumberMixed);
          InputEventHandler(0)->FinishEvent();
+         mihi->ResetLoadedEntry();
       }
    }
    AliDebug(AliLog::kDebug + 3, Form("fEntryCounter=%lld fMixEventNumber=%d", fEntryCounter, fNumberMixed));
@@ -456,6 +476,11 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
    Long64_t entryMix = 0, entryMixReal = 0;
    Int_t counter = 0;
    mihi = (AliMixInputHandlerInfo *) fMixTrees.At(0);
+   if (fReadAhead && fDoMixEventGetEntryAuto) {
+      std::vector<Long64_t> entries;
+      for (counter = 0; counter < mixNum && elNum - 2 - counter >= 0; counter++) entries.push_back(el->GetEntry(elNum - 2 - counter));
+      if (!entries.empty()) PrefetchMixEntries(mihi, &entries[0], entries.size());
+   }
    // fills num for main events
    for (counter = 0; counter < mixNum; counter++) {
       fCurrentMixEntry.Reset();
@@ -476,6 +501,7 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
          fNumberMixed++;
          UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, entryMixReal, fNumberMixed);
          InputEventHandler(0)->FinishEvent();
+         mihi->ResetLoadedEntry();
       }
    }
    AliDebug(AliLog::kDebug + 3, Form("fEntryCounter=%lld fMixEventNumber=%d", fEntryCounter, fNumberMixed));
@@ -503,11 +529,110 @@ Bool_t AliMixInputEventHandler::FinishEvent()
    //
    AliDebug(AliLog::kDebug + 5, Form("<-"));
    AliMultiInputEventHandler::FinishEvent();
+   ResetLoadedEntries();
    fEntryCounter++;
    AliDebug(AliLog::kDebug + 5, Form("->"));
    return kTRUE;
 }
 
+//_____________________________________________________________________________
+Bool_t AliMixInputEventHandler::Terminate()
+{
+   //
+   // Terminate() prints read statistics of mixed events
+   //
+   if (fReadAhead) PrintReadStatistics();
+   return AliMultiInputEventHandler::Terminate();
+}
+
+//_____________________________________________________________________________
+void AliMixInputEventHandler::SetReadAhead(Bool_t b, Long64_t cacheSize, Int_t maxOpenFiles, Bool_t parallelUnzip)
+{
+   //
+   // Read-ahead of mixed events (has to be set before analysis starts):
+   //  - upcoming mixed entries are sorted by file and the TTreeCache
+   //    (cacheSize bytes) is restricted to their range, so their clusters
+   //    are read in one go (and unzipped in separate thread if parallelUnzip)
+   //  - files of the last maxOpenFiles partners are kept open per handler
+   //  - entry already loaded in handler is not read again
+   //
+   fReadAhead = b;
+   fReadAheadCacheSize = cacheSize;
+   fReadAheadMaxOpenFiles = maxOpenFiles;
+   fReadAheadParallelUnzip = parallelUnzip;
+}
+
+//_____________________________________________________________________________
+void AliMixInputEventHandler::PrefetchMixEntries(AliMixInputHandlerInfo *mihi, const Long64_t *entries, Int_t n)
+{
+   //
+   // Sorts mixed entries by file and sets cache range of every file
+   //
+   if (!mihi) return;
+   std::map<TString, std::pair<Long64_t, Long64_t> > ranges;
+   for (Int_t i = 0; i < n; i++) {
+      Long64_t entry = entries[i];
+      TChainElement *te = fMixIntupHandlerInfoTmp->GetEntryInTree(entry);
+      if (!te || entry < 0) continue;
+      std::map<TString, std::pair<Long64_t, Long64_t> >::iterator it = ranges.find(te->GetTitle());
+      if (it == ranges.end()) {
+         ranges[te->GetTitle()] = std::make_pair(entry, entry);
+      } else {
+         if (entry < it->second.first) it->second.first = entry;
+         if (entry > it->second.second) it->second.second = entry;
+      }
+   }
+   std::map<TString, std::pair<Long64_t, Long64_t> >::const_iterator it;
+   for (it = ranges.begin(); it != ranges.end(); ++it)
+      mihi->SetEntryRange(it->first.Data(), it->second.first, it->second.second);
+}
+
+//_____________________________________________________________________________
+void AliMixInputEventHandler::ResetLoadedEntries()
+{
+   //
+   // Mixed events were finished, so they have to be read again
+   //
+   for (Int_t i = 0; i < fMixTrees.GetEntries(); i++)
+      ((AliMixInputHandlerInfo *) fMixTrees.At(i))->ResetLoadedEntry();
+}
+
+//_____________________________________________________________________________
+void AliMixInputEventHandler::AddReadStatistics(const AliMixInputHandlerInfo *mihi)
+{
+   //
+   // Adds read statistics of mihi
+   //
+   if (!mihi) return;
+   fStatRequests += mihi->GetNRequests();
+   fStatEntryHits += mihi->GetNEntryHits();
+   fStatFileSwitches += mihi->GetNFileSwitches();
+   fStatFileHits += mihi->GetNFileHits();
+   fStatBytesRead += mihi->GetBytesRead();
+}
+
+//_____________________________________________________________________________
+void AliMixInputEventHandler::PrintReadStatistics() const
+{
+   //
+   // Prints read statistics of mixed events
+   //
+   Long64_t nRequests = fStatRequests, nEntryHits = fStatEntryHits;
+   Long64_t nFileSwitches = fStatFileSwitches, nFileHits = fStatFileHits, bytesRead = fStatBytesRead;
+   const AliMixInputHandlerInfo *mihi = 0;
+   for (Int_t i = 0; i < fMixTrees.GetEntries(); i++) {
+      mihi = (const AliMixInputHandlerInfo *) fMixTrees.At(i);
+      nRequests += mihi->GetNRequests();
+      nEntryHits += mihi->GetNEntryHits();
+      nFileSwitches += mihi->GetNFileSwitches();
+      nFileHits += mihi->GetNFileHits();
+      bytesRead += mihi->GetBytesRead();
+   }
+   AliInfo(Form("Mixed entries requested %lld, already loaded %lld (%.1f %%)", nRequests, nEntryHits, nRequests ? 100. * nEntryHits / nRequests : 0.));
+   AliInfo(Form("File changes %lld, served by open files %lld (%.1f %%)", nFileSwitches, nFileHits, nFileSwitches ? 100. * nFileHits / nFileSwitches : 0.));
+   AliInfo(Form("Bytes read %lld, per mixed event %.0f", bytesRead, nRequests ? (Double_t) bytesRead / nRequests : 0.));
+}
+
 //_____________________________________________________________________________
 void AliMixInputEventHandler::AddInputEventHandler(AliVEventHandler *)
 {
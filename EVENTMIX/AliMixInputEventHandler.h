@@ -36,6 +36,7 @@ public:
    virtual Bool_t  BeginEvent(Long64_t entry);
    virtual Bool_t  GetEntry();
    virtual Bool_t  FinishEvent();
+   virtual Bool_t  Terminate();
 
    // removing default impementation
    virtual void            AddInputEventHandler(AliVEventHandler */*inHandler*/);
@@ -70,6 +71,8 @@ public:
    Bool_t                  IsMixingIfNotEnoughEvents() { return fDoMixIfNotEnoughEvents;}
 
    void                    DoMixEventGetEntryAuto(Bool_t doAuto=kTRUE) { fDoMixEventGetEntryAuto = doAuto; }
+   void                    SetReadAhead(Bool_t b = kTRUE, Long64_t cacheSize = 10000000, Int_t maxOpenFiles = 2, Bool_t parallelUnzip = kTRUE);
+   void                    PrintReadStatistics() const;
 
    Bool_t                  GetEntryMainEvent();
    Bool_t                  GetEntryMixedEvent(Int_t idHandler=0);
@@ -89,6 +92,10 @@ private:
    Bool_t                  fDoMixExtra;            // mix extra events to get enough combinations
    Bool_t                  fDoMixIfNotEnoughEvents;// mix events if they don't have enough events to mix
    Bool_t                  fDoMixEventGetEntryAuto;// flag for preparing mixed events automatically (default on)
+   Bool_t                  fReadAhead;             // flag for read-ahead of mixed events (default off)
+   Long64_t                fReadAheadCacheSize;    // TTreeCache size of mixed event chains
+   Int_t                   fReadAheadMaxOpenFiles; // number of files kept open per mixed input handler
+   Bool_t                  fReadAheadParallelUnzip;// unzip baskets of mixed events in separate thread
 
    // mixing info
    Long64_t fCurrentEntry;       //! current entry number (adds 1 for every event processed on each worker)
@@ -100,17 +107,26 @@ private:
    TEntryList fCurrentMixEntry;    //! array of mix entries currently used (user should touch)
    Long64_t fCurrentEntryMainTree; //! current entry in current tree (main event)
 
+   Long64_t fStatRequests;         //! number of mixed entries requested (finished handler infos)
+   Long64_t fStatEntryHits;        //! number of mixed entries already loaded (finished handler infos)
+   Long64_t fStatFileSwitches;     //! number of file changes (finished handler infos)
+   Long64_t fStatFileHits;         //! number of file changes served by open file (finished handler infos)
+   Long64_t fStatBytesRead;        //! bytes read for mixed events (finished handler infos)
+
    virtual Bool_t          MixStd();
    virtual Bool_t          MixBuffer();
    virtual Bool_t          MixEventsMoreTimesWithOneEvent();
    virtual Bool_t          MixEventsMoreTimesWithBuffer();
 
+   void                    PrefetchMixEntries(AliMixInputHandlerInfo *mihi, const Long64_t *entries, Int_t n);
+   void                    ResetLoadedEntries();
+   void                    AddReadStatistics(const AliMixInputHandlerInfo *mihi);
    void                    UserExecMixAllTasks(Long64_t entryCounter, Int_t idEntryList, Long64_t entryMainReal, Long64_t entryMixReal, Int_t numMixed);
 
    AliMixInputEventHandler(const AliMixInputEventHandler &handler);
    AliMixInputEventHandler &operator=(const AliMixInputEventHandler &handler);
 
-   ClassDef(AliMixInputEventHandler, 5)
+   ClassDef(AliMixInputEventHandler, 6)
 };
 
 #endif
@@ -24,11 +24,23 @@ AliMixInputHandlerInfo::AliMixInputHandlerInfo(const char *name, const char *tit
    fChain(0),
    fChainEntriesArray(),
    fZeroEntryNumber(0),
-   fNeedNotify(kFALSE)
+   fNeedNotify(kFALSE),
+   fReadAhead(kFALSE),
+   fMaxOpenFiles(1),
+   fCacheSize(0),
+   fParallelUnzip(kFALSE),
+   fOpenChains(),
+   fLoadedEntry(-1),
+   fNRequests(0),
+   fNEntryHits(0),
+   fNFileSwitches(0),
+   fNFileHits(0),
+   fBytesRead(0)
 {
    //
    // Default constructor.
    //
+   fOpenChains.SetOwner(kTRUE);
 }
 //_____________________________________________________________________________
 AliMixInputHandlerInfo::~AliMixInputHandlerInfo()
@@ -37,6 +49,7 @@ AliMixInputHandlerInfo::~AliMixInputHandlerInfo()
    // Destructor
    //
    if (fChain) delete fChain;
+   fOpenChains.Delete();
 }
 
 //_____________________________________________________________________________
@@ -125,36 +138,48 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
       AliDebug(AliLog::kDebug + 5, "-> te is null");
       return;
    }
+   Long64_t bytesRead = TFile::GetFileBytesRead();
    if (entry < 0) {
       AliDebug(AliLog::kDebug, Form("We are creating new chain from file %s ...", te->GetTitle()));
       if (!fChain) {
-         fChain = new TChain(te->GetName());
-         fChain->AddFile(te->GetTitle());
-         fChain->GetEntry(0);
+         fChain = NewChain(te);
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
       }
       fNeedNotify = kTRUE;
+      fLoadedEntry = -1;
+      fBytesRead += TFile::GetFileBytesRead() - bytesRead;
       AliDebug(AliLog::kDebug + 5, "->");
       return;
    }
+   fNRequests++;
    if (fChain) {
       AliDebug(AliLog::kDebug, Form("Filename is %s", fChain->GetTree()->GetCurrentFile()->GetName()));
       TString fn = fChain->GetTree()->GetCurrentFile()->GetName();
       if (fn.CompareTo(te->GetTitle())) {
          AliDebug(AliLog::kDebug, Form("Filename %s is NOT same ...", te->GetTitle()));
          AliDebug(AliLog::kDebug, Form("We are changing to file %s ...", te->GetTitle()));
-         // change file
-         delete fChain;
-         fChain = new TChain(te->GetName());
-         fChain->AddFile(te->GetTitle());
-         fChain->GetEntry(0);
+         // change file (reusing it when it is still open)
+         fNFileSwitches++;
+         TChain *chain = TakeOpenChain(te->GetTitle());
+         KeepOpenChain(fChain);
+         if (chain) {
+            AliDebug(AliLog::kDebug, Form("File %s is still open ...", te->GetTitle()));
+            fNFileHits++;
+            fChain = chain;
+         } else {
+            fChain = NewChain(te);
+         }
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
          eh->Notify(te->GetTitle());
          fChain->GetEntry(entry);
          eh->BeginEvent(entry);
          fNeedNotify = kFALSE;
+      } else if (fReadAhead && !fNeedNotify && entry == fLoadedEntry) {
+         // entry was already read and not finished yet (e.g. GetEntryMixedEvent() after auto GetEntry)
+         AliDebug(AliLog::kDebug, Form("Entry %lld is already loaded ...", entry));
+         fNEntryHits++;
       } else {
          AliDebug(AliLog::kDebug, Form("We are reusing file %s ...", te->GetTitle()));
          if (fNeedNotify) eh->Notify(te->GetTitle());
@@ -164,13 +189,112 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          eh->BeginEvent(entry);
          // file is in tree fChain already
       }
+      fLoadedEntry = entry;
    }
+   fBytesRead += TFile::GetFileBytesRead() - bytesRead;
    AliDebug(AliLog::kDebug, Form("We are USING file %s ...", te->GetTitle()));
    AliDebug(AliLog::kDebug, Form("We are USING file from fChain->GetTree() %s ...", fChain->GetTree()->GetCurrentFile()->GetName()));
    // here we have correct chain with 1 tree only
    AliDebug(AliLog::kDebug + 5, "->");
 }
 
+//_____________________________________________________________________________
+void AliMixInputHandlerInfo::SetReadAhead(Int_t maxOpenFiles, Long64_t cacheSize, Bool_t parallelUnzip)
+{
+   //
+   // Enables read-ahead of mixed events. Files of the last maxOpenFiles
+   // partners stay open, baskets are read via TTreeCache of cacheSize bytes
+   // and unzipped in a separate thread, if parallelUnzip is set.
+   // Has to be called before first PrepareEntry()
+   //
+   fReadAhead = kTRUE;
+   fMaxOpenFiles = maxOpenFiles > 0 ? maxOpenFiles : 1;
+   fCacheSize = cacheSize > 0 ? cacheSize : 0;
+   fParallelUnzip = parallelUnzip;
+}
+
+//_____________________________________________________________________________
+void AliMixInputHandlerInfo::SetEntryRange(const char *fileName, Long64_t first, Long64_t last)
+{
+   //
+   // Restricts TTreeCache of the chain of file fileName to the entries
+   // [first,last], such that the clusters of the upcoming mixed events
+   // are read in one go. Files which are not open are skipped.
+   //
+   if (!fReadAhead || fCacheSize <= 0) return;
+   TChain *chain = 0;
+   if (fChain && fChain->GetTree() && !TString(fChain->GetTree()->GetCurrentFile()->GetName()).CompareTo(fileName)) {
+      chain = fChain;
+   } else {
+      TIter next(&fOpenChains);
+      TChain *c = 0;
+      while ((c = (TChain *) next())) {
+         if (!TString(c->GetTree()->GetCurrentFile()->GetName()).CompareTo(fileName)) {
+            chain = c;
+            break;
+         }
+      }
+   }
+   if (!chain) return;
+   AliDebug(AliLog::kDebug + 1, Form("Cache range for %s is [%lld,%lld]", fileName, first, last));
+   chain->SetCacheEntryRange(first, last + 1);
+}
+
+//_____________________________________________________________________________
+TChain *AliMixInputHandlerInfo::NewChain(TChainElement *te)
+{
+   //
+   // Creates chain with file of te and loads its tree
+   //
+   TChain *chain = new TChain(te->GetName());
+   chain->AddFile(te->GetTitle());
+   if (fReadAhead && fCacheSize > 0) {
+      if (fParallelUnzip) chain->SetParallelUnzip(kTRUE);
+      chain->SetCacheSize(fCacheSize);
+   }
+   chain->GetEntry(0);
+   if (fReadAhead && fCacheSize > 0) chain->AddBranchToCache("*", kTRUE);
+   return chain;
+}
+
+//_____________________________________________________________________________
+TChain *AliMixInputHandlerInfo::TakeOpenChain(const char *fileName)
+{
+   //
+   // Returns chain of file fileName if it is still open and removes
+   // it from list of open chains (caller is owner)
+   //
+   TIter next(&fOpenChains);
+   TChain *chain = 0;
+   while ((chain = (TChain *) next())) {
+      if (!TString(chain->GetTree()->GetCurrentFile()->GetName()).CompareTo(fileName)) {
+         fOpenChains.Remove(chain);
+         return chain;
+      }
+   }
+   return 0;
+}
+
+//_____________________________________________________________________________
+void AliMixInputHandlerInfo::KeepOpenChain(TChain *chain)
+{
+   //
+   // Keeps chain open (most recent first) up to fMaxOpenFiles-1 chains
+   // and deletes the least recently used ones
+   //
+   if (!chain) return;
+   if (!fReadAhead || fMaxOpenFiles <= 1) {
+      delete chain;
+      return;
+   }
+   fOpenChains.AddFirst(chain);
+   while (fOpenChains.GetEntries() > fMaxOpenFiles - 1) {
+      TObject *last = fOpenChains.Last();
+      fOpenChains.Remove(last);
+      delete last;
+   }
+}
+
 //_____________________________________________________________________________
 Long64_t AliMixInputHandlerInfo::GetEntries()
 {
@@ -10,6 +10,7 @@
 #ifndef ALIMIXINPUTHANDLERINFO_H
 #define ALIMIXINPUTHANDLERINFO_H
 #include <TArrayI.h>
+#include <TList.h>
 #include <TNamed.h>
 
 class TTree;
@@ -33,16 +34,44 @@ public:
    TChainElement *GetEntryInTree(Long64_t &entry);
    Long64_t      GetEntries();
 
+   // read-ahead of mixed events
+   void SetReadAhead(Int_t maxOpenFiles, Long64_t cacheSize, Bool_t parallelUnzip);
+   void SetEntryRange(const char *fileName, Long64_t first, Long64_t last);
+   void ResetLoadedEntry() { fLoadedEntry = -1; }
+
+   Long64_t GetNRequests() const { return fNRequests; }
+   Long64_t GetNEntryHits() const { return fNEntryHits; }
+   Long64_t GetNFileSwitches() const { return fNFileSwitches; }
+   Long64_t GetNFileHits() const { return fNFileHits; }
+   Long64_t GetBytesRead() const { return fBytesRead; }
+
 private:
    TChain    *fChain;              // current chain
    TArrayI   fChainEntriesArray;   // array of entries of every chaing
    Long64_t  fZeroEntryNumber;     // zero entry number (will be used when we will delete not needed chains)
    Bool_t    fNeedNotify;          // flag if Notify is needed for current input handler
 
+   Bool_t    fReadAhead;           // flag if read-ahead is used
+   Int_t     fMaxOpenFiles;        // number of files kept open (current one included)
+   Long64_t  fCacheSize;           // size of TTreeCache of chain (0 = no cache)
+   Bool_t    fParallelUnzip;       // flag if baskets are unzipped in a separate thread
+   TList     fOpenChains;          //! chains of recently used files (most recent first)
+   Long64_t  fLoadedEntry;         //! entry currently loaded in input handler (-1 if none)
+
+   Long64_t  fNRequests;           //! number of requested entries
+   Long64_t  fNEntryHits;          //! number of requested entries already loaded
+   Long64_t  fNFileSwitches;       //! number of file changes
+   Long64_t  fNFileHits;           //! number of file changes served by an open file
+   Long64_t  fBytesRead;           //! bytes read from files
+
+   TChain   *NewChain(TChainElement *te);
+   TChain   *TakeOpenChain(const char *fileName);
+   void      KeepOpenChain(TChain *chain);
+
    AliMixInputHandlerInfo(const AliMixInputHandlerInfo &handler);
    AliMixInputHandlerInfo &operator=(const AliMixInputHandlerInfo &handler);
 
-   ClassDef(AliMixInputHandlerInfo, 1); // Mix Input Handler info
+   ClassDef(AliMixInputHandlerInfo, 2); // Mix Input Handler info
 };
 
 #endif // ALIMIXINPUTHANDLERINFO_H
@@ -116,9 +116,7 @@ AliEventCuts::AliEventCuts(bool saveplots) : TList(),
   fTPCvsAll{nullptr},
   fMultvsV0M{nullptr},
   fTPCvsTrkl{nullptr},
-  fVZEROvsTPCout{nullptr},
-  fFB32trackCuts{nullptr},
-  fTPConlyCuts{nullptr}
+  fVZEROvsTPCout{nullptr}
 {
   SetName("AliEventCuts");
   SetOwner(true);
@@ -126,8 +124,6 @@ AliEventCuts::AliEventCuts(bool saveplots) : TList(),
 
 AliEventCuts::~AliEventCuts() { 
   delete fMultiplicityV0McorrCut; 
-  delete fFB32trackCuts;
-  delete fFB32trackCuts;
 }
 
 bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
@@ -229,7 +225,8 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
     else if (ntrkl < 50) fSPDpileupMinContributors = 4;
     else fSPDpileupMinContributors = 5;
   }
-  if ((!usePileUpSPD || !ev->IsPileupFromSPD(fSPDpileupMinContributors,fSPDpileupMinZdist,fSPDpileupNsigmaZdist,fSPDpileupNsigmaDiamXY,fSPDpileupNsigmaDiamZ)) &&
+  AliEventCutsContainer &store = AliEventCutsContainer::GetEventStore(ev);
+  if ((!usePileUpSPD || !store.IsPileupFromSPD(ev,fSPDpileupMinContributors,fSPDpileupMinZdist,fSPDpileupNsigmaZdist,fSPDpileupNsigmaDiamXY,fSPDpileupNsigmaDiamZ)) &&
       (!fTrackletBGcut || !fUtils.IsSPDClusterVsTrackletBG(ev)) &&
       (!usePileUpMV || !fUtils.IsPileUpMV(ev)))
     fFlag |= BIT(kPileUp);
@@ -541,20 +538,72 @@ string AliEventCuts::GetCentralityEstimator (unsigned int estimator) const {
 
 
 void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev) {
-  AliEventCutsContainer* tmp_cont = static_cast<AliEventCutsContainer*>(ev->FindListObject("AliEventCutsContainer"));
-  if (tmp_cont) {
-    unsigned long evid = ((unsigned long)(ev->GetBunchCrossNumber()) << 32) + ev->GetTimeStamp();
-    fNewEvent = (tmp_cont->fEventId != evid);
-    tmp_cont->fEventId = evid;
-
-    if (!fNewEvent) {
-      fContainer = *tmp_cont;
-      return;
-    }
-  } else {
-    tmp_cont = new AliEventCutsContainer;
-    ev->AddObject(tmp_cont);
+  AliEventCutsContainer &store = AliEventCutsContainer::GetEventStore(ev);
+  fNewEvent = store.FillMultiplicity(ev);
+  fContainer = store;
+}
+
+/// Shared store of the current event: it is cleared when the event changes
+///
+AliEventCutsContainer& AliEventCutsContainer::GetEventStore(const AliVEvent *ev) {
+  static AliEventCutsContainer store;
+  if (!store.IsCurrentEvent(ev)) store.SetCurrentEvent(ev);
+  return store;
+}
+
+/// The event is identified by the event object, the entry of the analysis manager and the event header:
+/// the header alone is not enough in MC, where the bunch crossing, orbit and time stamp are not set
+///
+bool AliEventCutsContainer::IsCurrentEvent(const AliVEvent *ev) const {
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  const AliVHeader *header = ev->GetHeader();
+  return fEvent == ev &&
+    fEntry == (mgr ? mgr->GetCurrentEntry() : -1) &&
+    fRunNumber == ev->GetRunNumber() &&
+    fEventId == (header ? header->GetEventIdAsLong() : 0u) &&
+    fTimeStamp == ev->GetTimeStamp() &&
+    fNTracks == ev->GetNumberOfTracks();
+}
+
+void AliEventCutsContainer::SetCurrentEvent(const AliVEvent *ev) {
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  const AliVHeader *header = ev->GetHeader();
+  fEvent = ev;
+  fEntry = mgr ? mgr->GetCurrentEntry() : -1;
+  fRunNumber = ev->GetRunNumber();
+  fEventId = header ? header->GetEventIdAsLong() : 0u;
+  fTimeStamp = ev->GetTimeStamp();
+  fNTracks = ev->GetNumberOfTracks();
+  fMultESD = -1;
+  fMultTrkFB32 = -1;
+  fMultTrkFB32Acc = -1;
+  fMultTrkFB32TOF = -1;
+  fMultTrkTPC = -1;
+  fMultTrkTPCout = -1;
+  fMultVZERO = -1.;
+  fMultiplicityFilled = false;
+  fSPDpileUp.clear();
+}
+
+/// SPD pile-up decision, evaluated once per event for each set of parameters
+///
+bool AliEventCutsContainer::IsPileupFromSPD(const AliVEvent *ev, int minContributors, double minZdist, double nSigmaZdist, double nSigmaDiamXY, double nSigmaDiamZ) {
+  for (const SPDpileUp_t &pu : fSPDpileUp) {
+    if (pu.fMinContributors == minContributors && pu.fMinZdist == minZdist && pu.fNsigmaZdist == nSigmaZdist &&
+        pu.fNsigmaDiamXY == nSigmaDiamXY && pu.fNsigmaDiamZ == nSigmaDiamZ)
+      return pu.fPileUp;
   }
+  const bool pileUp = ev->IsPileupFromSPD(minContributors,minZdist,nSigmaZdist,nSigmaDiamXY,nSigmaDiamZ);
+  fSPDpileUp.push_back({minContributors,minZdist,nSigmaZdist,nSigmaDiamXY,nSigmaDiamZ,pileUp});
+  return pileUp;
+}
+
+/// All the multiplicity estimators used by the AliEventCuts configurations, filled in one pass over the tracks.
+/// The ESD track cuts are the same for all the configurations and are shared as well.
+/// Returns false if the estimators were already filled for this event.
+///
+bool AliEventCutsContainer::FillMultiplicity(AliVEvent *ev) {
+  if (fMultiplicityFilled) return false;
 
   bool isAOD = false;
   if (dynamic_cast<AliAODEvent*>(ev))
@@ -562,50 +611,55 @@ void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev) {
   else if (!dynamic_cast<AliESDEvent*>(ev))
     AliFatal("I don't find the AOD event nor the ESD one, aborting.");
 
-  if (!fFB32trackCuts) fFB32trackCuts = AliESDtrackCuts::GetStandardITSTPCTrackCuts2011();
-  if (!fTPConlyCuts) fTPConlyCuts = AliESDtrackCuts::GetStandardTPCOnlyTrackCuts();
+  /// Cuts corresponding to FB32 and to the standalone TPC cuts in the ESD, kept until the end of the process
+  static AliESDtrackCuts *fb32TrackCuts = AliESDtrackCuts::GetStandardITSTPCTrackCuts2011();
+  static AliESDtrackCuts *tpcOnlyCuts = AliESDtrackCuts::GetStandardTPCOnlyTrackCuts();
 
   const int nTracks = ev->GetNumberOfTracks();
-  tmp_cont->fMultESD = (isAOD) ? ((AliAODHeader*)ev->GetHeader())->GetNumberOfESDTracks() : dynamic_cast<AliESDEvent*>(ev)->GetNumberOfTracks();
-  tmp_cont->fMultTrkFB32 = 0;
-  tmp_cont->fMultTrkFB32Acc = 0;
-  tmp_cont->fMultTrkFB32TOF = 0;
-  tmp_cont->fMultTrkTPC = 0;
-  tmp_cont->fMultTrkTPCout = 0;
+  fMultESD = (isAOD) ? ((AliAODHeader*)ev->GetHeader())->GetNumberOfESDTracks() : nTracks;
+  fMultTrkFB32 = 0;
+  fMultTrkFB32Acc = 0;
+  fMultTrkFB32TOF = 0;
+  fMultTrkTPC = 0;
+  fMultTrkTPCout = 0;
   for (int it = 0; it < nTracks; it++) {
     if (isAOD) {
       AliAODTrack* trk = (AliAODTrack*)ev->GetTrack(it);
       if (!trk) continue;
       if ((trk->GetStatus() & AliESDtrack::kTPCout) &&
-          trk->GetID() > 0) tmp_cont->fMultTrkTPCout++;
+          trk->GetID() > 0) fMultTrkTPCout++;
       if (trk->TestFilterBit(32)) {
-        tmp_cont->fMultTrkFB32++;
+        fMultTrkFB32++;
         if ( TMath::Abs(trk->GetTOFsignalDz()) <= 10. && trk->GetTOFsignal() >= 12000. && trk->GetTOFsignal() <= 25000.)
-          tmp_cont->fMultTrkFB32TOF++;
+          fMultTrkFB32TOF++;
         if ((fabs(trk->Eta()) < 0.8) && (trk->GetTPCNcls() >= 70) && (trk->Pt() >= 0.2) && (trk->Pt() < 50))
-          tmp_cont->fMultTrkFB32Acc++;
+          fMultTrkFB32Acc++;
       }
       if (trk->TestFilterBit(128))
-        tmp_cont->fMultTrkTPC++;
+        fMultTrkTPC++;
     } else {
       AliESDtrack* esdTrack = (AliESDtrack*)ev->GetTrack(it);
       if (!esdTrack) continue;
 
-      if (esdTrack->GetStatus() & AliESDtrack::kTPCout) tmp_cont->fMultTrkTPCout++;
+      const unsigned long status = esdTrack->GetStatus();
+      if (status & AliESDtrack::kTPCout) fMultTrkTPCout++;
 
-      if (fFB32trackCuts->AcceptTrack(esdTrack)) {
-        tmp_cont->fMultTrkFB32++;
+      /// The FB32 cuts require the ITS and TPC refit: check them before running the full track cuts
+      if ((status & AliESDtrack::kITSrefit) && (status & AliESDtrack::kTPCrefit) && fb32TrackCuts->AcceptTrack(esdTrack)) {
+        fMultTrkFB32++;
         if (TMath::Abs(esdTrack->GetTOFsignalDz()) <= 10 && esdTrack->GetTOFsignal() >= 12000 && esdTrack->GetTOFsignal() <= 25000)
-          tmp_cont->fMultTrkFB32TOF++;
+          fMultTrkFB32TOF++;
 
         if ((TMath::Abs(esdTrack->Eta()) < 0.8) && (esdTrack->GetTPCNcls() > 70) && (esdTrack->Pt() > 0.2) && (esdTrack->Pt() < 50))
-          tmp_cont->fMultTrkFB32Acc++;
+          fMultTrkFB32Acc++;
       }
 
-      /// TPC only tracks, with the same cuts of the filter bit 128
+      /// TPC only tracks, with the same cuts of the filter bit 128. Tracks without TPC inner parameters
+      /// are rejected by FillTPCOnlyTrack, skip them before building the TPC only track.
+      if (!esdTrack->GetTPCInnerParam()) continue;
       AliESDtrack tpcParam;
       if (!esdTrack->FillTPCOnlyTrack(tpcParam)) continue;
-      if (!fTPConlyCuts->AcceptTrack(&tpcParam)) continue;
+      if (!tpcOnlyCuts->AcceptTrack(&tpcParam)) continue;
       if (tpcParam.Pt() > 0.) {
         // only constrain tracks above threshold
         AliExternalTrackParam exParam;
@@ -614,16 +668,17 @@ void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev) {
         relate = tpcParam.RelateToVertexTPC((AliESDVertex*)ev->GetPrimaryVertexSPD(),ev->GetMagneticField(),kVeryBig, &exParam);
         if(!relate) continue;
       }
-      tmp_cont->fMultTrkTPC++;
+      fMultTrkTPC++;
     }
   }
   AliVVZERO *vzero = (AliVVZERO*)ev->GetVZEROData();
   if(vzero) {
-    tmp_cont->fMultVZERO = 0.;
+    fMultVZERO = 0.;
     for(int ich=0; ich < 64; ich++)
-      tmp_cont->fMultVZERO += vzero->GetMultiplicity(ich);
+      fMultVZERO += vzero->GetMultiplicity(ich);
   }
-  fContainer = *tmp_cont;
+  fMultiplicityFilled = true;
+  return true;
 }
 
 void AliEventCuts::SetupRun1pp() {
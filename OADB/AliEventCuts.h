@@ -15,13 +15,18 @@
 #include "AliTimeRangeMasking.h"
 #include "AliTimeRangeCut.h"
 
-class AliESDtrackCuts;
 class TList;
 class TH1D;
 class TH1I;
 class TH2D;
 class TH2F;
 
+/// Track multiplicity estimators and pile-up decisions of the current event.
+///
+/// A single typed store (GetEventStore()) is shared by all the AliEventCuts of the process,
+/// whatever their configuration: the multiplicity estimators are computed by one pass over
+/// the tracks the first time an AliEventCuts needs them for a given event, and the SPD pile-up
+/// decision is kept for each set of pile-up parameters requested in the event.
 class AliEventCutsContainer : public TNamed {
   public:
     AliEventCutsContainer() : TNamed("AliEventCutsContainer","AliEventCutsContainer"),
@@ -32,9 +37,21 @@ class AliEventCutsContainer : public TNamed {
     fMultTrkFB32TOF(-1),
     fMultTrkTPC(-1),
     fMultTrkTPCout(-1),
-    fMultVZERO(-1.) {}
-
-    unsigned long fEventId;
+    fMultVZERO(-1.),
+    fEvent(nullptr),
+    fEntry(-1),
+    fRunNumber(-1),
+    fTimeStamp(0u),
+    fNTracks(-1),
+    fMultiplicityFilled(false),
+    fSPDpileUp() {}
+
+    static AliEventCutsContainer& GetEventStore(const AliVEvent *ev);
+    bool IsCurrentEvent(const AliVEvent *ev) const;
+    bool FillMultiplicity(AliVEvent *ev);
+    bool IsPileupFromSPD(const AliVEvent *ev, int minContributors, double minZdist, double nSigmaZdist, double nSigmaDiamXY, double nSigmaDiamZ);
+
+    unsigned long fEventId;            ///< Event identifier (bunch crossing, orbit and period)
     int fMultESD;
     int fMultTrkFB32;
     int fMultTrkFB32Acc;
@@ -42,7 +59,29 @@ class AliEventCutsContainer : public TNamed {
     int fMultTrkTPC;
     int fMultTrkTPCout;
     double fMultVZERO;
-  ClassDef(AliEventCutsContainer,2)
+
+    const AliVEvent *fEvent;           //!<! Event object of the stored values
+    long long fEntry;                  ///< Entry of the analysis manager, -1 without analysis manager
+    int fRunNumber;                    ///< Run number
+    unsigned int fTimeStamp;           ///< Event time stamp
+    int fNTracks;                      ///< Number of tracks in the event object
+    bool fMultiplicityFilled;          ///< The multiplicity estimators are filled for this event
+
+    /// SPD pile-up decision for a set of pile-up parameters
+    struct SPDpileUp_t {
+      int    fMinContributors;
+      double fMinZdist;
+      double fNsigmaZdist;
+      double fNsigmaDiamXY;
+      double fNsigmaDiamZ;
+      bool   fPileUp;
+    };
+    std::vector<SPDpileUp_t> fSPDpileUp; //!<! SPD pile-up decisions of the current event
+
+  private:
+    void SetCurrentEvent(const AliVEvent *ev);
+
+  ClassDef(AliEventCutsContainer,3)
 };
 
 class AliEventCuts : public TList {
@@ -175,7 +214,7 @@ class AliEventCuts : public TList {
     unsigned long fTriggerMask;                   ///< Trigger mask
     std::vector<std::string> fTriggerClasses;     ///< Trigger classes
   
-    AliEventCutsContainer fContainer;       //!<! Local copy of the event cuts container (safe against user changes)
+    AliEventCutsContainer fContainer;       //!<! Local copy of the shared event store (safe against user changes)
     const std::string  fkLabels[2];                    ///< Histograms labels (raw/selected)
 
   private:
@@ -225,10 +264,7 @@ class AliEventCuts : public TList {
     TH2F* fTPCvsTrkl[2];           //!<!
     TH2F* fVZEROvsTPCout[2];       //!<!
 
-    AliESDtrackCuts* fFB32trackCuts; //!<! Cuts corresponding to FB32 in the ESD (used only for correlations cuts in ESDs)
-    AliESDtrackCuts* fTPConlyCuts;   //!<! Cuts corresponding to the standalone TPC cuts in the ESDs (used only for correlations cuts in ESDs)
-
-    ClassDef(AliEventCuts, 12)
+    ClassDef(AliEventCuts, 13)
 };
 
 template<typename F> F AliEventCuts::PolN(F x,F* coef, int n) {
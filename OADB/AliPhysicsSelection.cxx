@@ -65,6 +65,12 @@
 //   Origin: Jan Fiete Grosse-Oetringhaus, CERN 
 //           Michele Floris, CERN
 //-------------------------------------------------------------------------
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
 #include <vector>
 
 #include <Riostream.h>
@@ -111,6 +117,194 @@
 
 class StringToRegexp : public std::map<std::string, TPRegexp> {};
 
+//______________________________________________________________________________
+// Trigger logic string compiled into a postfix program. It evaluates the logic
+// like the TFormula it replaces: all values are doubles, !, &&, || and the
+// comparisons give 0 or 1, and a division by zero gives 0. Trigger bits are
+// referenced by their position in GetBitNames(). Logic strings which cannot be
+// compiled are left to the TFormula.
+class AliTriggerLogicProgram {
+public:
+  enum Op_t { kBit, kConst, kNot, kNeg, kMul, kDiv, kAdd, kSub,
+              kLess, kLessEqual, kGreater, kGreaterEqual, kEqual, kNotEqual, kAnd, kOr };
+  struct Instruction_t {
+    Op_t     fOp;    // operation
+    Int_t    fBit;   // bit index for kBit
+    Double_t fConst; // value for kConst
+  };
+  enum { kMaxDepth = 64 };
+
+  AliTriggerLogicProgram() : fCode(), fBitNames(), fBits(), fValid(kFALSE), fText(0), fPos(0) {}
+
+  Bool_t Compile(const char* logic) {
+    fCode.clear();
+    fBitNames.clear();
+    fText = logic;
+    fPos = 0;
+    fValid = ParseOr() && (SkipSpaces(), fText[fPos] == '\0') && MaxDepth() <= kMaxDepth;
+    fText = 0;
+    if (!fValid) { fCode.clear(); fBitNames.clear(); }
+    return fValid;
+  }
+
+  Double_t Evaluate(const Double_t* bits) const {
+    Double_t stack[kMaxDepth];
+    Int_t n = 0;
+    for (const Instruction_t& ins : fCode) {
+      switch (ins.fOp) {
+        case kBit:   stack[n++] = (Int_t) bits[ins.fBit]; break;
+        case kConst: stack[n++] = ins.fConst; break;
+        case kNot:   stack[n-1] = (stack[n-1] == 0) ? 1 : 0; break;
+        case kNeg:   stack[n-1] = -stack[n-1]; break;
+        default: {
+          Double_t b = stack[--n];
+          Double_t& a = stack[n-1];
+          switch (ins.fOp) {
+            case kMul:          a = a * b; break;
+            case kDiv:          a = (b == 0) ? 0 : a / b; break;
+            case kAdd:          a = a + b; break;
+            case kSub:          a = a - b; break;
+            case kLess:         a = (a <  b) ? 1 : 0; break;
+            case kLessEqual:    a = (a <= b) ? 1 : 0; break;
+            case kGreater:      a = (a >  b) ? 1 : 0; break;
+            case kGreaterEqual: a = (a >= b) ? 1 : 0; break;
+            case kEqual:        a = (a == b) ? 1 : 0; break;
+            case kNotEqual:     a = (a != b) ? 1 : 0; break;
+            case kAnd:          a = (a != 0 && b != 0) ? 1 : 0; break;
+            case kOr:           a = (a != 0 || b != 0) ? 1 : 0; break;
+            default: break;
+          }
+        }
+      }
+    }
+    return n > 0 ? stack[n-1] : 0;
+  }
+
+  Bool_t IsValid() const { return fValid; }
+  const std::vector<std::string>& GetBitNames() const { return fBitNames; }
+  const std::vector<AliTriggerAnalysis::Trigger>& GetBits() const { return fBits; }
+  void AddBit(AliTriggerAnalysis::Trigger bit) { fBits.push_back(bit); }
+
+private:
+  void SkipSpaces() { while (fText[fPos] == ' ' || fText[fPos] == '\t') fPos++; }
+  Bool_t Accept(const char* token) {
+    SkipSpaces();
+    size_t len = strlen(token);
+    if (strncmp(fText + fPos, token, len) != 0) return kFALSE;
+    // do not take the first character of <= >= == != for < > = !
+    if (len == 1 && (token[0] == '<' || token[0] == '>' || token[0] == '!') && fText[fPos+1] == '=') return kFALSE;
+    fPos += len;
+    return kTRUE;
+  }
+  void Emit(Op_t op, Int_t bit = -1, Double_t value = 0) { Instruction_t ins = {op, bit, value}; fCode.push_back(ins); }
+
+  Bool_t ParseOr() {
+    if (!ParseAnd()) return kFALSE;
+    while (Accept("||")) { if (!ParseAnd()) return kFALSE; Emit(kOr); }
+    return kTRUE;
+  }
+  Bool_t ParseAnd() {
+    if (!ParseEquality()) return kFALSE;
+    while (Accept("&&")) { if (!ParseEquality()) return kFALSE; Emit(kAnd); }
+    return kTRUE;
+  }
+  Bool_t ParseEquality() {
+    if (!ParseRelation()) return kFALSE;
+    while (kTRUE) {
+      Op_t op;
+      if      (Accept("==")) op = kEqual;
+      else if (Accept("!=")) op = kNotEqual;
+      else return kTRUE;
+      if (!ParseRelation()) return kFALSE;
+      Emit(op);
+    }
+  }
+  Bool_t ParseRelation() {
+    if (!ParseSum()) return kFALSE;
+    while (kTRUE) {
+      Op_t op;
+      if      (Accept("<=")) op = kLessEqual;
+      else if (Accept(">=")) op = kGreaterEqual;
+      else if (Accept("<"))  op = kLess;
+      else if (Accept(">"))  op = kGreater;
+      else return kTRUE;
+      if (!ParseSum()) return kFALSE;
+      Emit(op);
+    }
+  }
+  Bool_t ParseSum() {
+    if (!ParseProduct()) return kFALSE;
+    while (kTRUE) {
+      Op_t op;
+      if      (Accept("+")) op = kAdd;
+      else if (Accept("-")) op = kSub;
+      else return kTRUE;
+      if (!ParseProduct()) return kFALSE;
+      Emit(op);
+    }
+  }
+  Bool_t ParseProduct() {
+    if (!ParseUnary()) return kFALSE;
+    while (kTRUE) {
+      Op_t op;
+      if      (Accept("*")) op = kMul;
+      else if (Accept("/")) op = kDiv;
+      else return kTRUE;
+      if (!ParseUnary()) return kFALSE;
+      Emit(op);
+    }
+  }
+  Bool_t ParseUnary() {
+    if (Accept("!")) { if (!ParseUnary()) return kFALSE; Emit(kNot); return kTRUE; }
+    if (Accept("-")) { if (!ParseUnary()) return kFALSE; Emit(kNeg); return kTRUE; }
+    if (Accept("+")) return ParseUnary();
+    return ParsePrimary();
+  }
+  Bool_t ParsePrimary() {
+    SkipSpaces();
+    if (Accept("(")) return ParseOr() && Accept(")");
+    const char* begin = fText + fPos;
+    if (isalpha(*begin)) {
+      // same token definition as the TFormula path: [[:alpha:]][[:alnum:]]*
+      Int_t len = 1;
+      while (isalnum(begin[len])) len++;
+      std::string name(begin, len);
+      fPos += len;
+      Int_t bit = std::find(fBitNames.begin(), fBitNames.end(), name) - fBitNames.begin();
+      if (bit == (Int_t) fBitNames.size()) fBitNames.push_back(name);
+      Emit(kBit, bit);
+      return kTRUE;
+    }
+    if (isdigit(*begin) || *begin == '.') {
+      char* end = 0;
+      Double_t value = strtod(begin, &end);
+      if (end == begin) return kFALSE;
+      fPos += end - begin;
+      Emit(kConst, -1, value);
+      return kTRUE;
+    }
+    return kFALSE;
+  }
+  Int_t MaxDepth() const {
+    Int_t n = 0, max = 0;
+    for (const Instruction_t& ins : fCode) {
+      if (ins.fOp == kBit || ins.fOp == kConst) n++;
+      else if (ins.fOp != kNot && ins.fOp != kNeg) n--;
+      if (n > max) max = n;
+    }
+    return max;
+  }
+
+  std::vector<Instruction_t> fCode;                 // postfix program
+  std::vector<std::string> fBitNames;               // trigger names, in the order of the bit indices
+  std::vector<AliTriggerAnalysis::Trigger> fBits;   // trigger bits, resolved by AliPhysicsSelection
+  Bool_t fValid;                                    // the logic was compiled
+  const char* fText;                                // logic string being compiled
+  Int_t fPos;                                       // position in fText
+};
+
+class StringToTriggerProgram : public std::map<std::string, AliTriggerLogicProgram> {};
+
 ClassImp(AliPhysicsSelection)
 
 AliPhysicsSelection::AliPhysicsSelection() :
@@ -123,6 +317,7 @@ fIsPP(kFALSE),
 fReadOCDB(kFALSE),
 fUseBXNumbers(0),
 fUsingCustomClasses(0),
+fUseCompiledTriggerLogic(kTRUE),
 fCollTrigClasses(),
 fBGTrigClasses(),
 fTriggerAnalysis(),
@@ -132,7 +327,12 @@ fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
 fTriggerToFormula(new StringToFormula()),
-fTriggerToRegexp(new StringToRegexp())
+fTriggerToRegexp(new StringToRegexp()),
+fTriggerToProgram(new StringToTriggerProgram()),
+fTriggerBitValues(),
+fTriggerMemo(2*AliTriggerAnalysis::kStartOfFlags, 0),
+fTriggerMemoEvent(2*AliTriggerAnalysis::kStartOfFlags, 0),
+fTriggerMemoCounter(0)
 {
   // constructor
   fCollTrigClasses.SetOwner(1);
@@ -153,6 +353,7 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fReadOCDB(kFALSE),
  fUseBXNumbers(0),
  fUsingCustomClasses(0),
+ fUseCompiledTriggerLogic(kTRUE),
  fCollTrigClasses(),
  fBGTrigClasses(),
  fTriggerAnalysis(),
@@ -162,7 +363,12 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fFillOADB(0),
  fTriggerOADB(0),
  fTriggerToFormula(new StringToFormula()),
- fTriggerToRegexp(new StringToRegexp())
+ fTriggerToRegexp(new StringToRegexp()),
+ fTriggerToProgram(new StringToTriggerProgram()),
+ fTriggerBitValues(),
+ fTriggerMemo(2*AliTriggerAnalysis::kStartOfFlags, 0),
+ fTriggerMemoEvent(2*AliTriggerAnalysis::kStartOfFlags, 0),
+ fTriggerMemoCounter(0)
  {
    // constructor
    fCollTrigClasses.SetOwner(1);
@@ -179,6 +385,7 @@ AliPhysicsSelection::~AliPhysicsSelection(){
   if (fTriggerOADB)  delete fTriggerOADB;
   delete fTriggerToFormula;
   delete fTriggerToRegexp;
+  delete fTriggerToProgram;
 }
 
 UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const {
@@ -270,22 +477,70 @@ UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char
 Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
 						 AliTriggerAnalysis* triggerAnalysis,
 						 const char* triggerLogic, Bool_t offline){
+  auto offline_flag = offline ? AliTriggerAnalysis::kOfflineFlag : 0;
+  typedef AliTriggerAnalysis::Trigger Trigger;
+  // Compiled program: all bits of the logic are evaluated, as for the TFormula,
+  // so that the calls to AliTriggerAnalysis are the same in both cases
+  const AliTriggerLogicProgram* program = fUseCompiledTriggerLogic ? FindProgram(triggerLogic) : 0;
+  if (program) {
+    const std::vector<Trigger>& programBits = program->GetBits();
+    fTriggerBitValues.resize(programBits.size());
+    for (size_t i = 0; i < programBits.size(); ++i) {
+      Trigger bit = static_cast<Trigger>(programBits[i] | offline_flag);
+      fTriggerBitValues[i] = EvaluateTriggerBit(event, triggerAnalysis, bit);
+    }
+    return program->Evaluate(fTriggerBitValues.data()) != 0;
+  }
   auto& formula_and_bits = FindForumla(triggerLogic);
   auto& trg_formula = formula_and_bits.first;
   auto& bits = formula_and_bits.second;
   // Get the values for each individual trigger in the trigger logic string;
   // These values are the parameters of the TFormula
   std::vector<Double_t> paras(bits.size());
-  auto offline_flag = offline ? AliTriggerAnalysis::kOfflineFlag : 0;
   for (size_t i = 0; i < bits.size(); ++i) {
-    typedef AliTriggerAnalysis::Trigger Trigger;
     Trigger bit = static_cast<Trigger>(bits[i] | offline_flag);
-    paras[i] = triggerAnalysis->EvaluateTrigger(event, bit);
+    paras[i] = EvaluateTriggerBit(event, triggerAnalysis, bit);
   }
   Double_t dummy_val[] = {0};
   return trg_formula.EvalPar(dummy_val, paras.data());
 }
 
+/// Evaluate a single trigger bit, at most once per event
+///
+/// The trigger analysis objects of all trigger classes are configured identically,
+/// so the value of a bit computed for one trigger class is reused for the others.
+/// The online SPD fast-OR bits are not memoized: with an SPD FO efficiency set,
+/// they are computed with random numbers which have to be drawn at each call
+/// in order to keep the same sequence as without the memo.
+///
+/// \param event Pointer to the current event
+/// \param triggerAnalysis Pointer to the TriggerAnlysis class
+/// \param bit Trigger bit, including the offline flag
+///
+/// \return Value of AliTriggerAnalysis::EvaluateTrigger for this bit
+Int_t AliPhysicsSelection::EvaluateTriggerBit(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, AliTriggerAnalysis::Trigger bit){
+  if (!fUseCompiledTriggerLogic || fTriggerMemoCounter == 0)
+    return triggerAnalysis->EvaluateTrigger(event, bit);
+
+  Bool_t offline = (bit & AliTriggerAnalysis::kOfflineFlag) != 0;
+  UInt_t triggerNoFlags = bit % AliTriggerAnalysis::kStartOfFlags;
+  if (!offline && (triggerNoFlags == AliTriggerAnalysis::kSPDGFO ||
+                   triggerNoFlags == AliTriggerAnalysis::kSPDGFOL0 ||
+                   triggerNoFlags == AliTriggerAnalysis::kSPDGFOL1))
+    return triggerAnalysis->EvaluateTrigger(event, bit);
+
+  UInt_t index = triggerNoFlags + (offline ? AliTriggerAnalysis::kStartOfFlags : 0);
+  // Bits with other flags than kOfflineFlag are not memoized
+  if ((bit & ~AliTriggerAnalysis::kOfflineFlag) >= AliTriggerAnalysis::kStartOfFlags || index >= fTriggerMemo.size())
+    return triggerAnalysis->EvaluateTrigger(event, bit);
+
+  if (fTriggerMemoEvent[index] != fTriggerMemoCounter) {
+    fTriggerMemo[index] = triggerAnalysis->EvaluateTrigger(event, bit);
+    fTriggerMemoEvent[index] = fTriggerMemoCounter;
+  }
+  return fTriggerMemo[index];
+}
+
 //______________________________________________________________________________
 UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
   // checks if the given event is a collision candidate
@@ -301,6 +556,12 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
   } else {
     if (eventType != 7) return kFALSE;
   }
+
+  // new event for the memo of the trigger bits
+  if (++fTriggerMemoCounter == 0) {
+    std::fill(fTriggerMemoEvent.begin(), fTriggerMemoEvent.end(), 0);
+    fTriggerMemoCounter = 1;
+  }
   
   UInt_t accept = 0;
   Int_t nColl = fCollTrigClasses.GetEntries();
@@ -877,6 +1138,29 @@ FormulaAndBits& AliPhysicsSelection::FindForumla(const char* triggerLogic) {
   return it->second;
 }
 
+const AliTriggerLogicProgram* AliPhysicsSelection::FindProgram(const char* triggerLogic) {
+  // Do we have this logic compiled? If not, compile it and resolve the trigger bits
+  auto it = fTriggerToProgram->find(triggerLogic);
+  if (it == fTriggerToProgram->end()) {
+    AliTriggerLogicProgram program;
+    if (program.Compile(triggerLogic)) {
+      for (const std::string& name : program.GetBitNames()) {
+        TInterpreter::EErrorCode error;
+        Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", name.c_str()), &error);
+
+        if (error > 0)
+          AliFatal(Form("Trigger token %s unknown", name.c_str()));
+
+        program.AddBit(static_cast<AliTriggerAnalysis::Trigger>(bit));
+      }
+    } else {
+      AliWarning(Form("Could not compile trigger logic %s, using TFormula", triggerLogic));
+    }
+    it = fTriggerToProgram->emplace(std::string(triggerLogic), program).first;
+  }
+  return it->second.IsValid() ? &it->second : 0;
+}
+
 TPRegexp& AliPhysicsSelection::FindRegexp(const std::string& triggers) const {
   auto it = fTriggerToRegexp->find(triggers);
   if (it != fTriggerToRegexp->end())
@@ -45,6 +45,8 @@ class AliOADBFillingScheme;
 class AliOADBTriggerAnalysis;
 class TPRegexp;
 class StringToRegexp;
+class StringToTriggerProgram;
+class AliTriggerLogicProgram;
 
 typedef std::pair<R5TFormula, std::vector<AliTriggerAnalysis::Trigger>> FormulaAndBits;
 typedef std::map<std::string, FormulaAndBits> StringToFormula;
@@ -98,10 +100,12 @@ public:
   void SetPassName(const TString passName) { fPassName = passName; }
   void DetectPassName();
   void ReadOCDB(Bool_t val) { fReadOCDB=val; }
+  void SetUseCompiledTriggerLogic(Bool_t val = kTRUE) { fUseCompiledTriggerLogic = val; }
   Bool_t IsMC() const { return fMC; }
 protected:
   UInt_t CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const;
   Bool_t EvaluateTriggerLogic(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, const char* triggerLogic, Bool_t offline);
+  Int_t  EvaluateTriggerBit(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, AliTriggerAnalysis::Trigger bit);
   const char * GetTriggerString(TObjString * obj);
 
   TString fPassName;          // pass name for current run
@@ -112,6 +116,7 @@ protected:
   Bool_t fReadOCDB;           // Flag to read thresholds from OCDB
   Bool_t fUseBXNumbers;       // Explicitly select "good" bunch crossing numbers
   Bool_t fUsingCustomClasses; // flag that is set if custom trigger classes are defined
+  Bool_t fUseCompiledTriggerLogic; // flag to evaluate the trigger logic with compiled programs and a per-event memo of the trigger bits
   TList fCollTrigClasses;     // trigger class identifying collision candidates
   TList fBGTrigClasses;       // trigger classes identifying background events
   TList fTriggerAnalysis;     // list of AliTriggerAnalysis objects (several are needed to keep the control histograms separate per trigger class)
@@ -128,7 +133,14 @@ protected:
   StringToRegexp* fTriggerToRegexp; //!
   TPRegexp& FindRegexp(const std::string& triggers) const;
 
-  ClassDef(AliPhysicsSelection, 24)
+  StringToTriggerProgram* fTriggerToProgram; //! Map trigger strings to compiled programs
+  const AliTriggerLogicProgram* FindProgram(const char* triggerLogic); //! Returns the compiled program, null if the logic needs TFormula
+  std::vector<Double_t> fTriggerBitValues; //! values of the trigger bits of the logic being evaluated
+  std::vector<Int_t>    fTriggerMemo;      //! trigger bit values of the current event, indexed by bit and offline flag
+  std::vector<UInt_t>   fTriggerMemoEvent; //! event counter at which each value of fTriggerMemo was computed
+  UInt_t                fTriggerMemoCounter; //! counter of the processed events
+
+  ClassDef(AliPhysicsSelection, 25)
 private:
   AliPhysicsSelection(const AliPhysicsSelection&);
   AliPhysicsSelection& operator=(const AliPhysicsSelection&);
@@ -0,0 +1,341 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// Root
+#include <TClonesArray.h>
+#include <TLorentzVector.h>
+
+// AliRoot
+#include "AliLog.h"
+
+// CaloTrackCorr
+#include "AliCaloTrackParticle.h"
+#include "AliCaloTrackMixingPool.h"
+
+/// \cond CLASSIMP
+ClassImp(AliCaloTrackMixingPool) ;
+/// \endcond
+
+//______________________________________________________________
+/// Constructor.
+//______________________________________________________________
+AliCaloTrackMixingPool::AliCaloTrackMixingPool()
+: TObject(), fNBins(0), fDepth(0), fViews(), fCurrentEvent(0x0)
+{
+  for(Int_t itype = 0; itype < kNPoolTypes; itype++)
+  {
+    fMinPt[itype] = 1e6;
+    fMaxPt[itype] = -1;
+    fLastFilledEvent[itype] = -1;
+  }
+}
+
+//______________________________________________________________
+/// Set the number of event bins. All the analysis sharing
+/// the pool must use the same event binning.
+///
+/// \return kFALSE if the pool was initialized with a different number of bins.
+//______________________________________________________________
+Bool_t AliCaloTrackMixingPool::Init(Int_t nBins)
+{
+  if ( fNBins > 0 )
+  {
+    if ( fNBins == nBins ) return kTRUE;
+
+    AliError(Form("Pool already initialized with %d bins, requested %d",fNBins,nBins));
+    return kFALSE;
+  }
+
+  if ( nBins <= 0 ) return kFALSE;
+
+  fNBins = nBins;
+
+  for(Int_t itype = 0; itype < kNPoolTypes; itype++)
+  {
+    fEvents [itype].resize(fNBins*fDepth);
+    fFirst  [itype].assign(fNBins, fDepth-1);
+    fNStored[itype].assign(fNBins, 0);
+  }
+
+  return kTRUE;
+}
+
+//______________________________________________________________
+/// Register a read-only view on the pool.
+///
+/// \param type: pool type, kTracks or kCalo.
+/// \param depth: number of events to mix with.
+/// \param minPt, maxPt: pT window of the particles of the view.
+/// \param requiredBits: particleBits the particles must have.
+/// \param rejectedBits: particleBits the particles must not have.
+///
+/// \return the view index, to be used when reading the pool.
+//______________________________________________________________
+Int_t AliCaloTrackMixingPool::RegisterView(Int_t type, Int_t depth, Float_t minPt, Float_t maxPt,
+                                           UChar_t requiredBits, UChar_t rejectedBits)
+{
+  if ( type < 0 || type >= kNPoolTypes || depth <= 0 ) return -1;
+
+  View_t view;
+  view.fType         = type;
+  view.fDepth        = depth;
+  view.fMinPt        = minPt;
+  view.fMaxPt        = maxPt;
+  view.fRequiredBits = requiredBits;
+  view.fRejectedBits = rejectedBits;
+  fViews.push_back(view);
+
+  if ( minPt < fMinPt[type] ) fMinPt[type] = minPt;
+  if ( maxPt > fMaxPt[type] ) fMaxPt[type] = maxPt;
+
+  if ( depth > fDepth ) SetDepth(depth);
+
+  AliDebug(1,Form("View %d: type %d, depth %d, pT [%2.2f,%2.2f]; pool depth %d",
+                  (Int_t)fViews.size()-1,type,depth,minPt,maxPt,fDepth));
+
+  return fViews.size()-1;
+}
+
+//______________________________________________________________
+/// Increase the number of events stored per bin, keeping the
+/// events already in the pool.
+//______________________________________________________________
+void AliCaloTrackMixingPool::SetDepth(Int_t depth)
+{
+  Int_t oldDepth = fDepth;
+  fDepth = depth;
+
+  if ( fNBins <= 0 ) return;
+
+  for(Int_t itype = 0; itype < kNPoolTypes; itype++)
+  {
+    std::vector<MixedEvent_t> events(fNBins*fDepth);
+
+    for(Int_t ibin = 0; ibin < fNBins; ibin++)
+    {
+      // Newest event goes to the last slot, such that the next one is written in slot 0
+      Int_t nStored = fNStored[itype][ibin];
+      for(Int_t iev = 0; iev < nStored; iev++)
+      {
+        Int_t oldSlot = ibin*oldDepth + (fFirst[itype][ibin] - iev + oldDepth) % oldDepth;
+        events[ibin*fDepth + fDepth - 1 - iev].fEventNumber = fEvents[itype][oldSlot].fEventNumber;
+        events[ibin*fDepth + fDepth - 1 - iev].fParticles.swap(fEvents[itype][oldSlot].fParticles);
+      }
+      fFirst[itype][ibin] = fDepth - 1;
+    }
+
+    fEvents[itype].swap(events);
+  }
+}
+
+//______________________________________________________________
+/// \return the stored event iev of a bin, iev = 0 is the newest event.
+//______________________________________________________________
+const AliCaloTrackMixingPool::MixedEvent_t & AliCaloTrackMixingPool::GetStoredEvent(Int_t type, Int_t bin, Int_t iev) const
+{
+  Int_t slot = (fFirst[type][bin] - iev + fDepth) % fDepth;
+  return fEvents[type][bin*fDepth + slot];
+}
+
+//______________________________________________________________
+/// Start storing a new event in the bin. The oldest event of
+/// the bin is dropped if the ring is full, and its slot reused.
+/// Particles are then added with AddParticle(), and the event
+/// closed with FinishEvent().
+//______________________________________________________________
+void AliCaloTrackMixingPool::StartEvent(Int_t type, Int_t bin, Int_t eventNumber)
+{
+  fCurrentEvent = 0x0;
+
+  if ( type < 0 || type >= kNPoolTypes || bin < 0 || bin >= fNBins || fDepth <= 0 )
+  {
+    AliWarning(Form("Cannot store event in pool type %d, bin %d (%d bins, depth %d)",type,bin,fNBins,fDepth));
+    return;
+  }
+
+  Int_t slot = (fFirst[type][bin] + 1) % fDepth;
+  fFirst[type][bin] = slot;
+  if ( fNStored[type][bin] < fDepth ) fNStored[type][bin]++;
+
+  fCurrentEvent = &(fEvents[type][bin*fDepth + slot]);
+  fCurrentEvent->fEventNumber = eventNumber;
+  fCurrentEvent->fParticles.clear();
+
+  fLastFilledEvent[type] = eventNumber;
+}
+
+//______________________________________________________________
+/// Add a particle to the event being stored.
+//______________________________________________________________
+void AliCaloTrackMixingPool::AddParticle(Float_t px, Float_t py, Float_t pz, Float_t e, UChar_t detector, UChar_t bits)
+{
+  if ( !fCurrentEvent ) return;
+
+  MixedParticle_t part;
+  part.fPx       = px;
+  part.fPy       = py;
+  part.fPz       = pz;
+  part.fE        = e;
+  part.fDetector = detector;
+  part.fBits     = bits;
+  fCurrentEvent->fParticles.push_back(part);
+}
+
+//______________________________________________________________
+/// Close the event being stored.
+///
+/// \return the number of particles stored.
+//______________________________________________________________
+Int_t AliCaloTrackMixingPool::FinishEvent()
+{
+  if ( !fCurrentEvent ) return 0;
+
+  Int_t nParticles = fCurrentEvent->fParticles.size();
+  fCurrentEvent = 0x0;
+  return nParticles;
+}
+
+//______________________________________________________________
+/// \return number of events in the bin available to the view.
+//______________________________________________________________
+Int_t AliCaloTrackMixingPool::GetNEvents(Int_t view, Int_t bin) const
+{
+  if ( view < 0 || view >= (Int_t) fViews.size() || bin < 0 || bin >= fNBins ) return 0;
+
+  const View_t & v = fViews[view];
+  return TMath::Min(v.fDepth, fNStored[v.fType][bin]);
+}
+
+//______________________________________________________________
+/// \return event number of the mixed event iev, 0 being the newest.
+//______________________________________________________________
+Int_t AliCaloTrackMixingPool::GetEventNumber(Int_t view, Int_t bin, Int_t iev) const
+{
+  if ( iev < 0 || iev >= GetNEvents(view,bin) ) return -1;
+
+  return GetStoredEvent(fViews[view].fType, bin, iev).fEventNumber;
+}
+
+//______________________________________________________________
+/// \return number of stored particles of mixed event iev, the
+/// view selection is not applied, see IsAccepted().
+//______________________________________________________________
+Int_t AliCaloTrackMixingPool::GetNParticles(Int_t view, Int_t bin, Int_t iev) const
+{
+  if ( iev < 0 || iev >= GetNEvents(view,bin) ) return 0;
+
+  return GetStoredEvent(fViews[view].fType, bin, iev).fParticles.size();
+}
+
+//______________________________________________________________
+/// \return number of particles of mixed event iev passing the
+/// view selection.
+//______________________________________________________________
+Int_t AliCaloTrackMixingPool::GetNAccepted(Int_t view, Int_t bin, Int_t iev) const
+{
+  if ( iev < 0 || iev >= GetNEvents(view,bin) ) return 0;
+
+  const std::vector<MixedParticle_t> & stored = GetStoredEvent(fViews[view].fType, bin, iev).fParticles;
+
+  Int_t n = 0;
+  for(UInt_t ipart = 0; ipart < stored.size(); ipart++)
+    if ( IsAccepted(view,stored[ipart]) ) n++;
+
+  return n;
+}
+
+//______________________________________________________________
+/// \return stored particle ipart of mixed event iev.
+//______________________________________________________________
+const AliCaloTrackMixingPool::MixedParticle_t & AliCaloTrackMixingPool::GetParticle(Int_t view, Int_t bin, Int_t iev, Int_t ipart) const
+{
+  return GetStoredEvent(fViews[view].fType, bin, iev).fParticles[ipart];
+}
+
+//______________________________________________________________
+/// \return kTRUE if the particle passes the selection of the view.
+//______________________________________________________________
+Bool_t AliCaloTrackMixingPool::IsAccepted(Int_t view, const MixedParticle_t & part) const
+{
+  const View_t & v = fViews[view];
+
+  if ( (part.fBits & v.fRequiredBits) != v.fRequiredBits ) return kFALSE;
+  if (  part.fBits & v.fRejectedBits                     ) return kFALSE;
+
+  Float_t pt = part.Pt();
+  return pt >= v.fMinPt && pt <= v.fMaxPt;
+}
+
+//______________________________________________________________
+/// Fill the particles of mixed event iev passing the view selection
+/// into a TClonesArray of AliCaloTrackParticle. The objects of the
+/// array are reused, so the array should be owned by the caller and
+/// only used for this purpose.
+///
+/// \return number of particles filled.
+//______________________________________________________________
+Int_t AliCaloTrackMixingPool::GetEvent(Int_t view, Int_t bin, Int_t iev, TClonesArray * particles) const
+{
+  if ( !particles ) return 0;
+
+  particles->Clear();
+
+  if ( iev < 0 || iev >= GetNEvents(view,bin) ) return 0;
+
+  const std::vector<MixedParticle_t> & stored = GetStoredEvent(fViews[view].fType, bin, iev).fParticles;
+
+  Int_t n = 0;
+  for(UInt_t ipart = 0; ipart < stored.size(); ipart++)
+  {
+    const MixedParticle_t & part = stored[ipart];
+    if ( !IsAccepted(view,part) ) continue;
+
+    // Slots constructed for the first time come from the default constructor,
+    // without momentum; reused slots keep theirs.
+    AliCaloTrackParticle * particle = static_cast<AliCaloTrackParticle*>(particles->ConstructedAt(n++));
+    if ( particle->GetMomentum() )
+      particle->GetMomentum()->SetPxPyPzE(part.fPx, part.fPy, part.fPz, part.fE);
+    else
+      particle->SetMomentum(new TLorentzVector(part.fPx, part.fPy, part.fPz, part.fE));
+    particle->SetDetectorTag(part.fDetector);
+    particle->SetChargedBit(part.fBits & kPositive);
+  }
+
+  return n;
+}
+
+//______________________________________________________________
+/// Print some relevant parameters set for the pool.
+//______________________________________________________________
+void AliCaloTrackMixingPool::Print(const Option_t * opt) const
+{
+  if(! opt)
+    return;
+
+  printf("***** Print: %s %s ******\n", GetName(), GetTitle() ) ;
+
+  printf("Bins %d, depth %d, views %d\n", fNBins, fDepth, (Int_t) fViews.size());
+
+  for(Int_t itype = 0; itype < kNPoolTypes; itype++)
+  {
+    Int_t nEvents = 0, nParticles = 0;
+    for(UInt_t islot = 0; islot < fEvents[itype].size(); islot++)
+      nParticles += fEvents[itype][islot].fParticles.size();
+    for(Int_t ibin = 0; ibin < fNBins; ibin++) nEvents += fNStored[itype][ibin];
+
+    printf("Pool type %d: pT [%2.2f,%2.2f], stored events %d, particles %d\n",
+           itype, fMinPt[itype], fMaxPt[itype], nEvents, nParticles);
+  }
+}
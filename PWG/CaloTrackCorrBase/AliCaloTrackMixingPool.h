@@ -0,0 +1,139 @@
+#ifndef ALICALOTRACKMIXINGPOOL_H
+#define ALICALOTRACKMIXINGPOOL_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliCaloTrackMixingPool
+/// \ingroup CaloTrackCorrelationsBase
+/// \brief Event mixing pool shared by the analysis of a reader
+///
+/// Tracks and calorimeter clusters of the events selected for mixing are stored
+/// once per event, in a ring buffer per event bin (centrality, z vertex, reaction plane).
+/// Only the kinematics and a few bits (charge, track matching) are kept, instead of
+/// full AliCaloTrackParticle clones, and the buffers are recycled when the ring is full.
+///
+/// Each analysis registers a read-only view with its own depth (number of mixed events)
+/// and particle selection (pT window and bits). The pool keeps as many events as the
+/// deepest view, and stores the particles accepted by any view. The particles of a mixed
+/// event passing the view selection can be recovered either directly, or materialized
+/// into a reusable TClonesArray of AliCaloTrackParticle, for the methods expecting
+/// a TObjArray.
+///
+/// The pool is owned by AliCaloTrackReader, see AliCaloTrackReader::GetMixingPool().
+//_________________________________________________________________________
+
+#include <vector>
+
+#include <TObject.h>
+#include <TMath.h>
+
+class TClonesArray;
+
+class AliCaloTrackMixingPool : public TObject {
+
+ public:
+
+  AliCaloTrackMixingPool() ;
+
+  /// Destructor
+  virtual ~AliCaloTrackMixingPool() { ; }
+
+  /// Type of particles stored in the pool
+  enum poolTypes { kTracks = 0, kCalo = 1, kNPoolTypes = 2 } ;
+
+  /// Bits stored per particle
+  enum particleBits { kCharged = 1, kPositive = 2, kTrackMatched = 4 } ;
+
+  /// Compact particle stored in the pool
+  struct MixedParticle_t
+  {
+    Float_t  fPx ;           ///< Momentum x
+    Float_t  fPy ;           ///< Momentum y
+    Float_t  fPz ;           ///< Momentum z
+    Float_t  fE  ;           ///< Energy
+    UChar_t  fDetector ;     ///< Detector tag, see AliFiducialCut::detector
+    UChar_t  fBits ;         ///< Combination of particleBits
+    Float_t  Pt() const { return TMath::Sqrt(fPx*fPx+fPy*fPy) ; }
+  } ;
+
+  Bool_t   Init(Int_t nBins) ;
+  Bool_t   IsInitialized()                              const { return fNBins > 0 ; }
+  Int_t    GetNBins()                                   const { return fNBins     ; }
+  Int_t    GetDepth()                                   const { return fDepth     ; }
+
+  Int_t    RegisterView(Int_t type, Int_t depth, Float_t minPt, Float_t maxPt,
+                        UChar_t requiredBits = 0, UChar_t rejectedBits = 0) ;
+
+  //
+  // Filling, done once per event and pool type
+  //
+  Int_t    GetLastFilledEvent(Int_t type)               const { return fLastFilledEvent[type] ; }
+  Bool_t   AcceptPt(Int_t type, Float_t pt)             const { return pt >= fMinPt[type] && pt <= fMaxPt[type] ; }
+  void     StartEvent(Int_t type, Int_t bin, Int_t eventNumber) ;
+  void     AddParticle(Float_t px, Float_t py, Float_t pz, Float_t e, UChar_t detector, UChar_t bits) ;
+  Int_t    FinishEvent() ;
+
+  //
+  // Reading, through a view
+  //
+  Int_t    GetNEvents(Int_t view, Int_t bin)            const ;
+  Int_t    GetEventNumber(Int_t view, Int_t bin, Int_t iev) const ;
+  Int_t    GetNParticles(Int_t view, Int_t bin, Int_t iev) const ;
+  Int_t    GetNAccepted (Int_t view, Int_t bin, Int_t iev) const ;
+  const MixedParticle_t & GetParticle(Int_t view, Int_t bin, Int_t iev, Int_t ipart) const ;
+  Bool_t   IsAccepted(Int_t view, const MixedParticle_t & part) const ;
+  Int_t    GetEvent(Int_t view, Int_t bin, Int_t iev, TClonesArray * particles) const ;
+
+  void     Print(const Option_t * opt) const ;
+
+ private:
+
+  /// Stored event, the particle vector keeps its capacity when the slot is reused
+  struct MixedEvent_t
+  {
+    MixedEvent_t() : fEventNumber(-1), fParticles() { ; }
+    Int_t                         fEventNumber ;
+    std::vector<MixedParticle_t>  fParticles   ;
+  } ;
+
+  /// Read-only view of one analysis
+  struct View_t
+  {
+    Int_t    fType ;
+    Int_t    fDepth ;
+    Float_t  fMinPt ;
+    Float_t  fMaxPt ;
+    UChar_t  fRequiredBits ;
+    UChar_t  fRejectedBits ;
+  } ;
+
+  const MixedEvent_t & GetStoredEvent(Int_t type, Int_t bin, Int_t iev) const ;
+  void     SetDepth(Int_t depth) ;
+
+  Int_t                     fNBins ;                        ///< Number of event bins.
+  Int_t                     fDepth ;                        ///< Number of events stored per bin, maximum of the view depths.
+  Float_t                   fMinPt[kNPoolTypes] ;           ///< Minimum pT of the stored particles, minimum of the views.
+  Float_t                   fMaxPt[kNPoolTypes] ;           ///< Maximum pT of the stored particles, maximum of the views.
+  std::vector<View_t>       fViews ;                        //!<! Registered views.
+
+  std::vector<MixedEvent_t> fEvents[kNPoolTypes] ;          //!<! Ring buffers, fDepth slots per bin.
+  std::vector<Int_t>        fFirst[kNPoolTypes] ;           //!<! Slot of the newest event per bin.
+  std::vector<Int_t>        fNStored[kNPoolTypes] ;         //!<! Number of stored events per bin.
+  Int_t                     fLastFilledEvent[kNPoolTypes] ; //!<! Last event number added per pool type.
+
+  MixedEvent_t            * fCurrentEvent ;                 //!<! Event being filled.
+
+  /// Copy constructor not implemented.
+  AliCaloTrackMixingPool(              const AliCaloTrackMixingPool & pool) ;
+
+  /// Assignment operator not implemented.
+  AliCaloTrackMixingPool & operator = (const AliCaloTrackMixingPool & pool) ;
+
+  /// \cond CLASSIMP
+  ClassDef(AliCaloTrackMixingPool,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALICALOTRACKMIXINGPOOL_H
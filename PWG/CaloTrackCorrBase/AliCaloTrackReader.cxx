@@ -103,7 +103,7 @@ fTaskName(""),               fCaloUtils(0x0),                 fMCUtils(0x0),
 fWeightUtils(0x0),           fEventWeight(1),
 fMixedEvent(NULL),           fNMixedEvent(0),                 fVertex(NULL),
 fListMixedTracksEvents(),    fListMixedCaloEvents(),
-fLastMixedTracksEvent(-1),   fLastMixedCaloEvent(-1),
+fLastMixedTracksEvent(-1),   fLastMixedCaloEvent(-1),      fMixingPool(0x0),
 fWriteOutputDeltaAOD(kFALSE),
 fEMCALClustersListName(""),  fEMCALCellsListName(""),  
 fZvtxCut(0.),
@@ -242,6 +242,8 @@ void AliCaloTrackReader::DeletePointers()
   fAcceptEventsWithBit.Reset();
   
   if ( fWeightUtils ) delete fWeightUtils ;
+  
+  if ( fMixingPool  ) delete fMixingPool ;
     
   if ( fMCUtils     ) delete fMCUtils ; 
 
@@ -53,6 +53,7 @@ class AliVCluster;
 #include "AliFiducialCut.h"
 class AliCalorimeterUtils;
 #include "AliAnaWeights.h"
+#include "AliCaloTrackMixingPool.h"
 #include "AliMCAnalysisUtils.h"
 
 class AliCaloTrackReader : public TObject {
@@ -656,6 +657,10 @@ public:
   void    SetListWithMixedEventsForTracks(TList ** l)      { 
             if(fListMixedTracksEvents)  printf("AliCaloTrackReader::SetListWithMixedEventsForTracks() - Calorimeter Mixing event list already set, nothing done\n");
             else                        fListMixedTracksEvents  = l ; }
+
+  /// Mixing pool with compact particles shared by the analysis of this reader, created on first request.
+  AliCaloTrackMixingPool * GetMixingPool()                 { if ( !fMixingPool ) fMixingPool = new AliCaloTrackMixingPool() ;
+                                                             return fMixingPool ; }
   
   //-------------------------------------
   // Other methods
@@ -933,6 +938,7 @@ public:
   TList **         fListMixedCaloEvents  ;         //!<! Container for photon stored for different events, used in case of own mixing, set in analysis class.
   Int_t            fLastMixedTracksEvent ;         ///<  Temporary container with the last event added to the mixing list for tracks.
   Int_t            fLastMixedCaloEvent   ;         ///<  Temporary container with the last event added to the mixing list for photons.
+  AliCaloTrackMixingPool * fMixingPool ;          //!<! Shared mixing pool, see GetMixingPool(), owned.
    
   Bool_t           fWriteOutputDeltaAOD;           ///<  Write the created delta AOD objects into file.  
   
@@ -1084,7 +1090,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,85) ;
+  ClassDef(AliCaloTrackReader,86) ;
   /// \endcond
 
 } ;
@@ -24,5 +24,6 @@
 #pragma link C++ class AliAnalysisTaskCaloTrackCorrelationM+;
 #pragma link C++ class AliHistogramRanges+;
 #pragma link C++ class AliAnaWeights+;
+#pragma link C++ class AliCaloTrackMixingPool+;
 
 #endif
@@ -74,7 +74,8 @@ AliGenEMCocktailV2::AliGenEMCocktailV2():AliGenCocktail(),
   fDynPtRange(kFALSE),
   fForceConv(kFALSE),
   fSelectedParticles(kGenHadrons),
-  fUseFixedEP(kFALSE)  
+  fUseFixedEP(kFALSE),
+  fPtTableAccuracy(0.)
 {
   // Constructor
 }
@@ -190,6 +191,8 @@ void AliGenEMCocktailV2::CreateCocktail()
   SetMtScalingFactors();
   AliGenEMlibV2::SetPtParametrizations(fParametrizationFile, fParametrizationDir);
   SetPtParametrizations();
+  if (fPtTableAccuracy>0)
+    AliInfo(Form("Tabulating pt parametrizations over the pt range of each source with accuracy %.1e",fPtTableAccuracy));
   //Check consistency of pT and flow parameterizations: same centrality?
   if(fV2ParametrizationDir.Length()>0){ //flow specified
     TRegexp cent("_[0-9][0-9][0-9][0-9]_") ;
@@ -801,7 +804,17 @@ void AliGenEMCocktailV2::AddSource2Generator(Char_t* nameSource,
   genSource->SetWeighting(fWeightingMode);
   genSource->SetForceGammaConversion(fForceConv);
   if (!TVirtualMC::GetMC()) genSource->SetDecayer(fDecayer);
+  if (fPtTableAccuracy>0) {
+    // tabulate the pt parametrization over the sampling range of the source (stretched
+    // with the dynamical pt range), before the source evaluates it
+    AliGenEMlibV2::SetPtTable(genSource->GetParam(), fPtMin, maxPtStretchFactor*fPtMax, fPtTableAccuracy);
+  }
   genSource->Init();
+  if (fPtTableAccuracy>0) {
+    // number of points of the inverse-CDF table of TF1::GetRandom for the pt sampling
+    Int_t npx = AliGenEMlibV2::GetPtTableNpx(genSource->GetParam(), fPtMin, maxPtStretchFactor*fPtMax, fPtTableAccuracy);
+    if (npx>0 && genSource->GetPt()) genSource->GetPt()->SetNpx(npx);
+  }
 
   AddGenerator(genSource,nameSource,1.); // Adding Generator
 }
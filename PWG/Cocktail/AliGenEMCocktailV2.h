@@ -72,10 +72,12 @@ public:
   static  void    SetMtScalingFactors();
   static  Bool_t  SetPtYDistributions();
   void    SetFixedEventPlane(Bool_t toFix=kTRUE){fUseFixedEP=toFix;} //Default is random
+  void    SetPtTableAccuracy(Double_t accuracy)                       { fPtTableAccuracy = accuracy;      } // 0: no pt tables
  
   // getters
   Bool_t    GetDynamicalPtRangeOption()       const                   { return fDynPtRange;               }
   Bool_t    GetYWeightOption()                const                   { return fUseYWeighting;            }
+  Double_t  GetPtTableAccuracy()              const                   { return fPtTableAccuracy;          }
   Float_t   GetDecayMode()                    const                   { return fDecayMode;                }
   Float_t   GetWeightingMode()                const                   { return fWeightingMode;            }
   AliGenEMlibV2::CollisionSystem_t  GetCollisionSystem()  const       { return fCollisionSystem;          }
@@ -140,8 +142,9 @@ private:
   Bool_t        fForceConv;                             // select whether you want to force all gammas to convert imidediately
   UInt_t        fSelectedParticles;                     // which particles to simulate, allows to switch on and off 32 different particles
   Bool_t        fUseFixedEP;                            // use random Event Plane or fixed Psi=0
+  Double_t      fPtTableAccuracy;                       // accuracy of the tabulated pt parametrizations and their sampling, 0: parametrizations are evaluated directly
   
-  ClassDef(AliGenEMCocktailV2,9)                        // cocktail for EM physics
+  ClassDef(AliGenEMCocktailV2,10)                        // cocktail for EM physics
 };
 
 #endif
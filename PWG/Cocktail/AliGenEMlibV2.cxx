@@ -49,6 +49,9 @@ Int_t AliGenEMlibV2::fgSelectedCentrality       = AliGenEMlibV2::kpp;
 Int_t AliGenEMlibV2::fgSelectedV2Systematic     = AliGenEMlibV2::kNoV2Sys;
 TF1*  AliGenEMlibV2::fV2Parametrization[]={0x0} ;
 Int_t AliGenEMlibV2::fV2RefParameterization[] = {0} ;
+std::vector<Double_t> AliGenEMlibV2::fPtTableX[26];
+std::vector<Double_t> AliGenEMlibV2::fPtTableY[26];
+std::vector<Double_t> AliGenEMlibV2::fPtTableCDF[26];
 
 Double_t AliGenEMlibV2::CrossOverLc(double a, double b, double x){
   if(x<b-a/2) return 1.0;
@@ -271,7 +274,7 @@ Int_t AliGenEMlibV2::IpPizero(TRandom *)
 Double_t AliGenEMlibV2::PtPizero( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kPizero]->Eval(pt);
+  return EvalPtParametrization(kPizero, pt);
 }
 
 Double_t AliGenEMlibV2::YPizero( const Double_t *py, const Double_t */*dummy*/ )
@@ -349,7 +352,7 @@ Int_t AliGenEMlibV2::IpEta(TRandom *)
 Double_t AliGenEMlibV2::PtEta( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kEta]->Eval(pt);
+  return EvalPtParametrization(kEta, pt);
 }
 
 Double_t AliGenEMlibV2::YEta( const Double_t *py, const Double_t */*dummy*/ )
@@ -382,7 +385,7 @@ Int_t AliGenEMlibV2::IpRho0(TRandom *)
 Double_t AliGenEMlibV2::PtRho0( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRho0]->Eval(pt);
+  return EvalPtParametrization(kRho0, pt);
 }
 
 Double_t AliGenEMlibV2::YRho0( const Double_t *py, const Double_t */*dummy*/ )
@@ -415,7 +418,7 @@ Int_t AliGenEMlibV2::IpOmega(TRandom *)
 Double_t AliGenEMlibV2::PtOmega( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kOmega]->Eval(pt);
+  return EvalPtParametrization(kOmega, pt);
 }
 
 Double_t AliGenEMlibV2::YOmega( const Double_t *py, const Double_t */*dummy*/ )
@@ -448,7 +451,7 @@ Int_t AliGenEMlibV2::IpEtaprime(TRandom *)
 Double_t AliGenEMlibV2::PtEtaprime( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kEtaprime]->Eval(pt);
+  return EvalPtParametrization(kEtaprime, pt);
 }
 
 Double_t AliGenEMlibV2::YEtaprime( const Double_t *py, const Double_t */*dummy*/ )
@@ -482,7 +485,7 @@ Int_t AliGenEMlibV2::IpPhi(TRandom *)
 Double_t AliGenEMlibV2::PtPhi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kPhi]->Eval(pt);
+  return EvalPtParametrization(kPhi, pt);
 }
 
 Double_t AliGenEMlibV2::YPhi( const Double_t *py, const Double_t */*dummy*/ )
@@ -515,7 +518,7 @@ Int_t AliGenEMlibV2::IpJpsi(TRandom *)
 Double_t AliGenEMlibV2::PtJpsi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kJpsi]->Eval(pt);
+  return EvalPtParametrization(kJpsi, pt);
 }
 
 Double_t AliGenEMlibV2::YJpsi( const Double_t *py, const Double_t */*dummy*/ )
@@ -558,7 +561,7 @@ Int_t AliGenEMlibV2::IpSigma0(TRandom *)
 Double_t AliGenEMlibV2::PtSigma0( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kSigma0]->Eval(pt);
+  return EvalPtParametrization(kSigma0, pt);
 }
 
 Double_t AliGenEMlibV2::YSigma0( const Double_t *py, const Double_t */*dummy*/ )
@@ -592,7 +595,7 @@ Int_t AliGenEMlibV2::IpK0short(TRandom *)
 Double_t AliGenEMlibV2::PtK0short( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0s]->Eval(pt);
+  return EvalPtParametrization(kK0s, pt);
 }
 
 Double_t AliGenEMlibV2::YK0short( const Double_t *py, const Double_t */*dummy*/ )
@@ -626,7 +629,7 @@ Int_t AliGenEMlibV2::IpK0long(TRandom *)
 Double_t AliGenEMlibV2::PtK0long( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0l]->Eval(pt);
+  return EvalPtParametrization(kK0l, pt);
 }
 
 Double_t AliGenEMlibV2::YK0long( const Double_t *py, const Double_t */*dummy*/ )
@@ -660,7 +663,7 @@ Int_t AliGenEMlibV2::IpLambda(TRandom *)
 Double_t AliGenEMlibV2::PtLambda( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kLambda]->Eval(pt);
+  return EvalPtParametrization(kLambda, pt);
 }
 
 Double_t AliGenEMlibV2::YLambda( const Double_t *py, const Double_t */*dummy*/ )
@@ -694,7 +697,7 @@ Int_t AliGenEMlibV2::IpDeltaPlPl(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaPlPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaPlPl]->Eval(pt);
+  return EvalPtParametrization(kDeltaPlPl, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaPlPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -728,7 +731,7 @@ Int_t AliGenEMlibV2::IpDeltaPl(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaPl]->Eval(pt);
+  return EvalPtParametrization(kDeltaPl, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -762,7 +765,7 @@ Int_t AliGenEMlibV2::IpDeltaMi(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaMi]->Eval(pt);
+  return EvalPtParametrization(kDeltaMi, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -796,7 +799,7 @@ Int_t AliGenEMlibV2::IpDeltaZero(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaZero( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaZero]->Eval(pt);
+  return EvalPtParametrization(kDeltaZero, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaZero( const Double_t *py, const Double_t */*dummy*/ )
@@ -830,7 +833,7 @@ Int_t AliGenEMlibV2::IpRhoPl(TRandom *)
 Double_t AliGenEMlibV2::PtRhoPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRhoPl]->Eval(pt);
+  return EvalPtParametrization(kRhoPl, pt);
 }
 
 Double_t AliGenEMlibV2::YRhoPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -864,7 +867,7 @@ Int_t AliGenEMlibV2::IpRhoMi(TRandom *)
 Double_t AliGenEMlibV2::PtRhoMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRhoMi]->Eval(pt);
+  return EvalPtParametrization(kRhoMi, pt);
 }
 
 Double_t AliGenEMlibV2::YRhoMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -898,7 +901,7 @@ Int_t AliGenEMlibV2::IpK0star(TRandom *)
 Double_t AliGenEMlibV2::PtK0star( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0star]->Eval(pt);
+  return EvalPtParametrization(kK0star, pt);
 }
 
 Double_t AliGenEMlibV2::YK0star( const Double_t *py, const Double_t */*dummy*/ )
@@ -932,7 +935,7 @@ Int_t AliGenEMlibV2::IpKPl(TRandom *)
 Double_t AliGenEMlibV2::PtKPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kKPl]->Eval(pt);
+  return EvalPtParametrization(kKPl, pt);
 }
 
 Double_t AliGenEMlibV2::YKPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -965,7 +968,7 @@ Int_t AliGenEMlibV2::IpKMi(TRandom *)
 Double_t AliGenEMlibV2::PtKMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kKMi]->Eval(pt);
+  return EvalPtParametrization(kKMi, pt);
 }
 
 Double_t AliGenEMlibV2::YKMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -997,7 +1000,7 @@ Int_t AliGenEMlibV2::IpOmegaPl(TRandom *)
 Double_t AliGenEMlibV2::PtOmegaPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kOmegaPl]->Eval(pt);
+  return EvalPtParametrization(kOmegaPl, pt);
 }
 
 Double_t AliGenEMlibV2::YOmegaPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -1025,7 +1028,7 @@ Int_t AliGenEMlibV2::IpOmegaMi(TRandom *)
 Double_t AliGenEMlibV2::PtOmegaMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kOmegaMi]->Eval(pt);
+  return EvalPtParametrization(kOmegaMi, pt);
 }
 
 Double_t AliGenEMlibV2::YOmegaMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -1053,7 +1056,7 @@ Int_t AliGenEMlibV2::IpXiPl(TRandom *)
 Double_t AliGenEMlibV2::PtXiPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kXiPl]->Eval(pt);
+  return EvalPtParametrization(kXiPl, pt);
 }
 
 Double_t AliGenEMlibV2::YXiPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -1081,7 +1084,7 @@ Int_t AliGenEMlibV2::IpXiMi(TRandom *)
 Double_t AliGenEMlibV2::PtXiMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kXiMi]->Eval(pt);
+  return EvalPtParametrization(kXiMi, pt);
 }
 
 Double_t AliGenEMlibV2::YXiMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -1109,7 +1112,7 @@ Int_t AliGenEMlibV2::IpSigmaPl(TRandom *)
 Double_t AliGenEMlibV2::PtSigmaPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kSigmaPl]->Eval(pt);
+  return EvalPtParametrization(kSigmaPl, pt);
 }
 
 Double_t AliGenEMlibV2::YSigmaPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -1137,7 +1140,7 @@ Int_t AliGenEMlibV2::IpSigmaMi(TRandom *)
 Double_t AliGenEMlibV2::PtSigmaMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kSigmaMi]->Eval(pt);
+  return EvalPtParametrization(kSigmaMi, pt);
 }
 
 Double_t AliGenEMlibV2::YSigmaMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -1242,6 +1245,179 @@ TF1* AliGenEMlibV2::MtScal(Int_t np, TString name, Bool_t isMeson)
 }
 
 
+//--------------------------------------------------------------------------
+//
+//                     Tabulated pt parametrizations
+//
+//--------------------------------------------------------------------------
+Bool_t AliGenEMlibV2::SetPtTables(Double_t ptMin, Double_t ptMax, Double_t accuracy)
+{
+  // tabulate the pt parametrizations of all particles between ptMin and
+  // ptMax, see SetPtTable. Tables are dropped when the parametrizations change.
+
+  ResetPtTables();
+  if (ptMin<0) ptMin = 0;
+  if (ptMax<=ptMin || accuracy<=0) return kFALSE;
+  for (Int_t np=0; np<26; np++) {
+    if (fPtParametrization[np]) SetPtTable(np, ptMin, ptMax, accuracy);
+  }
+  return kTRUE;
+}
+
+//--------------------------------------------------------------------------
+Bool_t AliGenEMlibV2::SetPtTable(Int_t np, Double_t ptMin, Double_t ptMax, Double_t accuracy)
+{
+  // tabulate the pt parametrization of particle np between ptMin and ptMax,
+  // such that the linear interpolation between the nodes agrees with the
+  // parametrization within the relative accuracy; the cumulative integral is
+  // kept to size the sampling tables of the sources. An existing table is
+  // kept if it covers the range, otherwise it is rebuilt over both ranges.
+
+  if (np<0 || np>=26 || !fPtParametrization[np]) return kFALSE;
+  if (ptMin<0) ptMin = 0;
+  if (ptMax<=ptMin || accuracy<=0) return kFALSE;
+  if (HasPtTable(np)) {
+    if (fPtTableX[np].front()<=ptMin && fPtTableX[np].back()>=ptMax) return kTRUE;
+    ptMin = TMath::Min(ptMin, fPtTableX[np].front());
+    ptMax = TMath::Max(ptMax, fPtTableX[np].back());
+  }
+  fPtTableX[np].clear();
+  fPtTableY[np].clear();
+  fPtTableCDF[np].clear();
+
+  const Int_t nStart      = 64;
+  const Double_t minWidth = (ptMax-ptMin)*1e-6;
+  Double_t step           = (ptMax-ptMin)/nStart;
+  Double_t x0 = ptMin;
+  Double_t y0 = fPtParametrization[np]->Eval(x0);
+  fPtTableX[np].push_back(x0);
+  fPtTableY[np].push_back(y0);
+  for (Int_t i=1; i<=nStart; i++) {
+    Double_t x1 = (i==nStart) ? ptMax : ptMin+i*step;
+    Double_t y1 = fPtParametrization[np]->Eval(x1);
+    RefinePtTable(np, x0, y0, x1, y1, accuracy, minWidth);
+    x0 = x1;
+    y0 = y1;
+  }
+
+  Int_t nNodes = fPtTableX[np].size();
+  fPtTableCDF[np].resize(nNodes);
+  fPtTableCDF[np][0] = 0;
+  for (Int_t i=1; i<nNodes; i++)
+    fPtTableCDF[np][i] = fPtTableCDF[np][i-1] + 0.5*(fPtTableY[np][i-1]+fPtTableY[np][i])*(fPtTableX[np][i]-fPtTableX[np][i-1]);
+
+  AliDebugClass(1,Form("pt table %d: %d nodes in %.1f-%.1f GeV/c for %.1e accuracy", np, nNodes, ptMin, ptMax, accuracy));
+  return kTRUE;
+}
+
+//--------------------------------------------------------------------------
+void AliGenEMlibV2::RefinePtTable(Int_t np, Double_t x0, Double_t y0, Double_t x1, Double_t y1, Double_t accuracy, Double_t minWidth)
+{
+  // add the nodes up to x1, bisecting the interval as long as the linear
+  // interpolation at the center differs from the parametrization
+
+  Double_t xm = 0.5*(x0+x1);
+  Double_t ym = fPtParametrization[np]->Eval(xm);
+  Double_t scale = TMath::Max(TMath::Abs(ym), 1e-300);
+  if (x1-x0>2*minWidth && TMath::Abs(0.5*(y0+y1)-ym)>accuracy*scale) {
+    RefinePtTable(np, x0, y0, xm, ym, accuracy, minWidth);
+    RefinePtTable(np, xm, ym, x1, y1, accuracy, minWidth);
+    return;
+  }
+  fPtTableX[np].push_back(x1);
+  fPtTableY[np].push_back(y1);
+}
+
+//--------------------------------------------------------------------------
+void AliGenEMlibV2::ResetPtTables()
+{
+  for (Int_t np=0; np<26; np++) {
+    fPtTableX[np].clear();
+    fPtTableY[np].clear();
+    fPtTableCDF[np].clear();
+  }
+}
+
+//--------------------------------------------------------------------------
+Bool_t AliGenEMlibV2::HasPtTable(Int_t np)
+{
+  return np>=0 && np<26 && fPtTableX[np].size()>1;
+}
+
+//--------------------------------------------------------------------------
+Double_t AliGenEMlibV2::EvalPtParametrization(Int_t np, Double_t pt)
+{
+  // pt parametrization of particle np, interpolated in the table if
+  // available, outside of the table the parametrization is evaluated
+
+  if (!HasPtTable(np) || pt<fPtTableX[np].front() || pt>fPtTableX[np].back())
+    return fPtParametrization[np]->Eval(pt);
+
+  const std::vector<Double_t>& x = fPtTableX[np];
+  const std::vector<Double_t>& y = fPtTableY[np];
+  Int_t i = TMath::BinarySearch((Long64_t)x.size(), &x[0], pt);
+  if (i>=(Int_t)x.size()-1) return y.back();
+  return y[i] + (y[i+1]-y[i])*(pt-x[i])/(x[i+1]-x[i]);
+}
+
+//--------------------------------------------------------------------------
+Double_t AliGenEMlibV2::IntegralPtTable(Int_t np, Double_t ptMin, Double_t ptMax)
+{
+  // integral of the tabulated pt parametrization of particle np,
+  // the range is restricted to the table
+
+  if (!HasPtTable(np)) return 0;
+
+  const std::vector<Double_t>& x   = fPtTableX[np];
+  const std::vector<Double_t>& y   = fPtTableY[np];
+  const std::vector<Double_t>& cdf = fPtTableCDF[np];
+  Int_t n = x.size();
+  Double_t cut[2]      = {TMath::Min(TMath::Max(ptMin, x[0]), x[n-1]), TMath::Min(TMath::Max(ptMax, x[0]), x[n-1])};
+  Double_t integral[2] = {0, 0};
+  for (Int_t j=0; j<2; j++) {
+    Int_t i = TMath::BinarySearch((Long64_t)n, &x[0], cut[j]);
+    if (i>=n-1) {
+      integral[j] = cdf[n-1];
+      continue;
+    }
+    Double_t dx = cut[j]-x[i];
+    Double_t slope = (y[i+1]-y[i])/(x[i+1]-x[i]);
+    integral[j] = cdf[i] + dx*(y[i] + 0.5*slope*dx);
+  }
+  return integral[1]-integral[0];
+}
+
+//--------------------------------------------------------------------------
+Int_t AliGenEMlibV2::GetPtTableNpx(Int_t np, Double_t ptMin, Double_t ptMax, Double_t accuracy)
+{
+  // number of equidistant points needed by TF1::GetRandom to reproduce the
+  // cumulative pt distribution of particle np within the accuracy (relative
+  // to the total yield), using linear interpolation within each point as
+  // conservative estimate; 0 if there is no table
+
+  if (!HasPtTable(np) || ptMax<=ptMin || accuracy<=0) return 0;
+  Double_t total = IntegralPtTable(np, ptMin, ptMax);
+  if (total<=0) return 0;
+
+  const Int_t maxNpx = 100000;
+  Int_t npx = 100;
+  for (; npx<maxNpx; npx*=2) {
+    Double_t width = (ptMax-ptMin)/npx;
+    Double_t maxDeviation = 0;
+    Double_t cdf0 = 0;
+    for (Int_t i=0; i<npx && maxDeviation<=accuracy*total; i++) {
+      Double_t x0 = ptMin+i*width;
+      Double_t cdfm = cdf0 + IntegralPtTable(np, x0, x0+0.5*width);
+      Double_t cdf1 = cdfm + IntegralPtTable(np, x0+0.5*width, x0+width);
+      maxDeviation = TMath::Max(maxDeviation, TMath::Abs(0.5*(cdf0+cdf1)-cdfm));
+      cdf0 = cdf1;
+    }
+    if (maxDeviation<=accuracy*total) break;
+  }
+  return TMath::Min(npx, maxNpx);
+}
+
+
 //--------------------------------------------------------------------------
 //
 //                             Et-scaling
@@ -1327,6 +1503,9 @@ Double_t AliGenEMlibV2::GetTAA(Int_t cent){
 //--------------------------------------------------------------------------
 Bool_t AliGenEMlibV2::SetPtParametrizations(TString fileName, TString dirName) {
 
+  // tables of previous parametrizations are invalid
+  ResetPtTables();
+
   // open parametrizations file
   TFile* fParametrizationFile = TFile::Open(fileName.Data());
   if (!fParametrizationFile) AliFatalClass(Form("File %s not found",fileName.Data()));
@@ -14,6 +14,7 @@
 //                                                                         //
 /////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
 #include "AliGenLib.h"
 #include "TRandom.h"
 #include "TObject.h"
@@ -69,6 +70,14 @@ public:
   static TH1D*  GetMtScalingFactors();
   static TH2F*  GetPtYDistribution(Int_t np);
 
+  // Tabulated pt parametrizations
+  static Bool_t   SetPtTables(Double_t ptMin, Double_t ptMax, Double_t accuracy);
+  static Bool_t   SetPtTable(Int_t np, Double_t ptMin, Double_t ptMax, Double_t accuracy);
+  static void     ResetPtTables();
+  static Bool_t   HasPtTable(Int_t np);
+  static Double_t EvalPtParametrization(Int_t np, Double_t pt);
+  static Int_t    GetPtTableNpx(Int_t np, Double_t ptMin, Double_t ptMax, Double_t accuracy);
+
   static Int_t fgSelectedCollisionsSystem;                                                      // selected pT parameter
   static Int_t fgSelectedCentrality;                                                            // selected Centrality
   static Int_t fgSelectedV2Systematic;                                                          // selected v2 systematics, usefully values: -1,0,1
@@ -273,6 +282,12 @@ private:
   static TH2F*    fPtYDistribution[26];       // pt-y distributions
   static TF1*     fV2Parametrization[27];     // pt paramtrizations
   static Int_t    fV2RefParameterization[27]; // ID of a hadron used for parameterization of V2 for Et scaling
+  static std::vector<Double_t> fPtTableX[26];   // pt nodes of the tabulated pt parametrizations
+  static std::vector<Double_t> fPtTableY[26];   // pt parametrizations at the nodes
+  static std::vector<Double_t> fPtTableCDF[26]; // integral of the tabulated pt parametrizations up to the nodes
+
+  static Double_t IntegralPtTable(Int_t np, Double_t ptMin, Double_t ptMax);
+  static void     RefinePtTable(Int_t np, Double_t x0, Double_t y0, Double_t x1, Double_t y1, Double_t accuracy, Double_t minWidth);
 
   ClassDef(AliGenEMlibV2,7);
 };
@@ -50,6 +50,7 @@
 #include "AliYAMLConfiguration.h"
 #include "AliEmcalList.h"
 #include "AliEmcalContainerUtils.h"
+#include "AliEmcalEmbeddingSelectionIndex.h"
 
 #include "AliAnalysisTaskEmcalEmbeddingHelper.h"
 
@@ -169,7 +170,11 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fUseSelectionIndex(false),
+  fPrefetchSelectionIndex(true),
+  fSelectionIndex(nullptr),
+  fRejectedBySelectionIndex(false)
 {
   if (fgInstance != nullptr) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -243,7 +248,11 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fUseSelectionIndex(false),
+  fPrefetchSelectionIndex(true),
+  fSelectionIndex(nullptr),
+  fRejectedBySelectionIndex(false)
 {
   if (fgInstance != 0) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -266,6 +275,7 @@ AliAnalysisTaskEmcalEmbeddingHelper::~AliAnalysisTaskEmcalEmbeddingHelper()
 {
   if (fgInstance == this) fgInstance = nullptr;
   if (fExternalEvent) delete fExternalEvent;
+  if (fSelectionIndex) delete fSelectionIndex;
   if (fExternalFile) {
     fExternalFile->Close();
     delete fExternalFile;
@@ -328,6 +338,8 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RetrieveTaskPropertiesFromYAMLConfig()
   res = fYAMLConfig.GetProperty("randomFileAccess", fRandomFileAccess, false);
   res = fYAMLConfig.GetProperty("createHisto", fCreateHisto, false);
   res = fYAMLConfig.GetProperty("printTimingInfoInLog", fPrintTimingInfoToLog, false);
+  res = fYAMLConfig.GetProperty("useSelectionIndex", fUseSelectionIndex, false);
+  res = fYAMLConfig.GetProperty("prefetchSelectionIndex", fPrefetchSelectionIndex, false);
   // More general embedding helper properties
   res = fYAMLConfig.GetProperty("filePattern", fFilePattern, false);
   res = fYAMLConfig.GetProperty("inputFilename", fInputFilename, false);
@@ -844,12 +856,9 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
       InitTree();
     }
 
-    // Load current event
+    // Check that there are files left
     // Can be a simple less than, because fFileNumber counts from 0.
-    if (fFileNumber < fMaxNumberOfFiles) {
-      fChain->GetEntry(fCurrentEntry);
-    }
-    else {
+    if (fFileNumber >= fMaxNumberOfFiles) {
       AliError("====================================================================================================");
       AliError("== No more files available to embed from the TChain! Restarting from the beginning of the TChain! ==");
       AliError("== Be careful to check that this is the desired action!                                           ==");
@@ -861,16 +870,19 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
       fUpperEntry = 0;
 
       // Re-init back to the start
+      // We are certain that fFileNumber is less than fMaxNumberOfFiles afterwards, so we are resetting to start
       InitTree();
+    }
 
-      // Access the relevant entry
-      // We are certain that fFileNumber is less than fMaxNumberOfFiles, so we are resetting to start
+    // Load current event, unless the selection index already tells that it is rejected
+    fRejectedBySelectionIndex = IsRejectedBySelectionIndex();
+    if (!fRejectedBySelectionIndex) {
+      AliDebug(4, TString::Format("Loading entry %i between %i-%i, starting with offset %i from the lower bound of %i", fCurrentEntry, fLowerEntry, fUpperEntry, fOffset, fLowerEntry));
       fChain->GetEntry(fCurrentEntry);
-    }
-    AliDebug(4, TString::Format("Loading entry %i between %i-%i, starting with offset %i from the lower bound of %i", fCurrentEntry, fLowerEntry, fUpperEntry, fOffset, fLowerEntry));
 
-    // Set relevant event properties
-    SetEmbeddedEventProperties();
+      // Set relevant event properties
+      SetEmbeddedEventProperties();
+    }
 
     // Increment current entry
     fCurrentEntry++;
@@ -955,7 +967,7 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RecordEmbeddedEventProperties()
  */
 Bool_t AliAnalysisTaskEmcalEmbeddingHelper::IsEventSelected()
 {
-  if (CheckIsEmbeddedEventSelected()) {
+  if (!fRejectedBySelectionIndex && CheckIsEmbeddedEventSelected()) {
     return kTRUE;
   }
 
@@ -1079,6 +1091,72 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected()
   return kTRUE;
 }
 
+/**
+ * Applies the embedded event selection to the current entry using the selection index, without
+ * reading the event. It follows CheckIsEmbeddedEventSelected(), such that the same entries are rejected
+ * and the same rejection histograms are filled. For rejected entries, the pythia properties are taken
+ * from the index so that they can be recorded. Entries which are not rejected here are read and go
+ * through the full event selection.
+ *
+ * @return kTRUE if the current entry is rejected according to the selection index.
+ */
+Bool_t AliAnalysisTaskEmcalEmbeddingHelper::IsRejectedBySelectionIndex()
+{
+  if (!fUseSelectionIndex || !fSelectionIndex) return kFALSE;
+
+  const AliEmcalEmbeddingSelectionIndex::Entry_t * entry = fSelectionIndex->GetEntry(fCurrentEntry - fLowerEntry);
+  if (!entry) return kFALSE;
+
+  // Same order as in CheckIsEmbeddedEventSelected()
+  std::string rejection = "";
+  if (entry->fRejection & AliEmcalEmbeddingSelectionIndex::kPtHardIs0) {
+    rejection = "PtHardIs0";
+  }
+  else if (entry->fRejection & AliEmcalEmbeddingSelectionIndex::kPhysSel) {
+    rejection = "PhysSel";
+  }
+  else {
+    const AliVVertex *inputVert = AliAnalysisTaskSE::InputEvent()->GetPrimaryVertex();
+    if (entry->fHasVertex && inputVert) {
+      Double_t inputVertex[3]={0};
+      inputVert->GetXYZ(inputVertex);
+      const Double_t * externalVertex = entry->fVertex;
+      Double_t dist = TMath::Sqrt((externalVertex[0]-inputVertex[0])*(externalVertex[0]-inputVertex[0])+(externalVertex[1]-inputVertex[1])*(externalVertex[1]-inputVertex[1])+(externalVertex[2]-inputVertex[2])*(externalVertex[2]-inputVertex[2]));
+      if (TMath::Abs(externalVertex[2]) > fZVertexCut) {
+        rejection = "Vz";
+      }
+      else if (dist > fMaxVertexDist) {
+        rejection = "VertexDist";
+      }
+    }
+    if (rejection == "" && (entry->fRejection & AliEmcalEmbeddingSelectionIndex::kMCOutlier)) {
+      rejection = "MCOutlier";
+    }
+  }
+
+  if (rejection == "") return kFALSE;
+
+  AliDebugStream(3) << "Entry " << fCurrentEntry << " rejected from the selection index (" << rejection << ") without being read.\n";
+  if (fCreateHisto) {
+    fHistManager.FillTH1("fHistEmbeddedEventRejection", rejection.c_str(), 1);
+  }
+
+  // Event properties, as in SetEmbeddedEventProperties()
+  if (entry->fHasPythiaHeader) {
+    fPythiaCrossSection = entry->fCrossSection;
+    fPythiaTrials = entry->fTrials;
+    fPythiaPtHard = entry->fPtHard;
+    if (fPythiaCrossSection == 0.) {
+      fPythiaCrossSection = fPythiaCrossSectionFromFile;
+    }
+    if (fPythiaTrials == 0.) {
+      fPythiaTrials = fPythiaTrialsFromFile;
+    }
+  }
+
+  return kTRUE;
+}
+
 /**
  * Initialize the external event by creating an event and then reading the event info from the TChain.
  *
@@ -1448,6 +1526,9 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
   // Fine to be += as long as we started at 0
   fUpperEntry += fChain->GetTree()->GetEntries();
 
+  // Selection variables of the entries of the new tree
+  InitSelectionIndex();
+
   // Jump ahead at random if desired
   // Determines the offset into the tree
   if (fRandomEventNumberAccess) {
@@ -1510,6 +1591,51 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
 
 }
 
+/**
+ * Makes the selection index of the current tree available, if enabled, and starts building the index
+ * of the next file in the TChain in the background if prefetching is enabled. The order of the files
+ * and entries is not changed, such that the embedded events are the same as without the index.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::InitSelectionIndex()
+{
+  if (!fUseSelectionIndex) return;
+
+  if (!fSelectionIndex) {
+    if (!dynamic_cast<AliAODEvent*>(fExternalEvent)) {
+      AliWarning("The selection index is only available when embedding AODs. Disabling it!");
+      fUseSelectionIndex = false;
+      return;
+    }
+    fSelectionIndex = new AliEmcalEmbeddingSelectionIndex();
+    fSelectionIndex->SetTriggerMask(fTriggerMask);
+    fSelectionIndex->SetPtHardJetPtRejectionFactor(fMCRejectOutliers ? fPtHardJetPtRejectionFactor : 0.);
+  }
+
+  // The title of the chain elements is the filename
+  TObjArray * files = fChain->GetListOfFiles();
+  Int_t treeNumber = fChain->GetTreeNumber();
+  if (treeNumber < 0 || treeNumber >= files->GetEntries()) {
+    fSelectionIndex->Clear();
+    return;
+  }
+  std::string filename = files->At(treeNumber)->GetTitle();
+
+  if (!fSelectionIndex->Load(filename, fTreeName.Data())) {
+    AliWarningStream() << "Could not build the selection index for file \"" << filename << "\". All of its entries will be read.\n";
+  }
+  else if (fSelectionIndex->GetNEntries() != fUpperEntry - fLowerEntry) {
+    AliWarningStream() << "Selection index for file \"" << filename << "\" has " << fSelectionIndex->GetNEntries() << " entries, but the tree has " << fUpperEntry - fLowerEntry << ". All of its entries will be read.\n";
+    fSelectionIndex->Clear();
+  }
+  AliDebugStream(2) << "Selection index: " << fSelectionIndex->GetNEntries() << " entries, " << fSelectionIndex->GetNPrefetched() << " indices prefetched, " << fSelectionIndex->GetBytesRead() << " bytes read so far.\n";
+
+  // Next file in the TChain, wrapping around as in GetNextEntry()
+  if (fPrefetchSelectionIndex && files->GetEntries() > 1) {
+    Int_t nextTreeNumber = (treeNumber + 1) % files->GetEntries();
+    fSelectionIndex->Prefetch(files->At(nextTreeNumber)->GetTitle(), fTreeName.Data());
+  }
+}
+
 /**
  * Extract pythia information from a cross section file. Modified from AliAnalysisTaskEmcal::PythiaInfoFromFile().
  *
@@ -1889,6 +2015,8 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::toString(bool includeFileList)
   tempSS << "File list filename: \"" << fFileListFilename << "\"\n";
   tempSS << "Tree name: " << fTreeName << "\n";
   tempSS << "Print timing info to log: " << fPrintTimingInfoToLog << "\n";
+  tempSS << "Use selection index: " << fUseSelectionIndex << "\n";
+  tempSS << "Prefetch selection index: " << fPrefetchSelectionIndex << "\n";
   tempSS << "Random event number access: " << fRandomEventNumberAccess << "\n";
   tempSS << "Random file access: " << fRandomFileAccess << "\n";
   tempSS << "Starting file index: " << fFilenameIndex << "\n";
@@ -23,6 +23,7 @@ class AliVEvent;
 class AliVHeader;
 class AliGenPythiaEventHeader;
 class AliEmcalList;
+class AliEmcalEmbeddingSelectionIndex;
 
 #include <iosfwd>
 #include <vector>
@@ -116,6 +117,8 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t GetStartingFileIndex()                              const { return fFilenameIndex; }
   TString GetFileListFilename()                             const { return fFileListFilename; }
   bool GetCreateHistos()                                    const { return fCreateHisto; }
+  bool GetUseSelectionIndex()                               const { return fUseSelectionIndex; }
+  bool GetPrefetchSelectionIndex()                          const { return fPrefetchSelectionIndex; }
 
   // Set
   /// Set the pt hard bin which will be added into the file pattern. Can also be omitted and set directly in the pattern.
@@ -148,6 +151,15 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetFileListFilename(const char * filename)                 { fFileListFilename = filename; }
   /// Create QA histograms. These are necessary for proper scaling, so be careful disabling them!
   void SetCreateHistos(bool b)                                    { fCreateHisto = b; }
+  /**
+   * Enable the selection index (AOD only). When a file is opened, the variables of the embedded event
+   * selection are read for all of its entries from the header, vertices and MC header branches. Entries
+   * which are rejected are then skipped without reading the full event. The embedded events are the same
+   * as without the index.
+   */
+  void SetUseSelectionIndex(bool b = true)                        { fUseSelectionIndex = b; }
+  /// Build the selection index of the next file in a background thread while the current file is embedded
+  void SetPrefetchSelectionIndex(bool b = true)                   { fPrefetchSelectionIndex = b; }
   /// Set path to %YAML configuration file
   void SetConfigurationPath(const char * path)                    { fConfigurationPath = path; }
   /* @} */
@@ -296,9 +308,11 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void            SetEmbeddedEventProperties();
   void            RecordEmbeddedEventProperties();
   Bool_t          IsEventSelected()     ;
+  Bool_t          IsRejectedBySelectionIndex();
   virtual Bool_t  CheckIsEmbeddedEventSelected();
   Bool_t          InitEvent()           ;
   void            InitTree()            ;
+  void            InitSelectionIndex()  ;
   bool            PythiaInfoFromCrossSectionFile(std::string filename);
   // Validation helper
   void            ValidatePhysicsSelectionForInternalEventSelection();
@@ -375,6 +389,11 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   bool                                          fPrintTimingInfoToLog; ///< Flag to print time to execute InitTree(), for logging purposes
   TStopwatch                                    fTimer            ;    //!<! Timer for the InitTree() function
 
+  bool                                          fUseSelectionIndex; ///<  If true, skip the entries rejected according to the selection index of each file
+  bool                                     fPrefetchSelectionIndex; ///<  If true, build the selection index of the next file in a background thread
+  AliEmcalEmbeddingSelectionIndex              *fSelectionIndex   ; //!<! Selection variables of the entries of the current file
+  bool                                   fRejectedBySelectionIndex; //!<! The current entry was rejected using the selection index and was not read
+
   static AliAnalysisTaskEmcalEmbeddingHelper   *fgInstance        ; //!<! Global instance of this class
 
  private:
@@ -382,7 +401,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 12);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 13);
   /// \endcond
 };
 #endif
@@ -35,6 +35,7 @@
 
 // EMCAL includes
 #include "AliEMCALRecoUtils.h"
+#include "AliEMCALTrackExtrapolationCache.h"
 #include "AliEMCALGeometry.h"
 #include "AliTrackerBase.h"
 #include "AliEMCALPIDUtils.h"
@@ -73,6 +74,7 @@ AliEMCALRecoUtils::AliEMCALRecoUtils():
   fStepSurface(0),                        fStepCluster(0),
   fITSTrackSA(kFALSE),                    fUseTrackDCA(kTRUE), // keep it active, but not working for old MC
   fUseOuterTrackParam(kFALSE),            fEMCalSurfaceDistance(440.),
+  fUseTrackExtrapolationCache(kFALSE),
   fTrackCutsType(0),                      fCutMinTrackPt(0),                      fCutMinNClusterTPC(0), 
   fCutMinNClusterITS(0),                  fCutMaxChi2PerClusterTPC(0),            fCutMaxChi2PerClusterITS(0),
   fCutRequireTPCRefit(kFALSE),            fCutRequireITSRefit(kFALSE),            fCutAcceptKinkDaughters(kFALSE),
@@ -141,6 +143,7 @@ AliEMCALRecoUtils::AliEMCALRecoUtils(const AliEMCALRecoUtils & reco)
   fMass(reco.fMass),        fStepSurface(reco.fStepSurface), fStepCluster(reco.fStepCluster),
   fITSTrackSA(reco.fITSTrackSA),                             fUseTrackDCA(reco.fUseTrackDCA),
   fUseOuterTrackParam(reco.fUseOuterTrackParam),             fEMCalSurfaceDistance(440.),
+  fUseTrackExtrapolationCache(reco.fUseTrackExtrapolationCache),
   fTrackCutsType(reco.fTrackCutsType),                       fCutMinTrackPt(reco.fCutMinTrackPt), 
   fCutMinNClusterTPC(reco.fCutMinNClusterTPC),               fCutMinNClusterITS(reco.fCutMinNClusterITS), 
   fCutMaxChi2PerClusterTPC(reco.fCutMaxChi2PerClusterTPC),   fCutMaxChi2PerClusterITS(reco.fCutMaxChi2PerClusterITS),
@@ -255,6 +258,7 @@ AliEMCALRecoUtils & AliEMCALRecoUtils::operator = (const AliEMCALRecoUtils & rec
   fUseTrackDCA               = reco.fUseTrackDCA;
   fUseOuterTrackParam        = reco.fUseOuterTrackParam;
   fEMCalSurfaceDistance      = reco.fEMCalSurfaceDistance;
+  fUseTrackExtrapolationCache = reco.fUseTrackExtrapolationCache;
   
   fTrackCutsType             = reco.fTrackCutsType;
   fCutMinTrackPt             = reco.fCutMinTrackPt;
@@ -2149,6 +2153,8 @@ void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
   for (Int_t iCell = 0; iCell < nEMcell; iCell++) 
   { 
     cells->GetCell( iCell, absId, ecellin, tcellin, mclabel, efrac );
+    // GetCellHighGain() takes the absolute ID, GetHighGain() the position in the list
+    Bool_t isHG = cells->GetHighGain(iCell);
     
     accept = AcceptCalibrateCell(absId, bc, ecell ,tcell ,cells); 
     if (!accept)
@@ -2157,8 +2163,8 @@ void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
       tcell = -1;
     }
     
-    // Set new values
-    cells->SetCell(iCell,absId,ecell, tcell, mclabel, efrac);
+    // Set new values, keeping the gain of the cell
+    cells->SetCell(iCell,absId,ecell, tcell, mclabel, efrac, isHG);
   }
 
   fCellsRecalibrated = kTRUE;
@@ -3288,9 +3294,19 @@ void AliEMCALRecoUtils::FindMatches(AliVEvent *event,
     }
     
     // Extrapolate the track to EMCal surface, see AliEMCALRecoUtilsBase
+    // If requested, reuse the extrapolation done by another consumer for the same track in this event
     AliExternalTrackParam emcalParam(*trackParam);
     Float_t eta, phi, pt;
-    if (!ExtrapolateTrackToEMCalSurface(&emcalParam, fEMCalSurfaceDistance, fMass, fStepSurface, eta, phi, pt)) 
+    Bool_t extrapolated = kFALSE;
+    if ( fUseTrackExtrapolationCache )
+    {
+      const AliVTrack *track = esdTrack ? static_cast<AliVTrack*>(esdTrack) : static_cast<AliVTrack*>(aodTrack);
+      extrapolated = AliEMCALTrackExtrapolationCache::Instance()->ExtrapolateTrackToEMCalSurface(track, &emcalParam, fEMCalSurfaceDistance, fMass, fStepSurface, eta, phi, pt);
+    }
+    else
+      extrapolated = ExtrapolateTrackToEMCalSurface(&emcalParam, fEMCalSurfaceDistance, fMass, fStepSurface, eta, phi, pt);
+
+    if (!extrapolated) 
     {
       if (aodevent    && trackParam) delete trackParam;
       if (fITSTrackSA && trackParam) delete trackParam;
@@ -4318,6 +4334,7 @@ void AliEMCALRecoUtils::Print(const Option_t *) const
   }
 
   printf("\tMass hypothesis = %2.3f [GeV/c^2], extrapolation step to surface = %2.2f[cm], step to cluster = %2.2f[cm]\n",fMass,fStepSurface, fStepCluster);
+  printf("\tUse shared track extrapolation cache: %d\n",fUseTrackExtrapolationCache);
   printf("\tCluster selection window: dR < %2.0f\n",fClusterWindow);
 
   printf("\tTrack cuts: \n");
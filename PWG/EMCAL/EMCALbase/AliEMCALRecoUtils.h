@@ -403,6 +403,8 @@ public:
   void     SetITSTrackSA(Bool_t isITS)                { fITSTrackSA = isITS           ; } //Special Handle of AliExternTrackParam    
   void     SwitchOnOuterTrackParam()                  { fUseOuterTrackParam = kTRUE   ; } 
   void     SwitchOffOuterTrackParam()                 { fUseOuterTrackParam = kFALSE  ; } 
+  void     SwitchOnTrackExtrapolationCache()          { fUseTrackExtrapolationCache = kTRUE  ; }
+  void     SwitchOffTrackExtrapolationCache()         { fUseTrackExtrapolationCache = kFALSE ; }
   
   
   // Track Cuts 
@@ -602,6 +604,7 @@ private:
   Bool_t     fUseTrackDCA;               ///< Activate use of aodtrack->GetXYZ or XvYxZv like in AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface 
   Bool_t     fUseOuterTrackParam;        ///< Use OuterTrackParam not InnerTrackParam, ESDs
   Double_t   fEMCalSurfaceDistance;      ///< EMCal surface distance (= 430 by default, the last 10 cm are propagated on a cluster-track pair basis)
+  Bool_t     fUseTrackExtrapolationCache;///< Share the extrapolation to the EMCal surface with other consumers, see AliEMCALTrackExtrapolationCache
  
   // Track cuts  
   Int_t      fTrackCutsType;             ///< ESD track cuts type for matching, see enum TrackCutsType
@@ -625,7 +628,7 @@ private:
   Bool_t     fMCGenerToAcceptForTrack;   ///<  Activate the removal of tracks entering the track matching that come from a particular generator
   
   /// \cond CLASSIMP
-  ClassDef(AliEMCALRecoUtils, 33) ;
+  ClassDef(AliEMCALRecoUtils, 34) ;
   /// \endcond
 
 };
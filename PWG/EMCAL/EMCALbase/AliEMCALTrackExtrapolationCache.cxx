@@ -0,0 +1,390 @@
+// --- ROOT system ---
+#include <TMath.h>
+#include <TTree.h>
+#include <TVector2.h>
+
+// --- AliRoot/AliPhysics header files ---
+#include "AliAnalysisManager.h"
+#include "AliExternalTrackParam.h"
+#include "AliTrackerBase.h"
+#include "AliVTrack.h"
+#include "AliLog.h"
+#include "AliEMCALRecoUtils.h"
+
+#include "AliEMCALTrackExtrapolationCache.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEMCALTrackExtrapolationCache) ;
+/// \endcond
+
+AliEMCALTrackExtrapolationCache* AliEMCALTrackExtrapolationCache::fgInstance = 0x0;
+
+namespace {
+  const Int_t    kNTableValues   = 4;     // delta eta, delta phi, pt ratio, status per node
+  const Double_t kTableEtaMax    = 0.9;   // eta range of the fast path table
+  const Double_t kTableVzMax     = 10.;   // vertex z range of the fast path table (cm)
+  const Double_t kTableRefPhi    = 2.3;   // reference phi if the table has a single phi node (EMCal center)
+}
+
+///
+/// \return the singleton instance of the cache.
+///
+//_____________________________________________________________________________
+AliEMCALTrackExtrapolationCache* AliEMCALTrackExtrapolationCache::Instance()
+{
+  if (!fgInstance) fgInstance = new AliEMCALTrackExtrapolationCache();
+  return fgInstance;
+}
+
+///
+/// Constructor. Default fast path binning is 24 nodes in q/pT, 10 in eta,
+/// 1 in phi (azimuthal symmetry of the field assumed) and 5 in vertex z.
+///
+//_____________________________________________________________________________
+AliEMCALTrackExtrapolationCache::AliEMCALTrackExtrapolationCache() :
+  TObject(),
+  fCurrentEntry(-1), fCurrentTree(0x0),
+  fTrackEntries(), fParamEntries(),
+  fFastPathField(-1), fFastPathSettings(), fFastPathTable(),
+  fNHits(0), fNMisses(0), fNFastPath(0)
+{
+  fFastPathNBins[0] = 24;
+  fFastPathNBins[1] = 10;
+  fFastPathNBins[2] = 1;
+  fFastPathNBins[3] = 5;
+
+  fFastPathSettings.fEmcalR = -1;
+}
+
+///
+/// Clear all cached extrapolations.
+///
+//_____________________________________________________________________________
+void AliEMCALTrackExtrapolationCache::Reset()
+{
+  fTrackEntries.clear();
+  fParamEntries.clear();
+}
+
+///
+/// Set the number of nodes of the fast path table. The number of q/pT nodes
+/// should be even, such that q/pT = 0 is not a node. A single phi node means
+/// that the table is assumed to be independent of phi.
+///
+//_____________________________________________________________________________
+void AliEMCALTrackExtrapolationCache::SetFastPathBinning(Int_t nInvPt, Int_t nEta, Int_t nPhi, Int_t nVz)
+{
+  fFastPathNBins[0] = TMath::Max(2, nInvPt);
+  fFastPathNBins[1] = TMath::Max(2, nEta);
+  fFastPathNBins[2] = TMath::Max(1, nPhi);
+  fFastPathNBins[3] = TMath::Max(2, nVz);
+  fFastPathTable.clear();
+}
+
+///
+/// \return true if the cached surface position of the track was obtained with the fast path.
+///
+//_____________________________________________________________________________
+Bool_t AliEMCALTrackExtrapolationCache::IsFastPathResult(const AliVTrack *track) const
+{
+  auto it = fTrackEntries.find(track);
+  if (it == fTrackEntries.end()) return kFALSE;
+  return it->second.fFastPath;
+}
+
+///
+/// Clear the cache if the analysis manager moved to another event.
+///
+//_____________________________________________________________________________
+void AliEMCALTrackExtrapolationCache::CheckEvent()
+{
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr) return;
+
+  Long64_t entry = mgr->GetCurrentEntry();
+  TTree *tree = mgr->GetTree();
+  if (entry != fCurrentEntry || tree != fCurrentTree)
+  {
+    Reset();
+    fCurrentEntry = entry;
+    fCurrentTree  = tree;
+  }
+}
+
+///
+/// Cached version of AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(AliVTrack*, ...).
+/// The surface position is stored in the track, as for the full extrapolation.
+///
+/// \param track: track to be extrapolated
+/// \param emcalR, mass, step, minpT, useMassForTracking, useDCA, useOuterParam: see AliEMCALRecoUtilsBase
+/// \param fastPathMargin: if >= 0, allow the approximate fast path for tracks whose surface
+///        position is farther than this margin (in eta and phi) from the acceptance edges
+///
+/// \return true if the track was extrapolated
+///
+//_____________________________________________________________________________
+Bool_t AliEMCALTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(AliVTrack *track,
+                                                                        Double_t emcalR, Double_t mass, Double_t step,
+                                                                        Double_t minpT, Bool_t useMassForTracking,
+                                                                        Bool_t useDCA, Bool_t useOuterParam,
+                                                                        Double_t fastPathMargin)
+{
+  if (!track) return kFALSE;
+
+  CheckEvent();
+
+  Settings_t settings = { emcalR, mass, step, minpT, useMassForTracking, useDCA, useOuterParam };
+
+  auto it = fTrackEntries.find(track);
+  if (it != fTrackEntries.end())
+  {
+    const TrackEntry_t &entry = it->second;
+    if (entry.fSettings == settings && entry.fID == track->GetID() &&
+        entry.fInPt == track->Pt() && entry.fInEta == track->Eta() && entry.fInPhi == track->Phi() &&
+        (!entry.fFastPath || fastPathMargin >= 0))
+    {
+      fNHits++;
+      track->SetTrackPhiEtaPtOnEMCal(entry.fPhi, entry.fEta, entry.fPt);
+      return entry.fResult;
+    }
+  }
+
+  TrackEntry_t entry;
+  entry.fSettings = settings;
+  entry.fID       = track->GetID();
+  entry.fInPt     = track->Pt();
+  entry.fInEta    = track->Eta();
+  entry.fInPhi    = track->Phi();
+  entry.fFastPath = kFALSE;
+
+  Double_t eta = -999, phi = -999, pt = -999;
+  if (fastPathMargin >= 0 && FastExtrapolation(track, settings, eta, phi, pt) && IsInsideAcceptance(eta, phi, fastPathMargin))
+  {
+    fNFastPath++;
+    track->SetTrackPhiEtaPtOnEMCal(phi, eta, pt);
+    entry.fResult   = kTRUE;
+    entry.fFastPath = kTRUE;
+  }
+  else
+  {
+    fNMisses++;
+    entry.fResult = AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, emcalR, mass, step, minpT, useMassForTracking, useDCA, useOuterParam);
+  }
+
+  entry.fEta = track->GetTrackEtaOnEMCal();
+  entry.fPhi = track->GetTrackPhiOnEMCal();
+  entry.fPt  = track->GetTrackPtOnEMCal();
+  fTrackEntries[track] = entry;
+
+  return entry.fResult;
+}
+
+///
+/// Cached version of AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(AliExternalTrackParam*, ...),
+/// for consumers which start from their own track parameters and need the propagated parameters.
+/// The entry is only reused if the input parameters are identical.
+///
+/// \param track: track the parameters belong to, used as key (no caching if null)
+/// \param trkParam: track parameters, propagated to the EMCal surface in place
+/// \param emcalR, mass, step: see AliEMCALRecoUtilsBase
+/// \param eta, phi, pt: position and momentum at the EMCal surface
+///
+/// \return true if the track was extrapolated
+///
+//_____________________________________________________________________________
+Bool_t AliEMCALTrackExtrapolationCache::ExtrapolateTrackToEMCalSurface(const AliVTrack *track, AliExternalTrackParam *trkParam,
+                                                                        Double_t emcalR, Double_t mass, Double_t step,
+                                                                        Float_t &eta, Float_t &phi, Float_t &pt)
+{
+  if (!trkParam) return kFALSE;
+
+  if (!track) return AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(trkParam, emcalR, mass, step, eta, phi, pt);
+
+  CheckEvent();
+
+  Settings_t settings = { emcalR, mass, step, 0., kFALSE, kFALSE, kFALSE };
+  const Double_t *inPar = trkParam->GetParameter();
+
+  auto it = fParamEntries.find(track);
+  if (it != fParamEntries.end())
+  {
+    const ParamEntry_t &entry = it->second;
+    Bool_t same = entry.fSettings == settings && entry.fID == track->GetID() &&
+      entry.fInX == trkParam->GetX() && entry.fInAlpha == trkParam->GetAlpha();
+    for (Int_t i = 0; i < 5 && same; i++) same = (entry.fInPar[i] == inPar[i]);
+
+    if (same)
+    {
+      fNHits++;
+      trkParam->Set(entry.fOutX, entry.fOutAlpha, entry.fOutPar, entry.fOutCov);
+      eta = entry.fEta;
+      phi = entry.fPhi;
+      pt  = entry.fPt;
+      return entry.fResult;
+    }
+  }
+
+  ParamEntry_t entry;
+  entry.fSettings = settings;
+  entry.fID       = track->GetID();
+  entry.fInX      = trkParam->GetX();
+  entry.fInAlpha  = trkParam->GetAlpha();
+  for (Int_t i = 0; i < 5; i++) entry.fInPar[i] = inPar[i];
+
+  fNMisses++;
+  entry.fResult = AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(trkParam, emcalR, mass, step, eta, phi, pt);
+
+  entry.fOutX     = trkParam->GetX();
+  entry.fOutAlpha = trkParam->GetAlpha();
+  for (Int_t i = 0; i < 5;  i++) entry.fOutPar[i] = trkParam->GetParameter()[i];
+  for (Int_t i = 0; i < 15; i++) entry.fOutCov[i] = trkParam->GetCovariance()[i];
+  entry.fEta = eta;
+  entry.fPhi = phi;
+  entry.fPt  = pt;
+  fParamEntries[track] = entry;
+
+  return entry.fResult;
+}
+
+///
+/// Conservative EMCal and DCal acceptance used to decide whether a fast path
+/// result can be used. Close to the edges the full propagation is done, such
+/// that the acceptance cuts of the consumers are not affected by the approximation.
+///
+//_____________________________________________________________________________
+Bool_t AliEMCALTrackExtrapolationCache::IsInsideAcceptance(Double_t eta, Double_t phi, Double_t margin)
+{
+  if (TMath::Abs(eta) > 0.7 - margin) return kFALSE;
+
+  phi = TVector2::Phi_0_2pi(phi);
+  if (phi > 80*TMath::DegToRad() + margin && phi < 187*TMath::DegToRad() - margin) return kTRUE;
+  if (phi > 260*TMath::DegToRad() + margin && phi < 327*TMath::DegToRad() - margin) return kTRUE;
+  return kFALSE;
+}
+
+///
+/// Approximate surface position from the fast path table (multilinear interpolation).
+///
+/// \return false if the track is outside of the table or next to a node where the full propagation failed
+///
+//_____________________________________________________________________________
+Bool_t AliEMCALTrackExtrapolationCache::FastExtrapolation(const AliVTrack *track, const Settings_t &settings,
+                                                           Double_t &eta, Double_t &phi, Double_t &pt)
+{
+  if (settings.fUseMassForTracking || settings.fMass <= 0 || settings.fMinPt <= 0) return kFALSE;
+
+  Int_t charge = track->Charge();
+  Double_t trackPt = track->Pt();
+  if (charge == 0 || trackPt < settings.fMinPt) return kFALSE;
+
+  // The table is filled for the current settings and solenoid field
+  Int_t field = TMath::Nint(AliTrackerBase::GetBz()*1000);
+  if (fFastPathTable.empty() || fFastPathField != field || !(fFastPathSettings == settings))
+  {
+    fFastPathField = field;
+    BuildFastPathTable(settings);
+  }
+
+  const Double_t invPtMax = 1./settings.fMinPt;
+  Double_t x[4] = { charge/trackPt, track->Eta(), TVector2::Phi_0_2pi(track->Phi()), track->Zv() };
+  const Double_t lo[4] = { -invPtMax, -kTableEtaMax, 0., -kTableVzMax };
+  const Double_t hi[4] = {  invPtMax,  kTableEtaMax, TMath::TwoPi(), kTableVzMax };
+
+  Int_t i0[4], i1[4];
+  Double_t f[4];
+  for (Int_t iaxis = 0; iaxis < 4; iaxis++)
+  {
+    Int_t n = fFastPathNBins[iaxis];
+    if (iaxis == 2)
+    { // periodic in phi
+      if (n == 1) { i0[iaxis] = i1[iaxis] = 0; f[iaxis] = 0; continue; }
+      Double_t t = x[iaxis]/TMath::TwoPi()*n;
+      i0[iaxis] = TMath::FloorNint(t) % n;
+      i1[iaxis] = (i0[iaxis] + 1) % n;
+      f[iaxis]  = t - TMath::Floor(t);
+      continue;
+    }
+    Double_t t = (x[iaxis] - lo[iaxis])/(hi[iaxis] - lo[iaxis])*(n - 1);
+    if (t < 0 || t > n - 1) return kFALSE;
+    i0[iaxis] = TMath::Min(TMath::FloorNint(t), n - 2);
+    i1[iaxis] = i0[iaxis] + 1;
+    f[iaxis]  = t - i0[iaxis];
+  }
+
+  Double_t value[3] = { 0., 0., 0. };
+  for (Int_t corner = 0; corner < 16; corner++)
+  {
+    Double_t w = 1.;
+    Int_t idx[4];
+    for (Int_t iaxis = 0; iaxis < 4; iaxis++)
+    {
+      Bool_t upper = (corner >> iaxis) & 1;
+      idx[iaxis] = upper ? i1[iaxis] : i0[iaxis];
+      w *= upper ? f[iaxis] : 1. - f[iaxis];
+    }
+    if (w <= 0) continue;
+
+    Int_t node = ((idx[0]*fFastPathNBins[1] + idx[1])*fFastPathNBins[2] + idx[2])*fFastPathNBins[3] + idx[3];
+    const Float_t *v = &fFastPathTable[kNTableValues*node];
+    if (v[3] < 0.5) return kFALSE;
+    for (Int_t i = 0; i < 3; i++) value[i] += w*v[i];
+  }
+
+  eta = x[1] + value[0];
+  phi = TVector2::Phi_0_2pi(x[2] + value[1]);
+  pt  = trackPt*value[2];
+  return kTRUE;
+}
+
+///
+/// Fill the fast path table with full propagations of reference tracks starting at
+/// (0, 0, vz) for all nodes in (q/pT, eta, phi, vertex z).
+///
+//_____________________________________________________________________________
+void AliEMCALTrackExtrapolationCache::BuildFastPathTable(const Settings_t &settings)
+{
+  fFastPathSettings = settings;
+
+  const Int_t nInvPt = fFastPathNBins[0], nEta = fFastPathNBins[1], nPhi = fFastPathNBins[2], nVz = fFastPathNBins[3];
+  fFastPathTable.assign(kNTableValues*nInvPt*nEta*nPhi*nVz, 0.);
+
+  AliInfo(Form("Filling track extrapolation fast path table with %d x %d x %d x %d nodes", nInvPt, nEta, nPhi, nVz));
+
+  const Double_t invPtMax = 1./settings.fMinPt;
+  Double_t cv[21] = { 0. };
+  for (Int_t iq = 0; iq < nInvPt; iq++)
+  {
+    Double_t invPt = -invPtMax + 2*invPtMax*iq/(nInvPt - 1);
+    if (TMath::Abs(invPt) < 1e-3) invPt = invPt < 0 ? -1e-3 : 1e-3;
+    Short_t sign = invPt > 0 ? 1 : -1;
+    Double_t ptNode = 1./TMath::Abs(invPt);
+
+    for (Int_t ie = 0; ie < nEta; ie++)
+    {
+      Double_t etaNode = -kTableEtaMax + 2*kTableEtaMax*ie/(nEta - 1);
+      for (Int_t ip = 0; ip < nPhi; ip++)
+      {
+        Double_t phiNode = nPhi == 1 ? kTableRefPhi : TMath::TwoPi()*ip/nPhi;
+        for (Int_t iv = 0; iv < nVz; iv++)
+        {
+          Double_t vzNode = -kTableVzMax + 2*kTableVzMax*iv/(nVz - 1);
+
+          Double_t xyz[3]    = { 0., 0., vzNode };
+          Double_t pxpypz[3] = { ptNode*TMath::Cos(phiNode), ptNode*TMath::Sin(phiNode), ptNode*TMath::SinH(etaNode) };
+          AliExternalTrackParam param(xyz, pxpypz, cv, sign);
+
+          Float_t eta = -999, phi = -999, pt = -999;
+          Bool_t ok = AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&param, settings.fEmcalR, settings.fMass, settings.fStep, eta, phi, pt);
+
+          Int_t node = ((iq*nEta + ie)*nPhi + ip)*nVz + iv;
+          Float_t *v = &fFastPathTable[kNTableValues*node];
+          if (!ok || pt <= 0) continue;
+          v[0] = eta - etaNode;
+          v[1] = TVector2::Phi_mpi_pi(phi - phiNode);
+          v[2] = pt/ptNode;
+          v[3] = 1.;
+        }
+      }
+    }
+  }
+}
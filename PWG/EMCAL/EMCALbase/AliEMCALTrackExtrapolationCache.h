@@ -0,0 +1,145 @@
+#ifndef ALIEMCALTRACKEXTRAPOLATIONCACHE_H
+#define ALIEMCALTRACKEXTRAPOLATIONCACHE_H
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// \class AliEMCALTrackExtrapolationCache
+/// \ingroup EMCALUtils
+/// \brief Per-event cache of track extrapolations to the EMCal surface.
+///
+/// The extrapolation of a track to the EMCal surface is done with the full
+/// material-aware propagation in AliEMCALRecoUtilsBase, and is repeated by each
+/// consumer doing cluster-track matching in the same event (correction framework,
+/// AliEMCALRecoUtils::FindMatches, AliCaloTrackMatcher, ...). This singleton keeps
+/// the result per track object for the current event, such that the propagation is
+/// only done once per track and set of extrapolation settings.
+///
+/// Entries are keyed by the track pointer and are only reused if the track ID,
+/// the input kinematics (or input track parameters) and the extrapolation settings
+/// are identical, so a hit gives exactly the result of the full propagation. The
+/// cache is cleared whenever the analysis manager moves to another entry.
+///
+/// Optionally, an approximate fast path can be requested per call: the surface
+/// position is interpolated in a table of full propagations of reference tracks in
+/// (q/pT, eta, phi, vertex z), filled once per field setting. The fast result is only used if
+/// it is farther than a given margin from the EMCal/DCal acceptance edges; otherwise
+/// the full propagation is done. The fast path is not available for consumers which
+/// need the propagated track parameters.
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#include <unordered_map>
+#include <vector>
+
+#include <TObject.h>
+
+class TTree;
+class AliVTrack;
+class AliExternalTrackParam;
+
+class AliEMCALTrackExtrapolationCache : public TObject {
+
+public:
+
+  static AliEMCALTrackExtrapolationCache* Instance();
+
+  virtual ~AliEMCALTrackExtrapolationCache() {}
+
+  Bool_t   ExtrapolateTrackToEMCalSurface(AliVTrack *track,
+                                          Double_t emcalR = 440, Double_t mass = 0.1396, Double_t step = 20,
+                                          Double_t minpT = 0.35, Bool_t useMassForTracking = kFALSE,
+                                          Bool_t useDCA = kFALSE, Bool_t useOuterParam = kFALSE,
+                                          Double_t fastPathMargin = -1);
+
+  Bool_t   ExtrapolateTrackToEMCalSurface(const AliVTrack *track, AliExternalTrackParam *trkParam,
+                                          Double_t emcalR, Double_t mass, Double_t step,
+                                          Float_t &eta, Float_t &phi, Float_t &pt);
+
+  void     Reset();
+
+  void     SetFastPathBinning(Int_t nInvPt, Int_t nEta, Int_t nPhi, Int_t nVz);
+
+  Bool_t   IsFastPathResult(const AliVTrack *track) const;
+  ULong64_t GetNHits()                         const { return fNHits       ; }
+  ULong64_t GetNMisses()                       const { return fNMisses     ; }
+  ULong64_t GetNFastPath()                     const { return fNFastPath   ; }
+
+private:
+
+  AliEMCALTrackExtrapolationCache();
+  AliEMCALTrackExtrapolationCache(const AliEMCALTrackExtrapolationCache&);
+  AliEMCALTrackExtrapolationCache& operator=(const AliEMCALTrackExtrapolationCache&);
+
+  /// Extrapolation settings, entries are only reused for identical settings
+  struct Settings_t {
+    Double_t fEmcalR;
+    Double_t fMass;
+    Double_t fStep;
+    Double_t fMinPt;
+    Bool_t   fUseMassForTracking;
+    Bool_t   fUseDCA;
+    Bool_t   fUseOuterParam;
+    Bool_t operator==(const Settings_t &o) const {
+      return fEmcalR == o.fEmcalR && fMass == o.fMass && fStep == o.fStep && fMinPt == o.fMinPt &&
+        fUseMassForTracking == o.fUseMassForTracking && fUseDCA == o.fUseDCA && fUseOuterParam == o.fUseOuterParam;
+    }
+  };
+
+  /// Surface position of a track (AliVTrack interface)
+  struct TrackEntry_t {
+    Settings_t fSettings;
+    Int_t      fID;
+    Double_t   fInPt;
+    Double_t   fInEta;
+    Double_t   fInPhi;
+    Bool_t     fResult;
+    Bool_t     fFastPath;
+    Double_t   fEta;
+    Double_t   fPhi;
+    Double_t   fPt;
+  };
+
+  /// Propagated track parameters (AliExternalTrackParam interface)
+  struct ParamEntry_t {
+    Settings_t fSettings;
+    Int_t      fID;
+    Double_t   fInX;
+    Double_t   fInAlpha;
+    Double_t   fInPar[5];
+    Bool_t     fResult;
+    Double_t   fOutX;
+    Double_t   fOutAlpha;
+    Double_t   fOutPar[5];
+    Double_t   fOutCov[15];
+    Float_t    fEta;
+    Float_t    fPhi;
+    Float_t    fPt;
+  };
+
+  void     CheckEvent();
+  Bool_t   FastExtrapolation(const AliVTrack *track, const Settings_t &settings, Double_t &eta, Double_t &phi, Double_t &pt);
+  void     BuildFastPathTable(const Settings_t &settings);
+  static Bool_t IsInsideAcceptance(Double_t eta, Double_t phi, Double_t margin);
+
+  Long64_t fCurrentEntry;                                           //!<! Analysis manager entry of the cached event
+  TTree   *fCurrentTree;                                            //!<! Analysis manager tree of the cached event
+  std::unordered_map<const AliVTrack*, TrackEntry_t> fTrackEntries; //!<! Surface positions per track
+  std::unordered_map<const AliVTrack*, ParamEntry_t> fParamEntries; //!<! Propagated parameters per track
+
+  Int_t    fFastPathNBins[4];                                       //!<! Number of nodes in q/pT, eta, phi, vertex z
+  Int_t    fFastPathField;                                          //!<! Solenoid field (0.001 kG) for which the fast path table was filled
+  Settings_t fFastPathSettings;                                     //!<! Settings used to fill the fast path table
+  std::vector<Float_t> fFastPathTable;                              //!<! Per node: delta eta, delta phi, pt ratio, status
+
+  ULong64_t fNHits;                                                 //!<! Number of cache hits
+  ULong64_t fNMisses;                                               //!<! Number of full propagations
+  ULong64_t fNFastPath;                                             //!<! Number of fast path extrapolations
+
+  static AliEMCALTrackExtrapolationCache *fgInstance;              //!<! Singleton instance
+
+  /// \cond CLASSIMP
+  ClassDef(AliEMCALTrackExtrapolationCache, 1) ;
+  /// \endcond
+};
+
+#endif // ALIEMCALTRACKEXTRAPOLATIONCACHE_H
@@ -0,0 +1,275 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <memory>
+
+#include <TClonesArray.h>
+#include <TFile.h>
+#include <TLorentzVector.h>
+#include <TROOT.h>
+#include <TString.h>
+#include <TTree.h>
+
+#include <AliAODHeader.h>
+#include <AliAODMCHeader.h>
+#include <AliAODVertex.h>
+#include <AliGenPythiaEventHeader.h>
+
+#include "AliEmcalEmbeddingSelectionIndex.h"
+
+/**
+ * Default constructor
+ */
+AliEmcalEmbeddingSelectionIndex::AliEmcalEmbeddingSelectionIndex() :
+  fTriggerMask(0),
+  fPtHardJetPtRejectionFactor(0.),
+  fFilename(),
+  fEntries(),
+  fBytesRead(0),
+  fNPrefetched(0),
+  fPrefetchThread(),
+  fPrefetchFilename(),
+  fPrefetchEntries(),
+  fPrefetchBytesRead(0),
+  fPrefetchSuccess(false)
+{
+}
+
+/**
+ * Destructor. Waits for the index being prefetched, if any.
+ */
+AliEmcalEmbeddingSelectionIndex::~AliEmcalEmbeddingSelectionIndex()
+{
+  WaitForPrefetch();
+}
+
+/**
+ * Build the index of a file in the current thread.
+ *
+ * @param[in] filename Path to the file to embed
+ * @param[in] treeName Name of the AOD tree
+ * @return true if the index was built. Otherwise, the index is left empty.
+ */
+bool AliEmcalEmbeddingSelectionIndex::Build(const std::string & filename, const std::string & treeName)
+{
+  Clear();
+
+  std::vector<Entry_t> entries;
+  Long64_t bytesRead = 0;
+  bool success = Fill(filename, treeName, entries, bytesRead);
+  fBytesRead += bytesRead;
+  if (success) {
+    fEntries.swap(entries);
+    fFilename = filename;
+  }
+
+  return success;
+}
+
+/**
+ * Start building the index of a file in a background thread. It is picked up by
+ * the next call to Load() for the same file. A prefetch which is still running is
+ * waited for first.
+ *
+ * @param[in] filename Path to the file to embed
+ * @param[in] treeName Name of the AOD tree
+ */
+void AliEmcalEmbeddingSelectionIndex::Prefetch(const std::string & filename, const std::string & treeName)
+{
+  WaitForPrefetch();
+
+  ROOT::EnableThreadSafety();
+
+  fPrefetchFilename = filename;
+  fPrefetchEntries.clear();
+  fPrefetchBytesRead = 0;
+  fPrefetchSuccess = false;
+  fPrefetchThread = std::thread([this, filename, treeName]() {
+    fPrefetchSuccess = Fill(filename, treeName, fPrefetchEntries, fPrefetchBytesRead);
+  });
+}
+
+/**
+ * Make the index of a file current. The prefetched index is used if it corresponds
+ * to the file, otherwise the index is built in the current thread.
+ *
+ * @param[in] filename Path to the file to embed
+ * @param[in] treeName Name of the AOD tree
+ * @return true if the index is available
+ */
+bool AliEmcalEmbeddingSelectionIndex::Load(const std::string & filename, const std::string & treeName)
+{
+  if (filename == fFilename) return true;
+
+  WaitForPrefetch();
+
+  if (fPrefetchSuccess && fPrefetchFilename == filename) {
+    fEntries.swap(fPrefetchEntries);
+    fFilename = filename;
+    fBytesRead += fPrefetchBytesRead;
+    fNPrefetched++;
+
+    fPrefetchFilename = "";
+    fPrefetchEntries.clear();
+    fPrefetchBytesRead = 0;
+    fPrefetchSuccess = false;
+    return true;
+  }
+
+  return Build(filename, treeName);
+}
+
+/**
+ * Drop the current index. The prefetched index is kept.
+ */
+void AliEmcalEmbeddingSelectionIndex::Clear()
+{
+  fFilename = "";
+  fEntries.clear();
+}
+
+/**
+ * Wait for the background thread building the next index, if any.
+ */
+void AliEmcalEmbeddingSelectionIndex::WaitForPrefetch()
+{
+  if (fPrefetchThread.joinable()) {
+    fPrefetchThread.join();
+  }
+}
+
+/**
+ * Evaluate the selection variables of an event. It follows
+ * AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected() for the selections
+ * which do not depend on the internal event.
+ *
+ * @param[in] header AOD header of the event
+ * @param[in] vertex Primary vertex of the event. Can be null.
+ * @param[in] mcHeader AOD MC header of the event. Can be null.
+ * @param[out] entry Selection variables of the event
+ */
+void AliEmcalEmbeddingSelectionIndex::Evaluate(AliVAODHeader * header, const AliAODVertex * vertex, AliAODMCHeader * mcHeader, Entry_t & entry) const
+{
+  entry.fVertex[0] = entry.fVertex[1] = entry.fVertex[2] = 0.;
+  entry.fPtHard = 0.;
+  entry.fCrossSection = 0.;
+  entry.fTrials = 0;
+  entry.fHasVertex = kFALSE;
+  entry.fHasPythiaHeader = kFALSE;
+  entry.fRejection = 0;
+
+  AliGenPythiaEventHeader * pythiaHeader = nullptr;
+  if (mcHeader) {
+    for (UInt_t i = 0; i < mcHeader->GetNCocktailHeaders(); i++) {
+      pythiaHeader = dynamic_cast<AliGenPythiaEventHeader*>(mcHeader->GetCocktailHeader(i));
+      if (pythiaHeader) break;
+    }
+  }
+
+  if (pythiaHeader) {
+    entry.fHasPythiaHeader = kTRUE;
+    entry.fPtHard = pythiaHeader->GetPtHard();
+    entry.fCrossSection = pythiaHeader->GetXsection();
+    entry.fTrials = pythiaHeader->Trials();
+
+    if (entry.fPtHard == 0.) {
+      entry.fRejection |= kPtHardIs0;
+    }
+  }
+
+  if (fTriggerMask != 0) {
+    UInt_t res = header ? header->GetOfflineTrigger() : 0;
+    if ((res & fTriggerMask) == 0) {
+      entry.fRejection |= kPhysSel;
+    }
+  }
+
+  if (vertex) {
+    entry.fHasVertex = kTRUE;
+    vertex->GetXYZ(entry.fVertex);
+  }
+
+  if (pythiaHeader && fPtHardJetPtRejectionFactor > 0.) {
+    TLorentzVector jet;
+    Float_t tmpjet[] = {0, 0, 0, 0};
+    for (Int_t iJet = 0; iJet < pythiaHeader->NTriggerJets(); iJet++) {
+      pythiaHeader->TriggerJet(iJet, tmpjet);
+      jet.SetPxPyPzE(tmpjet[0], tmpjet[1], tmpjet[2], tmpjet[3]);
+      if (jet.Pt() > fPtHardJetPtRejectionFactor * entry.fPtHard) {
+        entry.fRejection |= kMCOutlier;
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * Read the selection variables of all entries of a file. Only the header, vertices and
+ * MC header branches are read. It does not log, such that it can run in a background thread.
+ *
+ * @param[in] filename Path to the file to embed
+ * @param[in] treeName Name of the AOD tree
+ * @param[out] entries Selection variables, one per tree entry
+ * @param[out] bytesRead Number of bytes read from the file
+ * @return true if successful
+ */
+bool AliEmcalEmbeddingSelectionIndex::Fill(const std::string & filename, const std::string & treeName, std::vector<Entry_t> & entries, Long64_t & bytesRead) const
+{
+  entries.clear();
+  bytesRead = 0;
+
+  std::unique_ptr<TFile> file(TFile::Open(filename.c_str()));
+  if (!file || file->IsZombie()) return false;
+
+  TTree * tree = dynamic_cast<TTree*>(file->Get(treeName.c_str()));
+  if (!tree || !tree->GetBranch("header") || !tree->GetBranch("vertices")) return false;
+
+  AliAODHeader * header = nullptr;
+  TClonesArray * vertices = nullptr;
+  AliAODMCHeader * mcHeader = nullptr;
+  bool hasMCHeader = (tree->GetBranch(AliAODMCHeader::StdBranchName()) != nullptr);
+
+  tree->SetBranchStatus("*", 0);
+  tree->SetBranchStatus("header*", 1);
+  tree->SetBranchStatus("vertices*", 1);
+  if (tree->SetBranchAddress("header", &header) < 0) return false;
+  if (tree->SetBranchAddress("vertices", &vertices) < 0) return false;
+  if (hasMCHeader) {
+    tree->SetBranchStatus(TString::Format("%s*", AliAODMCHeader::StdBranchName()), 1);
+    if (tree->SetBranchAddress(AliAODMCHeader::StdBranchName(), &mcHeader) < 0) return false;
+  }
+
+  bool success = true;
+  Long64_t nEntries = tree->GetEntries();
+  entries.resize(nEntries);
+  for (Long64_t i = 0; i < nEntries; i++) {
+    if (tree->GetEntry(i) <= 0) {
+      success = false;
+      break;
+    }
+    // Same as AliAODEvent::GetPrimaryVertex()
+    const AliAODVertex * vertex = vertices ? static_cast<const AliAODVertex*>(vertices->At(0)) : nullptr;
+    Evaluate(header, vertex, mcHeader, entries[i]);
+  }
+
+  tree->ResetBranchAddresses();
+  delete header;
+  delete vertices;
+  delete mcHeader;
+
+  bytesRead = file->GetBytesRead();
+  if (!success) entries.clear();
+  return success;
+}
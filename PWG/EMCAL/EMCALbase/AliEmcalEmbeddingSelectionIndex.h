@@ -0,0 +1,109 @@
+#ifndef ALIEMCALEMBEDDINGSELECTIONINDEX_H
+#define ALIEMCALEMBEDDINGSELECTIONINDEX_H
+/**
+ * \file AliEmcalEmbeddingSelectionIndex.h
+ * \brief Declaration of class AliEmcalEmbeddingSelectionIndex
+ *
+ * In this header file the class AliEmcalEmbeddingSelectionIndex is declared.
+ * It stores the variables needed for the embedded event selection of all
+ * entries of one file to embed.
+ */
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+class AliVAODHeader;
+class AliAODVertex;
+class AliAODMCHeader;
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Rtypes.h>
+
+/**
+ * \class AliEmcalEmbeddingSelectionIndex
+ * \brief Compact index of the embedded event selection variables of one file
+ *
+ * The index is built by reading only the header, vertices and MC header branches of
+ * an AOD tree, and keeps per entry the pt hard, cross section, trials and primary vertex,
+ * together with the decisions of the selections which do not depend on the internal event
+ * (pt hard = 0, physics selection and MC outlier rejection). It allows
+ * AliAnalysisTaskEmcalEmbeddingHelper to skip rejected entries without reading the full event.
+ *
+ * The index of the next file can be built ahead of use in a background thread with Prefetch().
+ * Load() then picks it up if it corresponds to the requested file, and builds it otherwise.
+ *
+ * Only AOD trees are supported.
+ */
+class AliEmcalEmbeddingSelectionIndex {
+ public:
+  /// Selections decided when building the index
+  enum Rejection_t {
+    kPtHardIs0 = 1<<0,      ///< Pythia header with pt hard = 0
+    kPhysSel = 1<<1,        ///< Rejected by the trigger mask
+    kMCOutlier = 1<<2       ///< Pythia trigger jet above the pt hard rejection factor times pt hard
+  };
+
+  /// Selection variables of one entry
+  struct Entry_t {
+    Double_t fVertex[3];        ///< Primary vertex
+    Double_t fPtHard;           ///< Pt hard from the pythia header
+    Double_t fCrossSection;     ///< Cross section from the pythia header
+    Int_t    fTrials;           ///< Trials from the pythia header
+    Bool_t   fHasVertex;        ///< The event has a primary vertex
+    Bool_t   fHasPythiaHeader;  ///< The event has a pythia header
+    UChar_t  fRejection;        ///< Combination of Rejection_t
+  };
+
+  AliEmcalEmbeddingSelectionIndex();
+  virtual ~AliEmcalEmbeddingSelectionIndex();
+
+  /**
+   * @{
+   * @name Selection applied when building the index, must be set before building
+   */
+  void SetTriggerMask(UInt_t mask)                                { fTriggerMask = mask; }
+  /// Pt hard rejection factor of the MC outliers, disabled if not positive
+  void SetPtHardJetPtRejectionFactor(Double_t factor)             { fPtHardJetPtRejectionFactor = factor; }
+  /* @} */
+
+  bool Build(const std::string & filename, const std::string & treeName);
+  void Prefetch(const std::string & filename, const std::string & treeName);
+  bool Load(const std::string & filename, const std::string & treeName);
+  void Clear();
+
+  void Evaluate(AliVAODHeader * header, const AliAODVertex * vertex, AliAODMCHeader * mcHeader, Entry_t & entry) const;
+
+  const Entry_t * GetEntry(Long64_t entry)                  const { return (entry >= 0 && entry < GetNEntries()) ? &fEntries[entry] : nullptr; }
+  Long64_t GetNEntries()                                    const { return fEntries.size(); }
+  const std::string & GetFilename()                         const { return fFilename; }
+  /// Total number of bytes read to build the indices, including the prefetched ones
+  Long64_t GetBytesRead()                                   const { return fBytesRead; }
+  /// Number of indices which were built ahead of use
+  Int_t GetNPrefetched()                                    const { return fNPrefetched; }
+
+ protected:
+  bool Fill(const std::string & filename, const std::string & treeName, std::vector<Entry_t> & entries, Long64_t & bytesRead) const;
+  void WaitForPrefetch();
+
+  UInt_t                 fTriggerMask;                  ///< Trigger selection mask
+  Double_t               fPtHardJetPtRejectionFactor;   ///< Pt hard rejection factor of the MC outliers
+
+  std::string            fFilename;                     ///< File of the current index
+  std::vector<Entry_t>   fEntries;                      ///< Current index, one per tree entry
+  Long64_t               fBytesRead;                    ///< Bytes read to build the indices
+  Int_t                  fNPrefetched;                  ///< Number of prefetched indices used
+
+  std::thread            fPrefetchThread;               ///< Thread building the next index
+  std::string            fPrefetchFilename;             ///< File of the index being prefetched
+  std::vector<Entry_t>   fPrefetchEntries;              ///< Index being prefetched
+  Long64_t               fPrefetchBytesRead;            ///< Bytes read for the prefetched index
+  bool                   fPrefetchSuccess;              ///< Prefetched index was successfully built
+
+ private:
+  AliEmcalEmbeddingSelectionIndex(const AliEmcalEmbeddingSelectionIndex&);            // not implemented
+  AliEmcalEmbeddingSelectionIndex &operator=(const AliEmcalEmbeddingSelectionIndex&); // not implemented
+};
+#endif
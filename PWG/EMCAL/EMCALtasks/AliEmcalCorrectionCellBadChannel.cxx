@@ -8,6 +8,7 @@
 #include "AliAODEvent.h"
 
 #include "AliEmcalCorrectionCellBadChannel.h"
+#include "AliEmcalCorrectionCellCalibTable.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalCorrectionCellBadChannel);
@@ -153,3 +154,32 @@ Bool_t AliEmcalCorrectionCellBadChannel::CheckIfRunChanged()
   }
   return runChanged;
 }
+
+/**
+ * The bad channel removal can be fused unless the QA histograms are requested.
+ */
+Bool_t AliEmcalCorrectionCellBadChannel::CanFuseCellCorrection()
+{
+  return !fCreateHisto;
+}
+
+/**
+ * Flag the bad channels of the current run in the dense cell table.
+ */
+Bool_t AliEmcalCorrectionCellBadChannel::FillCellCalibTable(AliEmcalCorrectionCellCalibTable & table)
+{
+  Int_t status = 0;
+  for (Int_t absId = 0; absId < table.GetNCells(); absId++)
+  {
+    if (table.GetSuperModule(absId) < 0) continue;
+
+    Bool_t bad = kFALSE;
+    if (fLoad1DBadChMap)
+      bad = fRecoUtils->GetEMCALChannelStatus1D(absId, status);
+    else
+      bad = fRecoUtils->GetEMCALChannelStatus(table.GetSuperModule(absId), table.GetColumn(absId), table.GetRow(absId), status);
+
+    if (bad) table.SetBadChannel(absId);
+  }
+  return kTRUE;
+}
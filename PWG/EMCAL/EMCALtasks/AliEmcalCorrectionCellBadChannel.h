@@ -32,6 +32,11 @@ class AliEmcalCorrectionCellBadChannel : public AliEmcalCorrectionComponent {
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  // Fused cell correction pass
+  Bool_t IsFusableCellComponent() const { return kTRUE; }
+  Bool_t CanFuseCellCorrection();
+  Bool_t FillCellCalibTable(AliEmcalCorrectionCellCalibTable & table);
   
 protected:
   TH1F* fCellEnergyDistBefore;              //!<! cell energy distribution, before bad channel correction
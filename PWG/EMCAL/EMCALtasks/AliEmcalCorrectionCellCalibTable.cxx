@@ -0,0 +1,130 @@
+// AliEmcalCorrectionCellCalibTable
+//
+
+#include <TF1.h>
+#include "AliVCaloCells.h"
+#include "AliEMCALGeometry.h"
+
+#include "AliEmcalCorrectionCellCalibTable.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalCorrectionCellCalibTable);
+/// \endcond
+
+/**
+ * Default constructor
+ */
+AliEmcalCorrectionCellCalibTable::AliEmcalCorrectionCellCalibTable() :
+  fStatus(kEmpty)
+  ,fNCells(0)
+  ,fSuperModule()
+  ,fColumn()
+  ,fRow()
+  ,fBadChannel()
+  ,fEnergyScale()
+  ,fTimeShift()
+  ,fHasTimeShift(kFALSE)
+  ,fEnergyScaleFunction(0)
+  ,fMinCellE(0)
+  ,fMaxCellE(0)
+{
+}
+
+/**
+ * Reset the table to identity constants for all cells of the geometry. Cells which do not exist
+ * in the geometry are flagged as bad, as done by AliEMCALRecoUtils::AcceptCalibrateCell().
+ *
+ * @param[in] geom EMCal geometry of the current run
+ */
+void AliEmcalCorrectionCellCalibTable::Reset(const AliEMCALGeometry * geom)
+{
+  fStatus = kEmpty;
+  fNCells = geom ? geom->GetNCells() : 0;
+  fHasTimeShift = kFALSE;
+  fEnergyScaleFunction = 0;
+  fMinCellE = 0;
+  fMaxCellE = 0;
+
+  fSuperModule.assign(fNCells, -1);
+  fColumn.assign(fNCells, -1);
+  fRow.assign(fNCells, -1);
+  fBadChannel.assign(fNCells, 0);
+  fEnergyScale.assign(fNCells, 1.);
+  fTimeShift.assign(8*fNCells, 0.);
+
+  Int_t iSM = -1, iTower = -1, iIphi = -1, iIeta = -1, iRow = -1, iCol = -1;
+  for (Int_t absId = 0; absId < fNCells; absId++)
+  {
+    if (!geom->GetCellIndex(absId, iSM, iTower, iIphi, iIeta)) {
+      fBadChannel[absId] = 1;
+      continue;
+    }
+    geom->GetCellPhiEtaIndexInSModule(iSM, iTower, iIphi, iIeta, iRow, iCol);
+    fSuperModule[absId] = iSM;
+    fColumn[absId] = iCol;
+    fRow[absId] = iRow;
+  }
+}
+
+/**
+ * Register an energy dependent scale function, which is applied after the energy calibration factor.
+ * Only one function can be registered per table.
+ *
+ * @return kFALSE if a function was already registered
+ */
+Bool_t AliEmcalCorrectionCellCalibTable::SetEnergyScaleFunction(TF1 * function, Double_t minCellE, Double_t maxCellE)
+{
+  if (fEnergyScaleFunction) return kFALSE;
+
+  fEnergyScaleFunction = function;
+  fMinCellE = minCellE;
+  fMaxCellE = maxCellE;
+  return kTRUE;
+}
+
+/**
+ * Apply all constants of the table to the cells in a single pass, and sort the cells afterwards.
+ * Rejected cells get zero energy and a time of -1, as in AliEMCALRecoUtils::RecalibrateCells().
+ *
+ * @param[in,out] cells Cells to be calibrated in place
+ * @param[in] bc Bunch crossing number of the event
+ */
+void AliEmcalCorrectionCellCalibTable::Apply(AliVCaloCells * cells, Int_t bc) const
+{
+  if (!cells) return;
+
+  const Bool_t applyTimeShift = fHasTimeShift && bc >= 0;
+  const Int_t bcPhase = bc >= 0 ? bc%4 : 0;
+
+  Short_t  absId = -1;
+  Double_t ecell = 0;
+  Double_t tcell = 0;
+  Double_t efrac = 0;
+  Int_t  mclabel = -1;
+
+  const Int_t nCells = cells->GetNumberOfCells();
+  for (Int_t iCell = 0; iCell < nCells; iCell++)
+  {
+    cells->GetCell(iCell, absId, ecell, tcell, mclabel, efrac);
+    // NOTE: GetCellHighGain() uses the cell position, not cell index
+    Bool_t cellHighGain = cells->GetHighGain(iCell);
+
+    if (absId < 0 || absId >= fNCells || fBadChannel[absId]) {
+      cells->SetCell(iCell, absId, 0., -1., mclabel, efrac, cellHighGain);
+      continue;
+    }
+
+    ecell *= fEnergyScale[absId];
+    if (fEnergyScaleFunction && ecell > fMinCellE && ecell < fMaxCellE) {
+      Double_t scaled = ecell * fEnergyScaleFunction->Eval(ecell);
+      if (scaled > 0.) ecell = scaled;
+    }
+
+    if (applyTimeShift)
+      tcell -= fTimeShift[8*absId + 4*(!cellHighGain) + bcPhase];
+
+    cells->SetCell(iCell, absId, ecell, tcell, mclabel, efrac, cellHighGain);
+  }
+
+  cells->Sort();
+}
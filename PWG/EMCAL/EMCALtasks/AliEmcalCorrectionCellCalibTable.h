@@ -0,0 +1,80 @@
+#ifndef ALIEMCALCORRECTIONCELLCALIBTABLE_H
+#define ALIEMCALCORRECTIONCELLCALIBTABLE_H
+
+#include <vector>
+
+#include <Rtypes.h>
+
+class TF1;
+class AliVCaloCells;
+class AliEMCALGeometry;
+
+/**
+ * @class AliEmcalCorrectionCellCalibTable
+ * @ingroup EMCALCORRECTIONFW
+ * @brief Dense per-run table of cell calibration constants for the fused cell correction pass.
+ *
+ * The cell components which support fusing (bad channel removal, energy calibration, energy variation
+ * and time calibration) fill their constants into this table when the run changes. The table is indexed
+ * by absolute cell ID and holds the bad channel flag, the energy scale and the time shift for each of the
+ * four bunch crossing phases (separately for high and low gain). The table is then applied to the cells
+ * in a single pass per event, instead of one pass (and one set of histogram lookups) per component.
+ *
+ * See AliEmcalCorrectionTask for how the fused pass is steered.
+ */
+
+class AliEmcalCorrectionCellCalibTable {
+ public:
+  /**
+   * @enum TableStatus_t
+   * @brief Status of the table for the current run
+   */
+  enum TableStatus_t {
+    kEmpty = 0,    //!<! Table must be (re)filled
+    kFilled = 1,   //!<! Table is filled and can be applied
+    kUnusable = 2  //!<! Components cannot be fused for this run, fall back to running them one by one
+  };
+
+  AliEmcalCorrectionCellCalibTable();
+  virtual ~AliEmcalCorrectionCellCalibTable() {}
+
+  void Reset(const AliEMCALGeometry * geom);
+
+  TableStatus_t GetStatus() const                        { return fStatus; }
+  void SetStatus(TableStatus_t status)                   { fStatus = status; }
+  Int_t GetNCells() const                                { return fNCells; }
+
+  /// Super module of the cell, -1 if the cell does not exist in the geometry
+  Int_t GetSuperModule(Int_t absId) const                { return fSuperModule[absId]; }
+  Int_t GetColumn(Int_t absId) const                     { return fColumn[absId]; }
+  Int_t GetRow(Int_t absId) const                        { return fRow[absId]; }
+
+  void SetBadChannel(Int_t absId)                        { fBadChannel[absId] = 1; }
+  void ScaleEnergy(Int_t absId, Float_t factor)          { fEnergyScale[absId] *= factor; }
+  /// Add a shift (in s) which is subtracted from the cell time for the given BC%4 and gain
+  void AddTimeShift(Int_t absId, Int_t bc, Bool_t isLowGain, Double_t shift) { fTimeShift[8*absId + 4*isLowGain + bc] += shift; fHasTimeShift = kTRUE; }
+  Bool_t SetEnergyScaleFunction(TF1 * function, Double_t minCellE, Double_t maxCellE);
+  Bool_t HasEnergyScaleFunction() const                  { return fEnergyScaleFunction != 0; }
+
+  void Apply(AliVCaloCells * cells, Int_t bc) const;
+
+ private:
+  TableStatus_t          fStatus;                 ///< Status of the table for the current run
+  Int_t                  fNCells;                 ///< Number of cells in the geometry
+  std::vector<Short_t>   fSuperModule;            ///< Super module per absId (-1 for non-existing cells)
+  std::vector<Short_t>   fColumn;                 ///< Column (eta) index in super module per absId
+  std::vector<Short_t>   fRow;                    ///< Row (phi) index in super module per absId
+  std::vector<UChar_t>   fBadChannel;             ///< Bad channel flag per absId
+  std::vector<Float_t>   fEnergyScale;            ///< Energy calibration factor per absId
+  std::vector<Double_t>  fTimeShift;              ///< Time shift per absId, 4 BCs for high gain followed by 4 BCs for low gain
+  Bool_t                 fHasTimeShift;           ///< True if any component filled time shifts
+  TF1                   *fEnergyScaleFunction;    //!<! Energy dependent scale, applied after the energy calibration (not owned)
+  Double_t               fMinCellE;               ///< Min cell E to apply the energy dependent scale
+  Double_t               fMaxCellE;               ///< Max cell E to apply the energy dependent scale
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalCorrectionCellCalibTable, 1); // EMCal dense cell calibration table
+  /// \endcond
+};
+
+#endif /* ALIEMCALCORRECTIONCELLCALIBTABLE_H */
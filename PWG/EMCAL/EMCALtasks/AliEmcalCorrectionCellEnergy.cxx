@@ -10,6 +10,7 @@
 #include "AliDataFile.h"
 
 #include "AliEmcalCorrectionCellEnergy.h"
+#include "AliEmcalCorrectionCellCalibTable.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalCorrectionCellEnergy);
@@ -499,3 +500,36 @@ Bool_t AliEmcalCorrectionCellEnergy::CheckIfRunChanged()
   }
   return runChanged;
 }
+
+/**
+ * The energy calibration can be fused unless the QA histograms or the (non-linear)
+ * shaper correction are requested.
+ */
+Bool_t AliEmcalCorrectionCellEnergy::CanFuseCellCorrection()
+{
+  return !fCreateHisto && !fUseShaperCorrection;
+}
+
+/**
+ * Fill the energy calibration factors of the current run into the dense cell table.
+ * The factors must be applied before any energy dependent scaling, so this fails if
+ * a cell energy variation was filled earlier.
+ */
+Bool_t AliEmcalCorrectionCellEnergy::FillCellCalibTable(AliEmcalCorrectionCellCalibTable & table)
+{
+  if (table.HasEnergyScaleFunction()) {
+    AliWarning("Cell energy variation is configured before the energy calibration, cannot fuse the cell corrections");
+    return kFALSE;
+  }
+
+  for (Int_t absId = 0; absId < table.GetNCells(); absId++)
+  {
+    if (table.GetSuperModule(absId) < 0) continue;
+
+    if (fLoad1DRecalibFactors)
+      table.ScaleEnergy(absId, fRecoUtils->GetEMCALChannelRecalibrationFactor1D(absId));
+    else
+      table.ScaleEnergy(absId, fRecoUtils->GetEMCALChannelRecalibrationFactor(table.GetSuperModule(absId), table.GetColumn(absId), table.GetRow(absId)));
+  }
+  return kTRUE;
+}
@@ -5,6 +5,7 @@
 #include <TFile.h>
 
 #include "AliEmcalCorrectionCellEnergyVariation.h"
+#include "AliEmcalCorrectionCellCalibTable.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalCorrectionCellEnergyVariation);
@@ -158,3 +159,22 @@ void AliEmcalCorrectionCellEnergyVariation::LoadEnergyScaleFunction(const std::s
   file->Close();
   delete file;
 }
+
+/**
+ * The cell energy variation only depends on the cell energy and can always be fused.
+ */
+Bool_t AliEmcalCorrectionCellEnergyVariation::CanFuseCellCorrection()
+{
+  return kTRUE;
+}
+
+/**
+ * Register the energy scale function in the dense cell table. Only one energy variation
+ * can be fused per table.
+ */
+Bool_t AliEmcalCorrectionCellEnergyVariation::FillCellCalibTable(AliEmcalCorrectionCellCalibTable & table)
+{
+  if (!fEnergyScaleFunction) return kTRUE;
+
+  return table.SetEnergyScaleFunction(fEnergyScaleFunction, fMinCellE, fMaxCellE);
+}
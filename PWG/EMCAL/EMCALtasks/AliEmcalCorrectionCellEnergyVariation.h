@@ -30,6 +30,11 @@ class AliEmcalCorrectionCellEnergyVariation : public AliEmcalCorrectionComponent
   void UserCreateOutputObjects();
   void ExecOnce();
   Bool_t Run();
+
+  // Fused cell correction pass
+  Bool_t IsFusableCellComponent() const { return kTRUE; }
+  Bool_t CanFuseCellCorrection();
+  Bool_t FillCellCalibTable(AliEmcalCorrectionCellCalibTable & table);
   
 protected:
   
@@ -12,6 +12,7 @@
 #include "AliDataFile.h"
 
 #include "AliEmcalCorrectionCellTimeCalib.h"
+#include "AliEmcalCorrectionCellCalibTable.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalCorrectionCellTimeCalib);
@@ -545,3 +546,53 @@ Bool_t AliEmcalCorrectionCellTimeCalib::CheckIfRunChanged()
   }
   return runChanged;
 }
+
+/**
+ * The time calibration can be fused unless the QA histograms are requested or the
+ * L1 phase changes within the run (PAR runs).
+ */
+Bool_t AliEmcalCorrectionCellTimeCalib::CanFuseCellCorrection()
+{
+  if (fCreateHisto) return kFALSE;
+  if (fCalibrateTimeL1Phase && fRecoUtils->IsParRun()) return kFALSE;
+  return kTRUE;
+}
+
+/**
+ * Fill the time shifts of the current run (per BC%4 and gain, including the L1 phase
+ * of the super module) into the dense cell table.
+ */
+Bool_t AliEmcalCorrectionCellTimeCalib::FillCellCalibTable(AliEmcalCorrectionCellCalibTable & table)
+{
+  if (!fCalibrateTime) return kTRUE;
+
+  // Configure the reco utils as in Run(), such that the L1 phase offsets can be retrieved
+  if (fCalibrateTimeL1Phase)
+    fRecoUtils->SwitchOnL1PhaseInTimeRecalibration();
+  else
+    fRecoUtils->SwitchOffL1PhaseInTimeRecalibration();
+  fRecoUtils->ResetCellsCalibrated();
+
+  Bool_t lowGain = fRecoUtils->IsLGOn();
+  for (Int_t absId = 0; absId < table.GetNCells(); absId++)
+  {
+    Int_t iSM = table.GetSuperModule(absId);
+    if (iSM < 0) continue;
+
+    for (Int_t bc = 0; bc < 4; bc++)
+    {
+      // RecalibrateCellTimeL1Phase() subtracts the offset from the given time
+      Double_t l1PhaseShift = 0;
+      if (fCalibrateTimeL1Phase) {
+        fRecoUtils->RecalibrateCellTimeL1Phase(iSM, bc, l1PhaseShift, 0);
+        l1PhaseShift = -l1PhaseShift;
+      }
+
+      Double_t highGainShift = fRecoUtils->GetEMCALChannelTimeRecalibrationFactor(bc, absId, kFALSE)*1.e-9;
+      Double_t lowGainShift = lowGain ? fRecoUtils->GetEMCALChannelTimeRecalibrationFactor(bc, absId, kTRUE)*1.e-9 : highGainShift;
+      table.AddTimeShift(absId, bc, kFALSE, highGainShift + l1PhaseShift);
+      table.AddTimeShift(absId, bc, kTRUE, lowGainShift + l1PhaseShift);
+    }
+  }
+  return kTRUE;
+}
@@ -9,6 +9,7 @@
 #include "AliClusterContainer.h"
 #include "AliParticleContainer.h"
 #include "AliEMCALRecoUtils.h"
+#include "AliEMCALTrackExtrapolationCache.h"
 #include "AliESDCaloCluster.h"
 #include "AliAODCaloCluster.h"
 #include "AliVParticle.h"
@@ -36,6 +37,8 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fUsePIDmass(kTRUE),
   fUseDCA(kTRUE),
   fUseOuterParamInESDs(kFALSE),
+  fUseExtrapolationCache(kFALSE),
+  fFastExtrapolationMargin(-1),
   fUpdateTracks(kTRUE),
   fUpdateClusters(kTRUE),
   fClusterContainerIndexMap(),
@@ -79,6 +82,8 @@ Bool_t AliEmcalCorrectionClusterTrackMatcher::Initialize()
   GetProperty("usePIDmass", fUsePIDmass);
   GetProperty("useDCA", fUseDCA);
   GetProperty("useOuterParamInESDs", fUseOuterParamInESDs);
+  GetProperty("useTrackExtrapolationCache", fUseExtrapolationCache);
+  GetProperty("fastTrackExtrapolationMargin", fFastExtrapolationMargin);
   GetProperty("maxDist", fMaxDistance);
   GetProperty("updateClusters", fUpdateClusters);
   GetProperty("updateTracks", fUpdateTracks);
@@ -334,8 +339,11 @@ void AliEmcalCorrectionClusterTrackMatcher::GenerateEmcalParticles()
           if ( !generOK ) continue;
         }
         
-        // Propagate the track
-        AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, fPropDist, mass, 20, 0.35, kFALSE, fUseDCA, fUseOuterParamInESDs);
+        // Propagate the track, reusing the propagation of other consumers in this event if requested
+        if (fUseExtrapolationCache)
+          AliEMCALTrackExtrapolationCache::Instance()->ExtrapolateTrackToEMCalSurface(track, fPropDist, mass, 20, 0.35, kFALSE, fUseDCA, fUseOuterParamInESDs, fFastExtrapolationMargin);
+        else
+          AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(track, fPropDist, mass, 20, 0.35, kFALSE, fUseDCA, fUseOuterParamInESDs);
       }
 
       // Reset properties of the track to fix TRefArray errors which occur when AddTrackMatched(obj) is called.
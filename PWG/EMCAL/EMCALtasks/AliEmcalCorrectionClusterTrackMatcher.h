@@ -86,6 +86,8 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   Bool_t        fUsePIDmass;            ///< Use PID-based mass hypothesis for track propagation, rather than pion mass hypothesis
   Bool_t        fUseDCA;                ///< Use DCA as starting point for track propagation, rather than primary vertex
   Bool_t        fUseOuterParamInESDs;   ///< Use TPC outer parameters instead of inner parameters for track propagation, ESDs only
+  Bool_t        fUseExtrapolationCache; ///< Share the track propagation with other consumers in the event, see AliEMCALTrackExtrapolationCache
+  Double_t      fFastExtrapolationMargin; ///< Acceptance edge margin for the approximate propagation of the cache (negative: always full propagation)
   Bool_t        fUpdateTracks;          ///< update tracks with matching info
   Bool_t        fUpdateClusters;        ///< update clusters with matching info
   
@@ -116,7 +118,7 @@ private:
   static RegisterCorrectionComponent<AliEmcalCorrectionClusterTrackMatcher> reg;
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionClusterTrackMatcher, 5); // EMCal cluster track matcher correction component
+  ClassDef(AliEmcalCorrectionClusterTrackMatcher, 6); // EMCal cluster track matcher correction component
   /// \endcond
 };
 
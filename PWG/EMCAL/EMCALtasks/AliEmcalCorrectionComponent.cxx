@@ -16,6 +16,7 @@
 #include "AliParticleContainer.h"
 #include "AliMCParticleContainer.h"
 #include "AliDataFile.h"
+#include "AliEmcalCorrectionCellCalibTable.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalCorrectionComponent);
@@ -227,6 +228,49 @@ void AliEmcalCorrectionComponent::UpdateCells()
   fCaloCells->Sort();
 }
 
+/**
+ * Per event preparation of a component which is part of a fused cell pass. It takes care of
+ * the steps which are otherwise done at the beginning of Run() (including loading the constants
+ * of a new run).
+ *
+ * @return True if the run changed, ie. the dense cell table needs to be refilled
+ */
+Bool_t AliEmcalCorrectionComponent::PrepareCellCalibTable()
+{
+  AliEmcalCorrectionComponent::Run();
+
+  if (!fEventManager.InputEvent()) {
+    AliError("Event ptr = 0, returning");
+    return kFALSE;
+  }
+
+  return CheckIfRunChanged();
+}
+
+/**
+ * Reset the dense cell table for the geometry of the current run.
+ */
+void AliEmcalCorrectionComponent::ResetCellCalibTable(AliEmcalCorrectionCellCalibTable & table) const
+{
+  table.Reset(fGeom);
+}
+
+/**
+ * Apply the dense cell table to the cells of the component in a single pass.
+ * Replaces UpdateCells() for all components of a fused cell pass.
+ */
+void AliEmcalCorrectionComponent::ApplyCellCalibTable(const AliEmcalCorrectionCellCalibTable & table)
+{
+  if (!fEventManager.InputEvent() || !fCaloCells) return;
+
+  if (fCaloCells->GetNumberOfCells() <= 0) {
+    AliDebug(2, Form("Number of EMCAL cells = %d, returning", fCaloCells->GetNumberOfCells()));
+    return;
+  }
+
+  table.Apply(fCaloCells, fEventManager.InputEvent()->GetBunchCrossNumber());
+}
+
 /**
  * Check whether the run changed.
  */
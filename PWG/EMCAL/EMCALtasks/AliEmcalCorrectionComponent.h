@@ -13,6 +13,7 @@ class AliVCaloCells;
 class AliVTrack;
 class AliVCluster;
 class AliVEvent;
+class AliEmcalCorrectionCellCalibTable;
 #include <AliLog.h>
 #include <AliEMCALGeometry.h>
 #include "AliYAMLConfiguration.h"
@@ -60,6 +61,17 @@ class AliEmcalCorrectionComponent : public TNamed {
   void FillCellQA(TH1F* h);
   Int_t InitBadChannels();
 
+  // Fused cell correction pass (see AliEmcalCorrectionTask)
+  /// True if the component only applies per-cell constants and can be part of a fused cell pass
+  virtual Bool_t IsFusableCellComponent() const { return kFALSE; }
+  /// True if the component can be fused with the current configuration and run (called after CheckIfRunChanged())
+  virtual Bool_t CanFuseCellCorrection() { return kFALSE; }
+  /// Fill the per-cell constants of the current run into the dense table. Returns kFALSE if not possible.
+  virtual Bool_t FillCellCalibTable(AliEmcalCorrectionCellCalibTable & /*table*/) { return kFALSE; }
+  Bool_t PrepareCellCalibTable();
+  void ResetCellCalibTable(AliEmcalCorrectionCellCalibTable & table) const;
+  void ApplyCellCalibTable(const AliEmcalCorrectionCellCalibTable & table);
+
   // Containers and cells
   AliParticleContainer   *AddParticleContainer(const char *n)                    { return AliEmcalContainerUtils::AddContainer<AliParticleContainer>(n, fParticleCollArray); }
   AliTrackContainer      *AddTrackContainer(const char *n)                       { return AliEmcalContainerUtils::AddContainer<AliTrackContainer>(n, fParticleCollArray); }
@@ -5,6 +5,7 @@
 
 #include "AliEmcalCorrectionTask.h"
 #include "AliEmcalCorrectionComponent.h"
+#include "AliEmcalCorrectionCellCalibTable.h"
 
 #include <vector>
 #include <set>
@@ -46,6 +47,9 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask() :
   fOrderedComponentsToExecute(),
   fCorrectionComponents(),
   fConfigurationInitialized(false),
+  fFuseCellCorrections(kFALSE),
+  fFusedCellGroups(),
+  fFusedCellTables(),
   fIsEsd(false),
   fEventInitialized(false),
   fCent(0),
@@ -91,6 +95,9 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const char * name) :
   fOrderedComponentsToExecute(),
   fCorrectionComponents(),
   fConfigurationInitialized(false),
+  fFuseCellCorrections(kFALSE),
+  fFusedCellGroups(),
+  fFusedCellTables(),
   fIsEsd(false),
   fEventInitialized(false),
   fCent(0),
@@ -136,6 +143,9 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const AliEmcalCorrectionTask & ta
   fOrderedComponentsToExecute(task.fOrderedComponentsToExecute),
   fCorrectionComponents(task.fCorrectionComponents),  // TODO: These should be copied!
   fConfigurationInitialized(task.fConfigurationInitialized),
+  fFuseCellCorrections(task.fFuseCellCorrections),
+  fFusedCellGroups(),                             // Transient, determined in ExecOnce()
+  fFusedCellTables(),
   fIsEsd(task.fIsEsd),
   fEventInitialized(task.fEventInitialized),
   fCent(task.fCent),
@@ -199,6 +209,9 @@ void swap(AliEmcalCorrectionTask & first, AliEmcalCorrectionTask & second)
   swap(first.fOrderedComponentsToExecute, second.fOrderedComponentsToExecute);
   swap(first.fCorrectionComponents, second.fCorrectionComponents);
   swap(first.fConfigurationInitialized, second.fConfigurationInitialized);
+  swap(first.fFuseCellCorrections, second.fFuseCellCorrections);
+  swap(first.fFusedCellGroups, second.fFusedCellGroups);
+  swap(first.fFusedCellTables, second.fFusedCellTables);
   swap(first.fIsEsd, second.fIsEsd);
   swap(first.fEventInitialized, second.fEventInitialized);
   swap(first.fCent, second.fCent);
@@ -227,6 +240,10 @@ void swap(AliEmcalCorrectionTask & first, AliEmcalCorrectionTask & second)
 AliEmcalCorrectionTask::~AliEmcalCorrectionTask()
 {
   // Destructor
+  for (auto table : fFusedCellTables)
+  {
+    delete table;
+  }
 }
 
 void AliEmcalCorrectionTask::Initialize(bool removeDummyTask)
@@ -277,6 +294,11 @@ void AliEmcalCorrectionTask::Initialize(bool removeDummyTask)
   // Check for user defined settings that are not in the default file
   CheckForUnmatchedUserSettings();
 
+  // Check whether the cell calibration components should be applied in a single pass
+  bool fuseCellCorrections = false;
+  fYAMLConfig.GetProperty("fuseCellCorrections", fuseCellCorrections, false);
+  fFuseCellCorrections = fuseCellCorrections;
+
   // Setup input objects
   // Setup Cells
   // Cannot do this entirely yet because we need input objects
@@ -1163,6 +1185,11 @@ void AliEmcalCorrectionTask::ExecOnce()
 
   // Setup the components
   ExecOnceComponents();
+
+  // Group the cell calibration components which are applied in a single pass
+  if (fFuseCellCorrections) {
+    DetermineFusedCellGroups();
+  }
 }
 
 /**
@@ -1297,13 +1324,19 @@ Bool_t AliEmcalCorrectionTask::RetrieveEventObjects()
 Bool_t AliEmcalCorrectionTask::Run()
 {
   // Run the initialization for all derived classes.
-  for (auto component : fCorrectionComponents)
+  std::size_t iGroup = 0;
+  for (std::size_t iComponent = 0; iComponent < fCorrectionComponents.size(); iComponent++)
   {
-    component->SetInputEvent(InputEvent());
-    component->SetMCEvent(MCEvent());
-    component->SetCentralityBin(fCentBin);
-    component->SetCentrality(fCent);
-    component->SetVertex(fVertex);
+    // Components which are part of a fused cell group are run together
+    if (iGroup < fFusedCellGroups.size() && fFusedCellGroups.at(iGroup).first == iComponent) {
+      RunFusedCellCorrections(iGroup);
+      iComponent = fFusedCellGroups.at(iGroup).second - 1;
+      iGroup++;
+      continue;
+    }
+
+    AliEmcalCorrectionComponent * component = fCorrectionComponents.at(iComponent);
+    SetEventPropertiesInComponent(component);
 
     component->Run();
   }
@@ -1313,6 +1346,119 @@ Bool_t AliEmcalCorrectionTask::Run()
   return kTRUE;
 }
 
+/**
+ * Sets the event properties (event objects, centrality and vertex) in a component before it is run.
+ */
+void AliEmcalCorrectionTask::SetEventPropertiesInComponent(AliEmcalCorrectionComponent * component)
+{
+  component->SetInputEvent(InputEvent());
+  component->SetMCEvent(MCEvent());
+  component->SetCentralityBin(fCentBin);
+  component->SetCentrality(fCent);
+  component->SetVertex(fVertex);
+}
+
+/**
+ * Determines the groups of consecutive cell calibration components (bad channel removal, energy calibration,
+ * energy variation and time calibration) which operate on the same cells and can therefore be applied in a
+ * single pass over the cells. Components which depend on neighbouring cells (such as the crosstalk emulation)
+ * or which create cells end a group. A group needs at least two components to be worth fusing.
+ */
+void AliEmcalCorrectionTask::DetermineFusedCellGroups()
+{
+  for (auto table : fFusedCellTables)
+  {
+    delete table;
+  }
+  fFusedCellTables.clear();
+  fFusedCellGroups.clear();
+
+  std::size_t iComponent = 0;
+  while (iComponent < fCorrectionComponents.size())
+  {
+    AliEmcalCorrectionComponent * first = fCorrectionComponents.at(iComponent);
+    if (!first->IsFusableCellComponent() || !first->GetCaloCells()) {
+      iComponent++;
+      continue;
+    }
+
+    std::size_t iLast = iComponent + 1;
+    while (iLast < fCorrectionComponents.size() &&
+        fCorrectionComponents.at(iLast)->IsFusableCellComponent() &&
+        fCorrectionComponents.at(iLast)->GetCaloCells() == first->GetCaloCells())
+    {
+      iLast++;
+    }
+
+    if (iLast - iComponent > 1) {
+      std::stringstream componentNames;
+      for (std::size_t i = iComponent; i < iLast; i++)
+      {
+        componentNames << " " << fCorrectionComponents.at(i)->GetName();
+      }
+      AliInfoStream() << "Applying cell corrections in a single pass:" << componentNames.str() << std::endl;
+
+      fFusedCellGroups.push_back(std::make_pair(iComponent, iLast));
+      fFusedCellTables.push_back(new AliEmcalCorrectionCellCalibTable());
+    }
+
+    iComponent = iLast;
+  }
+}
+
+/**
+ * Runs the components of a fused cell group. Each component loads its constants when the run changes,
+ * as usual. The constants are then collected into a dense table indexed by absolute cell ID, which is
+ * only refilled when the run changes, and the table is applied to the cells in a single pass.
+ *
+ * If any of the components cannot be fused with its current configuration (for example, because QA
+ * histograms are requested), the components are run one after another as usual.
+ *
+ * @param[in] iGroup Index of the fused cell group
+ */
+void AliEmcalCorrectionTask::RunFusedCellCorrections(std::size_t iGroup)
+{
+  const std::pair<std::size_t, std::size_t> & group = fFusedCellGroups.at(iGroup);
+  AliEmcalCorrectionCellCalibTable * table = fFusedCellTables.at(iGroup);
+
+  Bool_t runChanged = kFALSE;
+  Bool_t canFuse = kTRUE;
+  for (std::size_t i = group.first; i < group.second; i++)
+  {
+    AliEmcalCorrectionComponent * component = fCorrectionComponents.at(i);
+    SetEventPropertiesInComponent(component);
+    if (component->PrepareCellCalibTable()) runChanged = kTRUE;
+    if (!component->CanFuseCellCorrection()) canFuse = kFALSE;
+  }
+
+  if (runChanged) {
+    table->SetStatus(AliEmcalCorrectionCellCalibTable::kEmpty);
+  }
+
+  if (canFuse && table->GetStatus() == AliEmcalCorrectionCellCalibTable::kEmpty) {
+    fCorrectionComponents.at(group.first)->ResetCellCalibTable(*table);
+    Bool_t filled = kTRUE;
+    for (std::size_t i = group.first; i < group.second && filled; i++)
+    {
+      filled = fCorrectionComponents.at(i)->FillCellCalibTable(*table);
+    }
+    table->SetStatus(filled ? AliEmcalCorrectionCellCalibTable::kFilled : AliEmcalCorrectionCellCalibTable::kUnusable);
+    if (!filled) {
+      AliWarning("Could not fill the fused cell calibration table, running the cell components one by one for this run");
+    }
+  }
+
+  if (!canFuse || table->GetStatus() != AliEmcalCorrectionCellCalibTable::kFilled) {
+    for (std::size_t i = group.first; i < group.second; i++)
+    {
+      fCorrectionComponents.at(i)->Run();
+    }
+    return;
+  }
+
+  fCorrectionComponents.at(group.first)->ApplyCellCalibTable(*table);
+}
+
 /**
  * Executed when the file is changed. Also calls UserNotify() for each component.
  */
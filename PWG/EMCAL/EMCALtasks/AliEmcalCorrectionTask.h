@@ -3,6 +3,7 @@
 
 class AliEmcalCorrectionCellContainer;
 class AliEmcalCorrectionComponent;
+class AliEmcalCorrectionCellCalibTable;
 class AliEMCALGeometry;
 class AliVEvent;
 
@@ -191,6 +192,10 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Execute component functions
   void UserCreateOutputObjectsComponents();
   void ExecOnceComponents();
+  void SetEventPropertiesInComponent(AliEmcalCorrectionComponent * component);
+  // Fused cell corrections
+  void DetermineFusedCellGroups();
+  void RunFusedCellCorrections(std::size_t iGroup);
 
   // Initialization functions
   void InitializeConfiguration();
@@ -225,6 +230,9 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   std::vector <std::string>   fOrderedComponentsToExecute; ///< Ordered set of components to execute
   std::vector <AliEmcalCorrectionComponent *> fCorrectionComponents; ///< Contains the correction components
   bool                        fConfigurationInitialized;   ///< True if the %YAML configuration files are initialized
+  Bool_t                      fFuseCellCorrections;        ///< Apply consecutive cell calibration components in a single pass over the cells
+  std::vector <std::pair<std::size_t, std::size_t> > fFusedCellGroups; //!<! [first, last) indices of the components of each fused cell group
+  std::vector <AliEmcalCorrectionCellCalibTable *> fFusedCellTables; //!<! Dense per-run cell table of each fused cell group
 
   bool                        fIsEsd;                      ///< File type
   bool                        fEventInitialized;           ///< If the event is initialized properly
@@ -249,7 +257,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   TList *                     fOutput;                     //!<! Output for histograms
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionTask, 9); // EMCal correction task
+  ClassDef(AliEmcalCorrectionTask, 10); // EMCal correction task
   /// \endcond
 };
 
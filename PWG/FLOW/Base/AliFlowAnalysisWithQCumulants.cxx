@@ -42,6 +42,7 @@
 #include "TCanvas.h"
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
+#include "AliFlowEventSimpleCache.h"
 #include "AliFlowAnalysisWithQCumulants.h"
 #include "TArrayD.h"
 #include "TRandom.h"
@@ -69,6 +70,9 @@ using std::cout;
 using std::flush;
 ClassImp(AliFlowAnalysisWithQCumulants)
 
+// [first][second] index of fDiffFlowProductOfCorrelationsPro and fDiffFlowSumOfProductOfEventWeights filled by the typed path:
+const Int_t AliFlowAnalysisWithQCumulants::fgkDiffFlowBufferPairs[9][2] = {{0,1},{1,2},{1,4},{1,6},{0,3},{1,3},{2,3},{3,4},{3,6}};
+
 AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants(): 
  // 0.) base:
  fHistList(NULL),
@@ -134,6 +138,7 @@ AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants():
  fUse2DHistograms(kFALSE),
  fFillProfilesVsMUsingWeights(kTRUE),
  fUseQvectorTerms(kFALSE),
+ fUseTrackCache(kFALSE),
  fReQ(NULL),
  fImQ(NULL),
  fSpk(NULL),
@@ -171,6 +176,7 @@ AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants():
  fCalculateDiffFlow(kTRUE),
  fCalculate2DDiffFlow(kFALSE),
  fCalculateDiffFlowVsEta(kTRUE),
+ fUseTypedDiffFlow(kFALSE),
  // 5.) other differential correlators:
  fOtherDiffCorrelatorsList(NULL),
  // 6.) distributions:
@@ -305,6 +311,7 @@ void AliFlowAnalysisWithQCumulants::Init()
  this->BookEverythingForIntegratedFlow(); 
  this->BookEverythingForDifferentialFlow(); 
  this->BookEverythingFor2DDifferentialFlow(); 
+ if(fUseTypedDiffFlow){this->BookDiffFlowBuffers();}
  this->BookEverythingForDistributions();
  this->BookEverythingForVarious();
  this->BookEverythingForNestedLoops();
@@ -379,59 +386,119 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
  AliFlowTrackSimple *aftsTrack = NULL;
  Int_t n = fHarmonic; // shortcut for the harmonic 
+ AliFlowEventSimpleCache *trackCache = NULL; // per-event track cache shared with the other methods (if requested)
+ if(fUseTrackCache && n>0){trackCache = anEvent->GetTrackCache(12*n);}
+ Bool_t bRP = kFALSE; // particle is RP
+ Bool_t bPOI = kFALSE; // particle is POI
+ Double_t dCosMnPhi[12] = {0.}; // cos((m+1)*n*dPhi) for this particle
+ Double_t dSinMnPhi[12] = {0.}; // sin((m+1)*n*dPhi) for this particle
+ Double_t dWeightToK[9] = {0.}; // (wPhi*wPt*wEta*wTrack)^k for this particle
  for(Int_t i=0;i<nPrim;i++) 
  { 
   if(fExactNoRPs > 0 && nCounterNoRPs>fExactNoRPs){continue;}
-  aftsTrack=anEvent->GetTrack(i);
-  if(aftsTrack)
-  {
-   if(!(aftsTrack->InRPSelection() || aftsTrack->InPOISelection())){continue;} // safety measure: consider only tracks which are RPs or POIs
-   if(aftsTrack->InRPSelection()) // RP condition:
-   {    
-    nCounterNoRPs++;
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
-    if(fUsePhiWeights && fPhiWeights && fnBinsPhi) // determine phi weight for this particle:
+  if(trackCache)
+  {
+   bRP = trackCache->InRPSelection(i);
+   bPOI = trackCache->InPOISelection(i);
+  } else
     {
-     wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
+     aftsTrack=anEvent->GetTrack(i);
+     if(!aftsTrack)
+     {
+      printf("\n WARNING (QC): No particle (i.e. aftsTrack is a NULL pointer in AFAWQC::Make())!!!!\n\n");
+      continue;
+     }
+     bRP = aftsTrack->InRPSelection();
+     bPOI = aftsTrack->InPOISelection();
     }
-    if(fUsePtWeights && fPtWeights && fnBinsPt) // determine pt weight for this particle:
-    {
-     wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
-    }              
-    if(fUseEtaWeights && fEtaWeights && fEtaBinWidth) // determine eta weight for this particle: 
-    {
-     wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
-    }      
-    // Access track weight:
-    if(fUseTrackWeights)
+  if(!(bRP || bPOI)){continue;} // safety measure: consider only tracks which are RPs or POIs
+  dPhi = trackCache ? trackCache->Phi(i) : aftsTrack->Phi();
+  dPt  = trackCache ? trackCache->Pt(i) : aftsTrack->Pt();
+  dEta = trackCache ? trackCache->Eta(i) : aftsTrack->Eta();
+  // cos and sin of all harmonics used below, evaluated only once per particle:
+  for(Int_t m=0;m<12;m++)
+  {
+   dCosMnPhi[m] = trackCache ? trackCache->Cos((m+1)*n,i) : TMath::Cos((m+1)*n*dPhi);
+   dSinMnPhi[m] = trackCache ? trackCache->Sin((m+1)*n,i) : TMath::Sin((m+1)*n*dPhi);
+  }
+  if(bRP) // RP condition:
+  {    
+   nCounterNoRPs++;
+   if(fUsePhiWeights && fPhiWeights && fnBinsPhi) // determine phi weight for this particle:
+   {
+    wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
+   }
+   if(fUsePtWeights && fPtWeights && fnBinsPt) // determine pt weight for this particle:
+   {
+    wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
+   }              
+   if(fUseEtaWeights && fEtaWeights && fEtaBinWidth) // determine eta weight for this particle: 
+   {
+    wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
+   }      
+   // Access track weight:
+   if(fUseTrackWeights)
+   {
+    wTrack = trackCache ? trackCache->Weight(i) : aftsTrack->Weight(); 
+   }
+   for(Int_t k=0;k<9;k++)
+   {
+    dWeightToK[k] = pow(wPhi*wPt*wEta*wTrack,k);
+   }
+   // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
+   for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
+   {
+    for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
     {
-     wTrack = aftsTrack->Weight(); 
+     (*fReQ)(m,k)+=dWeightToK[k]*dCosMnPhi[m]; 
+     (*fImQ)(m,k)+=dWeightToK[k]*dSinMnPhi[m]; 
+    } 
+   }
+   // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
+   for(Int_t p=0;p<8;p++)
+   {
+    for(Int_t k=0;k<9;k++)
+    {     
+     (*fSpk)(p,k)+=dWeightToK[k];
     }
-    // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
-    for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
+   } 
+   // Differential flow:
+   if(fCalculateDiffFlow || fCalculate2DDiffFlow)
+   {
+    ptEta[0] = dPt; 
+    ptEta[1] = dEta; 
+    // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
+    for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
     {
-     for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+     for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
      {
-      (*fReQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1)*n*dPhi); 
-      (*fImQ)(m,k)+=pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1)*n*dPhi); 
-     } 
-    }
-    // Calculate S_{p,k} for this event (Remark: final calculation of S_{p,k} follows after the loop over data bellow):
-    for(Int_t p=0;p<8;p++)
-    {
-     for(Int_t k=0;k<9;k++)
-     {     
-      (*fSpk)(p,k)+=pow(wPhi*wPt*wEta*wTrack,k);
-     }
-    } 
-    // Differential flow:
-    if(fCalculateDiffFlow || fCalculate2DDiffFlow)
+      if(fCalculateDiffFlow)
+      {
+       for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+       {
+        fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],dWeightToK[k]*dCosMnPhi[m],1.);
+        fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],dWeightToK[k]*dSinMnPhi[m],1.);          
+        if(m==0) // s_{p,k} does not depend on index m
+        {
+         fs1dEBE[0][pe][k]->Fill(ptEta[pe],dWeightToK[k],1.);
+        } // end of if(m==0) // s_{p,k} does not depend on index m
+       } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
+      } // end of if(fCalculateDiffFlow) 
+      if(fCalculate2DDiffFlow)
+      {
+       fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,dWeightToK[k]*dCosMnPhi[m],1.);
+       fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,dWeightToK[k]*dSinMnPhi[m],1.);      
+       if(m==0) // s_{p,k} does not depend on index m
+       {
+        fs2dEBE[0][k]->Fill(dPt,dEta,dWeightToK[k],1.);
+       } // end of if(m==0) // s_{p,k} does not depend on index m
+      } // end of if(fCalculate2DDiffFlow)
+     } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+    } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+    // Checking if RP particle is also POI particle:      
+    if(bPOI)
     {
-     ptEta[0] = dPt; 
-     ptEta[1] = dEta; 
-     // Calculate r_{m*n,k} and s_{p,k} (r_{m,k} is 'p-vector' for RPs): 
+     // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
      {
       for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
@@ -440,112 +507,78 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
        {
         for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
         {
-         fReRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ1dEBE[0][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
+         fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],dWeightToK[k]*dCosMnPhi[m],1.);
+         fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],dWeightToK[k]*dSinMnPhi[m],1.);          
          if(m==0) // s_{p,k} does not depend on index m
          {
-          fs1dEBE[0][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
+          fs1dEBE[2][pe][k]->Fill(ptEta[pe],dWeightToK[k],1.);
          } // end of if(m==0) // s_{p,k} does not depend on index m
         } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
        } // end of if(fCalculateDiffFlow) 
        if(fCalculate2DDiffFlow)
        {
-        fReRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ2dEBE[0][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
+        fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,dWeightToK[k]*dCosMnPhi[m],1.);
+        fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,dWeightToK[k]*dSinMnPhi[m],1.);      
         if(m==0) // s_{p,k} does not depend on index m
         {
-         fs2dEBE[0][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
+         fs2dEBE[2][k]->Fill(dPt,dEta,dWeightToK[k],1.);
         } // end of if(m==0) // s_{p,k} does not depend on index m
        } // end of if(fCalculate2DDiffFlow)
       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-     // Checking if RP particle is also POI particle:      
-     if(aftsTrack->InPOISelection())
-     {
-      // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
-      for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-      {
-       for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-       {
-        if(fCalculateDiffFlow)
-        {
-         for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-         {
-          fReRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-          fImRPQ1dEBE[2][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-          if(m==0) // s_{p,k} does not depend on index m
-          {
-           fs1dEBE[2][pe][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k),1.);
-          } // end of if(m==0) // s_{p,k} does not depend on index m
-         } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-        } // end of if(fCalculateDiffFlow) 
-        if(fCalculate2DDiffFlow)
-        {
-         fReRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-         fImRPQ2dEBE[2][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-         if(m==0) // s_{p,k} does not depend on index m
-         {
-          fs2dEBE[2][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k),1.);
-         } // end of if(m==0) // s_{p,k} does not depend on index m
-        } // end of if(fCalculate2DDiffFlow)
-       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-      } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
-     } // end of if(aftsTrack->InPOISelection())  
-    } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)         
-   } // end of if(pTrack->InRPSelection())
-   if(aftsTrack->InPOISelection())
-   {
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
-    wPhi = 1.;
-    wPt  = 1.;
-    wEta = 1.;
-    wTrack = 1.;
-    if(fUsePhiWeights && fPhiWeights && fnBinsPhi && aftsTrack->InRPSelection()) // determine phi weight for POI && RP particle:
-    {
-     wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
-    }
-    if(fUsePtWeights && fPtWeights && fnBinsPt && aftsTrack->InRPSelection()) // determine pt weight for POI && RP particle:
-    {
-     wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
-    }              
-    if(fUseEtaWeights && fEtaWeights && fEtaBinWidth && aftsTrack->InRPSelection()) // determine eta weight for POI && RP particle: 
-    {
-     wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
-    }      
-    // Access track weight for POI && RP particle:
-    if(aftsTrack->InRPSelection() && fUseTrackWeights)
-    {
-     wTrack = aftsTrack->Weight(); 
-    }
-    ptEta[0] = dPt;
-    ptEta[1] = dEta;
-    // Calculate p_{m*n,k} ('p-vector' for POIs): 
-    for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+    } // end of if(bPOI)  
+   } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)         
+  } // end of if(bRP)
+  if(bPOI)
+  {
+   wPhi = 1.;
+   wPt  = 1.;
+   wEta = 1.;
+   wTrack = 1.;
+   if(fUsePhiWeights && fPhiWeights && fnBinsPhi && bRP) // determine phi weight for POI && RP particle:
+   {
+    wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
+   }
+   if(fUsePtWeights && fPtWeights && fnBinsPt && bRP) // determine pt weight for POI && RP particle:
+   {
+    wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
+   }              
+   if(fUseEtaWeights && fEtaWeights && fEtaBinWidth && bRP) // determine eta weight for POI && RP particle: 
+   {
+    wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
+   }      
+   // Access track weight for POI && RP particle:
+   if(bRP && fUseTrackWeights)
+   {
+    wTrack = trackCache ? trackCache->Weight(i) : aftsTrack->Weight(); 
+   }
+   for(Int_t k=0;k<9;k++)
+   {
+    dWeightToK[k] = pow(wPhi*wPt*wEta*wTrack,k);
+   }
+   ptEta[0] = dPt;
+   ptEta[1] = dEta;
+   // Calculate p_{m*n,k} ('p-vector' for POIs): 
+   for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
+   {
+    for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
     {
-     for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+     if(fCalculateDiffFlow)
      {
-      if(fCalculateDiffFlow)
+      for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
       {
-       for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
-       {
-        fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-        fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);          
-       } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
-      } // end of if(fCalculateDiffFlow) 
-      if(fCalculate2DDiffFlow)
-      {
-       fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Cos((m+1.)*n*dPhi),1.);
-       fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,pow(wPhi*wPt*wEta*wTrack,k)*TMath::Sin((m+1.)*n*dPhi),1.);      
-      } // end of if(fCalculate2DDiffFlow)
-     } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
-    } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
-   } // end of if(pTrack->InPOISelection())    
-  } else // to if(aftsTrack)
-    {
-     printf("\n WARNING (QC): No particle (i.e. aftsTrack is a NULL pointer in AFAWQC::Make())!!!!\n\n");
-    }
+       fReRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],dWeightToK[k]*dCosMnPhi[m],1.);
+       fImRPQ1dEBE[1][pe][m][k]->Fill(ptEta[pe],dWeightToK[k]*dSinMnPhi[m],1.);          
+      } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
+     } // end of if(fCalculateDiffFlow) 
+     if(fCalculate2DDiffFlow)
+     {
+      fReRPQ2dEBE[1][m][k]->Fill(dPt,dEta,dWeightToK[k]*dCosMnPhi[m],1.);
+      fImRPQ2dEBE[1][m][k]->Fill(dPt,dEta,dWeightToK[k]*dSinMnPhi[m],1.);      
+     } // end of if(fCalculate2DDiffFlow)
+    } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
+   } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
+  } // end of if(bPOI)    
  } // end of for(Int_t i=0;i<nPrim;i++) 
 
  // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
@@ -591,7 +624,16 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  } // end of if(!fEvaluateIntFlowNestedLoops)
 
  // g) Call the methods which calculate correlations for differential flow:
- if(!fEvaluateDiffFlowNestedLoops && fCalculateDiffFlow)
+ Bool_t bTypedDiffFlow = fUseTypedDiffFlow && !(fUsePhiWeights||fUsePtWeights||fUseEtaWeights||fUseTrackWeights);
+ if(!fEvaluateDiffFlowNestedLoops && fCalculateDiffFlow && bTypedDiffFlow)
+ {
+  // Without using particle weights, all in one pass per type and pt or eta:
+  for(Int_t t=kDiffRP;t<=kDiffPOI;t++)
+  {
+   this->CalculateDiffFlowTyped(t,kDiffPt);
+   if(fCalculateDiffFlowVsEta){this->CalculateDiffFlowTyped(t,kDiffEta);}
+  }
+ } else if(!fEvaluateDiffFlowNestedLoops && fCalculateDiffFlow)
  {
   if(!(fUsePhiWeights||fUsePtWeights||fUseEtaWeights||fUseTrackWeights))
   {
@@ -647,8 +689,15 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
   if(!(fUsePhiWeights||fUsePtWeights||fUseEtaWeights||fUseTrackWeights))
   {
    // Without using particle weights:
-   this->Calculate2DDiffFlowCorrelations("RP"); 
-   this->Calculate2DDiffFlowCorrelations("POI");
+   if(bTypedDiffFlow)
+   {
+    this->Calculate2DDiffFlowCorrelationsTyped(kDiffRP);
+    this->Calculate2DDiffFlowCorrelationsTyped(kDiffPOI);
+   } else
+     {
+      this->Calculate2DDiffFlowCorrelations("RP"); 
+      this->Calculate2DDiffFlowCorrelations("POI");
+     }
    // Non-isotropic terms:
    // ... to be ctd ...
   } else // to if(!(fUsePhiWeights||fUsePtWeights||fUseEtaWeights||fUseTrackWeights))
@@ -720,6 +769,9 @@ void AliFlowAnalysisWithQCumulants::Finish()
  // i) Calculate cumulants for mixed harmonics;
  // j) Calculate cumulants for bootstrap.
 
+ // Add the fills buffered by the typed differential flow path (if any) to the profiles:
+ this->FlushDiffFlowBuffers();
+
  // a) Check all pointers used in this method:
  this->CheckPointersUsedInFinish();
   
@@ -17322,6 +17374,531 @@ void AliFlowAnalysisWithQCumulants::CalculateDiffFlowSumOfProductOfEventWeights(
 
 //=======================================================================================================================
 
+void AliFlowAnalysisWithQCumulants::BookDiffFlowBuffers()
+{
+ // Book the flat arrays in which the typed differential flow path accumulates the fills of the profiles.
+ // For each (pt or eta) bin the histogram bin and the pt or eta value used by the string-based methods 
+ // are stored, so that FlushDiffFlowBuffers() reproduces their fills.
+
+ Int_t nBinsPtEta[2] = {fnBinsPt,fnBinsEta};
+ Double_t minPtEta[2] = {fPtMin,fEtaMin};
+ Double_t binWidthPtEta[2] = {fPtBinWidth,fEtaBinWidth};
+
+ // 1D:
+ if(fCalculateDiffFlow)
+ {
+  for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+  {
+   if(!fDiffFlowCorrelationsPro[0][pe][0])
+   {
+    cout<<"WARNING: fDiffFlowCorrelationsPro[0][pe][0] is NULL in AFAWQC::BDFB() !!!!"<<endl;
+    cout<<"pe = "<<pe<<endl;
+    exit(0);
+   }
+   fDiffFlowBufferX[pe].resize(nBinsPtEta[pe]);
+   fDiffFlowBufferBin[pe].resize(nBinsPtEta[pe]);
+   for(Int_t b=1;b<=nBinsPtEta[pe];b++)
+   {
+    fDiffFlowBufferX[pe][b-1] = minPtEta[pe]+(b-1)*binWidthPtEta[pe];
+    fDiffFlowBufferBin[pe][b-1] = fDiffFlowCorrelationsPro[0][pe][0]->FindBin(fDiffFlowBufferX[pe][b-1]);
+   }
+   for(Int_t t=0;t<2;t++) // type: RP or POI
+   {
+    fDiffFlowBuffer[t][pe].assign(5*kDFBNTargets*nBinsPtEta[pe],0.);
+   }
+  } // end of for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+ } // end of if(fCalculateDiffFlow)
+
+ // 2D:
+ if(fCalculate2DDiffFlow)
+ {
+  if(!f2DDiffFlowCorrelationsPro[0][0])
+  {
+   cout<<"WARNING: f2DDiffFlowCorrelationsPro[0][0] is NULL in AFAWQC::BDFB() !!!!"<<endl;
+   exit(0);
+  }
+  Int_t nCells = fnBinsPt*fnBinsEta;
+  f2DDiffFlowBufferXY[0].resize(nCells);
+  f2DDiffFlowBufferXY[1].resize(nCells);
+  f2DDiffFlowBufferBin.resize(nCells);
+  for(Int_t p=1;p<=fnBinsPt;p++)
+  {
+   for(Int_t e=1;e<=fnBinsEta;e++)
+   {
+    Int_t c = (p-1)*fnBinsEta+(e-1);
+    f2DDiffFlowBufferXY[0][c] = fPtMin+(p-1)*fPtBinWidth;
+    f2DDiffFlowBufferXY[1][c] = fEtaMin+(e-1)*fEtaBinWidth;
+    f2DDiffFlowBufferBin[c] = f2DDiffFlowCorrelationsPro[0][0]->FindBin(f2DDiffFlowBufferXY[0][c],f2DDiffFlowBufferXY[1][c]);
+   }
+  }
+  for(Int_t t=0;t<2;t++) // type: RP or POI
+  {
+   f2DDiffFlowBuffer[t].assign(5*2*nCells,0.);
+  }
+ } // end of if(fCalculate2DDiffFlow)
+
+} // end of void AliFlowAnalysisWithQCumulants::BookDiffFlowBuffers()
+
+//=======================================================================================================================
+
+static inline void FillDiffFlowBuffer(Double_t *buffer, Double_t y, Double_t w)
+{
+ // Equivalent of TProfile::Fill(x,y,w) (or TH1D::Fill(x,w) with y = 1) for a bin of the buffers of the typed path.
+ buffer[0] += w*y;
+ buffer[1] += w*y*y;
+ buffer[2] += w;
+ buffer[3] += w*w;
+ buffer[4] += 1.;
+}
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateDiffFlowTyped(Int_t t, Int_t pe)
+{
+ // Typed path for differential flow without particle weights. For type t (kDiffRP or kDiffPOI) and pt or eta 
+ // (pe = kDiffPt or kDiffEta) this replaces the calls to CalculateDiffFlowCorrelations(), CalculateDiffFlowCorrectionsForNUASinTerms(),
+ // CalculateDiffFlowCorrectionsForNUACosTerms(), CalculateDiffFlowProductOfCorrelations(), CalculateDiffFlowSumOfEventWeights() 
+ // and CalculateDiffFlowSumOfProductOfEventWeights(): p- and q-vectors are read once per bin, all quantities are evaluated in 
+ // one pass, and the fills are accumulated in fDiffFlowBuffer[t][pe], which is added to the profiles in FlushDiffFlowBuffers().
+ // The e-b-e histograms are filled as in the string-based methods.
+
+ if(fDiffFlowBuffer[t][pe].empty())
+ {
+  cout<<"WARNING: fDiffFlowBuffer[t][pe] is not booked in AFAWQC::CDFT() !!!!"<<endl;
+  cout<<"t  = "<<t<<endl;
+  cout<<"pe = "<<pe<<endl;
+  exit(0);
+ }
+
+ // Multiplicity:
+ Double_t dMult = (*fSpk)(0,0);
+ 
+ // Real and imaginary parts of non-weighted Q-vectors evaluated in harmonics n and 2n: 
+ Double_t dReQ1n = (*fReQ)(0,0);
+ Double_t dReQ2n = (*fReQ)(1,0);
+ Double_t dImQ1n = (*fImQ)(0,0);
+ Double_t dImQ2n = (*fImQ)(1,0);
+
+ // Multiplicity weight (once per call instead of once per bin):
+ Bool_t bCombinations = fMultiplicityWeight->Contains("combinations");
+ Bool_t bUnit = fMultiplicityWeight->Contains("unit");
+
+ // E-b-e correlations <2>, <4>, <6>, <8> and their event weights:
+ Double_t dCorrelationEBE[4] = {0.};
+ Double_t dEventWeightEBE[4] = {0.};
+ for(Int_t ci=0;ci<4;ci++)
+ {
+  dCorrelationEBE[ci] = fIntFlowCorrelationsEBE->GetBinContent(ci+1);
+  dEventWeightEBE[ci] = fIntFlowEventWeightsForCorrelationsEBE->GetBinContent(ci+1);
+ }
+ // Event weights for correlations <2>, <4>, <6> and <8> used for the sums of products of event weights:
+ Double_t dW2 = dMult*(dMult-1); 
+ Double_t dW4 = dMult*(dMult-1)*(dMult-2)*(dMult-3); 
+ Double_t dW6 = dMult*(dMult-1)*(dMult-2)*(dMult-3)*(dMult-4)*(dMult-5);
+ Double_t dW8 = dMult*(dMult-1)*(dMult-2)*(dMult-3)*(dMult-4)*(dMult-5)*(dMult-6)*(dMult-7);
+
+ // q_{m*n,0} (RP && POI particles, all RPs for t = kDiffRP) and p_{m*n,0} (POIs, equal to q for t = kDiffRP):
+ Int_t qi = (t == kDiffRP ? 0 : 2);
+ Int_t pi = (t == kDiffRP ? 0 : 1);
+ TProfile *reQ1n = fReRPQ1dEBE[qi][pe][0][0];
+ const Double_t *q1nRe = reQ1n->GetArray(); // sum of entries, i.e. GetBinContent(b)*GetBinEntries(b)
+ const Double_t *q1nIm = fImRPQ1dEBE[qi][pe][0][0]->GetArray();
+ const Double_t *q2nRe = fReRPQ1dEBE[qi][pe][1][0]->GetArray();
+ const Double_t *q2nIm = fImRPQ1dEBE[qi][pe][1][0]->GetArray();
+ TProfile *reP1n = fReRPQ1dEBE[pi][pe][0][0];
+ const Double_t *p1nRe = reP1n->GetArray();
+ const Double_t *p1nIm = fImRPQ1dEBE[pi][pe][0][0]->GetArray();
+
+ Int_t nBins = (Int_t)fDiffFlowBufferBin[pe].size();
+ Int_t stride = 5*nBins; // distance between two targets in the buffer
+ 
+ // Looping over all bins:
+ for(Int_t b=1;b<=nBins;b++)
+ {
+  Double_t *buffer = &fDiffFlowBuffer[t][pe][5*(b-1)];
+  
+  Double_t q1n0kRe = q1nRe[b];
+  Double_t q1n0kIm = q1nIm[b];
+  Double_t q2n0kRe = q2nRe[b];
+  Double_t q2n0kIm = q2nIm[b];
+  Double_t mq = reQ1n->GetBinEntries(b);
+  Double_t p1n0kRe = p1nRe[b];
+  Double_t p1n0kIm = p1nIm[b];
+  Double_t mp = reP1n->GetBinEntries(b);
+
+  // Event weights for <2'>, <4'> and for the 3-particle correction terms:
+  Double_t dw2 = mp*dMult-mq;
+  Double_t dw4 = (mp-mq)*dMult*(dMult-1.)*(dMult-2.) + mq*(dMult-1.)*(dMult-2.)*(dMult-3.);
+  Double_t dw3 = mq*(dMult-1.)*(dMult-2.)+(mp-mq)*dMult*(dMult-1.);
+
+  // <2'>:
+  Double_t two1n1nPtEta = 0.;
+  Double_t mWeight2pPrime = 0.; 
+  if(dw2)
+  {
+   two1n1nPtEta = (p1n0kRe*dReQ1n+p1n0kIm*dImQ1n-mq)/dw2;
+   if(bCombinations)
+   {
+    mWeight2pPrime = dw2;
+   } else if(bUnit)
+     {
+      mWeight2pPrime = 1.;
+     }
+   FillDiffFlowBuffer(buffer+(kDFBCorrelations+0)*stride,two1n1nPtEta,mWeight2pPrime);
+   FillDiffFlowBuffer(buffer+(kDFBSquaredCorrelations+0)*stride,two1n1nPtEta*two1n1nPtEta,mWeight2pPrime);
+   fDiffFlowCorrelationsEBE[t][pe][0]->SetBinContent(b,two1n1nPtEta);      
+   fDiffFlowEventWeightsForCorrelationsEBE[t][pe][0]->SetBinContent(b,mWeight2pPrime);      
+  } // end of if(dw2)
+
+  // <4'>:
+  Double_t four1n1n1n1nPtEta = 0.;
+  Double_t mWeight4pPrime = 0.;
+  if(dw4)
+  {
+   four1n1n1n1nPtEta = ((pow(dReQ1n,2.)+pow(dImQ1n,2.))*(p1n0kRe*dReQ1n+p1n0kIm*dImQ1n)
+                     - q2n0kRe*(pow(dReQ1n,2.)-pow(dImQ1n,2.))
+                     - 2.*q2n0kIm*dReQ1n*dImQ1n
+                     - p1n0kRe*(dReQ1n*dReQ2n+dImQ1n*dImQ2n)
+                     + p1n0kIm*(dImQ1n*dReQ2n-dReQ1n*dImQ2n)
+                     - 2.*dMult*(p1n0kRe*dReQ1n+p1n0kIm*dImQ1n)
+                     - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))*mq                      
+                     + 6.*(q1n0kRe*dReQ1n+q1n0kIm*dImQ1n)                                            
+                     + 1.*(q2n0kRe*dReQ2n+q2n0kIm*dImQ2n)                      
+                     + 2.*(p1n0kRe*dReQ1n+p1n0kIm*dImQ1n)                       
+                     + 2.*mq*dMult                      
+                     - 6.*mq)        
+                     / dw4; 
+   if(bCombinations)
+   {
+    mWeight4pPrime = dw4;
+   } else if(bUnit)
+     {
+      mWeight4pPrime = 1.;
+     }
+   FillDiffFlowBuffer(buffer+(kDFBCorrelations+1)*stride,four1n1n1n1nPtEta,mWeight4pPrime);
+   FillDiffFlowBuffer(buffer+(kDFBSquaredCorrelations+1)*stride,four1n1n1n1nPtEta*four1n1n1n1nPtEta,mWeight4pPrime);
+   fDiffFlowCorrelationsEBE[t][pe][1]->SetBinContent(b,four1n1n1n1nPtEta);
+   fDiffFlowEventWeightsForCorrelationsEBE[t][pe][1]->SetBinContent(b,mWeight4pPrime);
+  } // end of if(dw4)
+
+  // Correction terms for non-uniform acceptance, [0=sin,1=cos][cti]:
+  Double_t correctionTerm[2][4] = {{0.}};
+  Bool_t bCorrectionTerm[4] = {mp!=0.,dw2!=0.,dw3!=0.,dw3!=0.};
+  Double_t correctionTermWeight[4] = {mp,dw2,dw3,dw3};
+  if(mp)
+  {
+   correctionTerm[0][0] = p1n0kIm/mp; // <<sin n(psi1)>>
+   correctionTerm[1][0] = p1n0kRe/mp; // <<cos n(psi1)>>
+  }
+  if(dw2)
+  {
+   correctionTerm[0][1] = (p1n0kRe*dImQ1n+p1n0kIm*dReQ1n-q2n0kIm)/dw2; // <<sin n(psi1+phi2)>>
+   correctionTerm[1][1] = (p1n0kRe*dReQ1n-p1n0kIm*dImQ1n-q2n0kRe)/dw2; // <<cos n(psi1+phi2)>>
+  }
+  if(dw3)
+  {
+   // <<sin n(psi1+phi2-phi3)>>:
+   correctionTerm[0][2] = (p1n0kIm*(pow(dImQ1n,2.)+pow(dReQ1n,2.)-dMult)
+                        - 1.*(q2n0kIm*dReQ1n-q2n0kRe*dImQ1n)  
+                        - mq*dImQ1n+2.*q1n0kIm)
+                        / dw3;
+   // <<sin n(psi1-phi2-phi3)>>:
+   correctionTerm[0][3] = (p1n0kIm*(pow(dReQ1n,2.)-pow(dImQ1n,2.))-2.*p1n0kRe*dReQ1n*dImQ1n
+                        - 1.*(p1n0kIm*dReQ2n-p1n0kRe*dImQ2n)
+                        + 2.*mq*dImQ1n-2.*q1n0kIm)
+                        / dw3;
+   // <<cos n(psi1+phi2-phi3)>>:
+   correctionTerm[1][2] = (p1n0kRe*(pow(dImQ1n,2.)+pow(dReQ1n,2.)-dMult)
+                        - 1.*(q2n0kRe*dReQ1n+q2n0kIm*dImQ1n)  
+                        - mq*dReQ1n+2.*q1n0kRe)
+                        / dw3;
+   // <<cos n(psi1-phi2-phi3)>>:
+   correctionTerm[1][3] = (p1n0kRe*(pow(dReQ1n,2.)-pow(dImQ1n,2.))+2.*p1n0kIm*dReQ1n*dImQ1n
+                        - 1.*(p1n0kRe*dReQ2n+p1n0kIm*dImQ2n)  
+                        - 2.*mq*dReQ1n+2.*q1n0kRe)
+                        / dw3;
+  }
+  for(Int_t sc=0;sc<2;sc++) // sin or cos terms
+  {
+   for(Int_t cti=0;cti<4;cti++) // correction term index
+   {
+    if(!bCorrectionTerm[cti]){continue;}
+    FillDiffFlowBuffer(buffer+(kDFBCorrectionTermsForNUA+4*sc+cti)*stride,correctionTerm[sc][cti],correctionTermWeight[cti]);
+    fDiffFlowCorrectionTermsForNUAEBE[t][pe][sc][cti]->SetBinContent(b,correctionTerm[sc][cti]);
+   }
+  }
+
+  // Products of correlations, weighted with the products of their event weights, and sums of products of event weights:
+  Double_t correlation[8] = {dCorrelationEBE[0],two1n1nPtEta,dCorrelationEBE[1],four1n1n1n1nPtEta,dCorrelationEBE[2],0.,dCorrelationEBE[3],0.};
+  Double_t eventWeight[8] = {dEventWeightEBE[0],mWeight2pPrime,dEventWeightEBE[1],mWeight4pPrime,dEventWeightEBE[2],0.,dEventWeightEBE[3],0.};
+  Double_t combinations[8] = {dW2,dw2,dW4,dw4,dW6,0.,dW8,0.};
+  for(Int_t pci=0;pci<9;pci++) // pair of correlations index
+  {
+   Int_t mci1 = fgkDiffFlowBufferPairs[pci][0];
+   Int_t mci2 = fgkDiffFlowBufferPairs[pci][1];
+   FillDiffFlowBuffer(buffer+(kDFBProductOfCorrelations+pci)*stride,correlation[mci1]*correlation[mci2],eventWeight[mci1]*eventWeight[mci2]);
+   FillDiffFlowBuffer(buffer+(kDFBSumOfProductOfEventWeights+pci)*stride,1.,combinations[mci1]*combinations[mci2]);
+  }
+
+  // Sums of linear and quadratic event weights for <2'> and <4'>:
+  FillDiffFlowBuffer(buffer+(kDFBSumOfEventWeights+0)*stride,1.,dw2);
+  FillDiffFlowBuffer(buffer+(kDFBSumOfEventWeights+1)*stride,1.,dw4);
+  FillDiffFlowBuffer(buffer+(kDFBSumOfEventWeights+2)*stride,1.,dw2*dw2);
+  FillDiffFlowBuffer(buffer+(kDFBSumOfEventWeights+3)*stride,1.,dw4*dw4);
+ } // end of for(Int_t b=1;b<=nBins;b++)
+
+} // end of void AliFlowAnalysisWithQCumulants::CalculateDiffFlowTyped(Int_t t, Int_t pe)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::Calculate2DDiffFlowCorrelationsTyped(Int_t t)
+{
+ // Typed version of Calculate2DDiffFlowCorrelations() for type t (kDiffRP or kDiffPOI): empty (pt,eta) bins are skipped, 
+ // and the fills of f2DDiffFlowCorrelationsPro[t][0..1] are accumulated in f2DDiffFlowBuffer[t] until FlushDiffFlowBuffers().
+
+ if(f2DDiffFlowBuffer[t].empty())
+ {
+  cout<<"WARNING: f2DDiffFlowBuffer[t] is not booked in AFAWQC::C2DDFCT() !!!!"<<endl;
+  cout<<"t = "<<t<<endl;
+  exit(0);
+ }
+
+ // Multiplicity:
+ Double_t dMult = (*fSpk)(0,0);
+ // Real and imaginary parts of non-weighted Q-vectors evaluated in harmonics n and 2n: 
+ Double_t dReQ1n = (*fReQ)(0,0);
+ Double_t dReQ2n = (*fReQ)(1,0);
+ Double_t dImQ1n = (*fImQ)(0,0);
+ Double_t dImQ2n = (*fImQ)(1,0);
+
+ // Multiplicity weight:
+ Bool_t bCombinations = fMultiplicityWeight->Contains("combinations");
+ Bool_t bUnit = fMultiplicityWeight->Contains("unit");
+
+ // q_{m*n,0} and p_{m*n,0}, see CalculateDiffFlowTyped():
+ Int_t qi = (t == kDiffRP ? 0 : 2);
+ Int_t pi = (t == kDiffRP ? 0 : 1);
+ TProfile2D *reQ1n = fReRPQ2dEBE[qi][0][0];
+ const Double_t *q1nRe = reQ1n->GetArray();
+ const Double_t *q1nIm = fImRPQ2dEBE[qi][0][0]->GetArray();
+ const Double_t *q2nRe = fReRPQ2dEBE[qi][1][0]->GetArray();
+ const Double_t *q2nIm = fImRPQ2dEBE[qi][1][0]->GetArray();
+ TProfile2D *reP1n = fReRPQ2dEBE[pi][0][0];
+ const Double_t *p1nRe = reP1n->GetArray();
+ const Double_t *p1nIm = fImRPQ2dEBE[pi][0][0]->GetArray();
+
+ Int_t nCells = (Int_t)f2DDiffFlowBufferBin.size();
+ Int_t stride = 5*nCells;
+ for(Int_t p=1;p<=fnBinsPt;p++)
+ {
+  for(Int_t e=1;e<=fnBinsEta;e++)
+  {
+   Int_t bin = reQ1n->GetBin(p,e);
+   Double_t mp = reP1n->GetBinEntries(bin);
+   Double_t mq = reQ1n->GetBinEntries(bin);
+   if(!mp && !mq){continue;} // nothing is filled for an empty bin
+   Double_t q1n0kRe = q1nRe[bin];
+   Double_t q1n0kIm = q1nIm[bin];
+   Double_t q2n0kRe = q2nRe[bin];
+   Double_t q2n0kIm = q2nIm[bin];
+   Double_t p1n0kRe = p1nRe[bin];
+   Double_t p1n0kIm = p1nIm[bin];
+   Double_t *buffer = &f2DDiffFlowBuffer[t][5*((p-1)*fnBinsEta+(e-1))];
+
+   // <2'>:
+   Double_t dw2 = mp*dMult-mq;
+   if(dw2)
+   {
+    Double_t two1n1nPtEta = (p1n0kRe*dReQ1n+p1n0kIm*dImQ1n-mq)/dw2;
+    Double_t mWeight2pPrime = 0.;
+    if(bCombinations)
+    {
+     mWeight2pPrime = dw2;
+    } else if(bUnit)
+      {
+       mWeight2pPrime = 1.;
+      }
+    FillDiffFlowBuffer(buffer,two1n1nPtEta,mWeight2pPrime);
+   } // end of if(dw2)
+
+   // <4'>:
+   Double_t dw4 = (mp-mq)*dMult*(dMult-1.)*(dMult-2.) + mq*(dMult-1.)*(dMult-2.)*(dMult-3.);
+   if(dw4)
+   {
+    Double_t four1n1n1n1nPtEta = ((pow(dReQ1n,2.)+pow(dImQ1n,2.))*(p1n0kRe*dReQ1n+p1n0kIm*dImQ1n)
+                               - q2n0kRe*(pow(dReQ1n,2.)-pow(dImQ1n,2.))
+                               - 2.*q2n0kIm*dReQ1n*dImQ1n
+                               - p1n0kRe*(dReQ1n*dReQ2n+dImQ1n*dImQ2n)
+                               + p1n0kIm*(dImQ1n*dReQ2n-dReQ1n*dImQ2n)
+                               - 2.*dMult*(p1n0kRe*dReQ1n+p1n0kIm*dImQ1n)
+                               - 2.*(pow(dReQ1n,2.)+pow(dImQ1n,2.))*mq                      
+                               + 6.*(q1n0kRe*dReQ1n+q1n0kIm*dImQ1n)                                            
+                               + 1.*(q2n0kRe*dReQ2n+q2n0kIm*dImQ2n)                      
+                               + 2.*(p1n0kRe*dReQ1n+p1n0kIm*dImQ1n)                       
+                               + 2.*mq*dMult                      
+                               - 6.*mq)        
+                               / dw4; 
+    Double_t mWeight4pPrime = 0.;
+    if(bCombinations)
+    {
+     mWeight4pPrime = dw4;
+    } else if(bUnit)
+      {
+       mWeight4pPrime = 1.;
+      }
+    FillDiffFlowBuffer(buffer+stride,four1n1n1n1nPtEta,mWeight4pPrime);
+   } // end of if(dw4)
+  } // end of for(Int_t e=1;e<=fnBinsEta;e++)
+ } // end of for(Int_t p=1;p<=fnBinsPt;p++)
+
+} // end of void AliFlowAnalysisWithQCumulants::Calculate2DDiffFlowCorrelationsTyped(Int_t t)
+
+//=======================================================================================================================
+
+TH1* AliFlowAnalysisWithQCumulants::GetDiffFlowBufferTarget(Int_t t, Int_t pe, Int_t target) const
+{
+ // Profile or histogram to which the target of fDiffFlowBuffer[t][pe] is added.
+
+ if(target < kDFBSquaredCorrelations)
+ {
+  return fDiffFlowCorrelationsPro[t][pe][target-kDFBCorrelations];
+ } else if(target < kDFBCorrectionTermsForNUA)
+   {
+    return fDiffFlowSquaredCorrelationsPro[t][pe][target-kDFBSquaredCorrelations];
+   } else if(target < kDFBProductOfCorrelations)
+     {
+      Int_t i = target-kDFBCorrectionTermsForNUA;
+      return fDiffFlowCorrectionTermsForNUAPro[t][pe][i/4][i%4];
+     } else if(target < kDFBSumOfEventWeights)
+       {
+        Int_t i = target-kDFBProductOfCorrelations;
+        return fDiffFlowProductOfCorrelationsPro[t][pe][fgkDiffFlowBufferPairs[i][0]][fgkDiffFlowBufferPairs[i][1]];
+       } else if(target < kDFBSumOfProductOfEventWeights)
+         {
+          Int_t i = target-kDFBSumOfEventWeights;
+          return fDiffFlowSumOfEventWeights[t][pe][i/2][i%2];
+         } 
+ Int_t i = target-kDFBSumOfProductOfEventWeights;
+ return fDiffFlowSumOfProductOfEventWeights[t][pe][fgkDiffFlowBufferPairs[i][0]][fgkDiffFlowBufferPairs[i][1]];
+
+} // end of TH1* AliFlowAnalysisWithQCumulants::GetDiffFlowBufferTarget(Int_t t, Int_t pe, Int_t target) const
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::FlushDiffFlowBuffers()
+{
+ // Add the fills accumulated by the typed differential flow path to the profiles and histograms, and reset the buffers.
+ // Called in Finish() and, before the output is written, by AliAnalysisTaskQCumulants::FinishTaskOutput(); nothing is
+ // done if the typed path is not used.
+
+ // 1D:
+ for(Int_t t=0;t<2;t++) // type: RP or POI
+ {
+  for(Int_t pe=0;pe<2;pe++) // pt or eta
+  {
+   if(fDiffFlowBuffer[t][pe].empty()){continue;}
+   Int_t nBins = (Int_t)fDiffFlowBufferBin[pe].size();
+   for(Int_t target=0;target<kDFBNTargets;target++)
+   {
+    this->FlushDiffFlowBuffer(this->GetDiffFlowBufferTarget(t,pe,target),&fDiffFlowBuffer[t][pe][5*target*nBins],nBins,
+                              &fDiffFlowBufferBin[pe][0],&fDiffFlowBufferX[pe][0],NULL);
+   }
+  } // end of for(Int_t pe=0;pe<2;pe++) // pt or eta
+ } // end of for(Int_t t=0;t<2;t++) // type: RP or POI
+
+ // 2D:
+ for(Int_t t=0;t<2;t++) // type: RP or POI
+ {
+  if(f2DDiffFlowBuffer[t].empty()){continue;}
+  Int_t nCells = (Int_t)f2DDiffFlowBufferBin.size();
+  for(Int_t rci=0;rci<2;rci++) // <2'> and <4'>
+  {
+   this->FlushDiffFlowBuffer(f2DDiffFlowCorrelationsPro[t][rci],&f2DDiffFlowBuffer[t][5*rci*nCells],nCells,
+                             &f2DDiffFlowBufferBin[0],&f2DDiffFlowBufferXY[0][0],&f2DDiffFlowBufferXY[1][0]);
+  }
+ } // end of for(Int_t t=0;t<2;t++) // type: RP or POI
+
+} // end of void AliFlowAnalysisWithQCumulants::FlushDiffFlowBuffers()
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::FlushDiffFlowBuffer(TH1 *hist, Double_t *buffer, Int_t nBins, const Int_t *bins, const Double_t *x, const Double_t *y)
+{
+ // Add nBins bins of a buffer (sum w*y, sum w*y^2, sum w, sum w^2, number of fills) to hist, a TProfile, TProfile2D or TH1D,
+ // as if each fill had been done with TProfile::Fill(x,y,w), TProfile2D::Fill(x,y,z,w) or TH1D::Fill(x,w) at x[b] (and y[b]) 
+ // into bin bins[b], including the statistics of the histogram. The buffer is reset.
+
+ if(!hist){return;}
+ Double_t nFills = 0.;
+ for(Int_t b=0;b<nBins;b++){nFills += buffer[5*b+4];}
+ if(nFills == 0.){return;}
+
+ Double_t stats[TH1::kNstat] = {0.};
+ hist->GetStats(stats); // before the bins are changed, GetStats() may recompute the statistics from the bins
+ Bool_t bProfile2D = hist->InheritsFrom(TProfile2D::Class());
+ Bool_t bProfile = !bProfile2D && hist->InheritsFrom(TProfile::Class());
+ if(!bProfile && !bProfile2D && hist->GetSumw2N() == 0){hist->Sumw2();} // TH1D::Fill(x,w) does so for w != 1
+ Double_t *sumw = NULL; // sum w*y for profiles, sum w for histograms
+ Double_t *sumw2 = hist->GetSumw2()->GetArray(); // sum w*y^2 for profiles, sum w^2 for histograms
+ Double_t *binSumw2 = NULL; // sum w^2 for profiles, if stored
+ if(bProfile2D)
+ {
+  sumw = ((TProfile2D*)hist)->GetArray();
+  if(((TProfile2D*)hist)->GetBinSumw2()->fN){binSumw2 = ((TProfile2D*)hist)->GetBinSumw2()->GetArray();}
+ } else if(bProfile)
+   {
+    sumw = ((TProfile*)hist)->GetArray();
+    if(((TProfile*)hist)->GetBinSumw2()->fN){binSumw2 = ((TProfile*)hist)->GetBinSumw2()->GetArray();}
+   } else
+     {
+      sumw = ((TH1D*)hist)->GetArray();
+     }
+
+ for(Int_t b=0;b<nBins;b++)
+ {
+  Double_t *s = buffer+5*b;
+  if(s[4] == 0.){continue;}
+  Int_t bin = bins[b];
+  if(bProfile2D)
+  {
+   TProfile2D *p2 = (TProfile2D*)hist;
+   sumw[bin] += s[0];
+   sumw2[bin] += s[1];
+   p2->SetBinEntries(bin,p2->GetBinEntries(bin)+s[2]);
+   if(binSumw2){binSumw2[bin] += s[3];}
+   stats[4] += s[2]*y[b];
+   stats[5] += s[2]*y[b]*y[b];
+   stats[6] += s[2]*x[b]*y[b];
+   stats[7] += s[0];
+   stats[8] += s[1];
+  } else if(bProfile)
+    {
+     TProfile *p1 = (TProfile*)hist;
+     sumw[bin] += s[0];
+     sumw2[bin] += s[1];
+     p1->SetBinEntries(bin,p1->GetBinEntries(bin)+s[2]);
+     if(binSumw2){binSumw2[bin] += s[3];}
+     stats[4] += s[0];
+     stats[5] += s[1];
+    } else
+      {
+       sumw[bin] += s[2];
+       sumw2[bin] += s[3];
+      }
+  stats[0] += s[2];
+  stats[1] += s[3];
+  stats[2] += s[2]*x[b];
+  stats[3] += s[2]*x[b]*x[b];
+  for(Int_t i=0;i<5;i++){s[i] = 0.;}
+ } // end of for(Int_t b=0;b<nBins;b++)
+ 
+ hist->PutStats(stats);
+ hist->SetEntries(hist->GetEntries()+nFills);
+
+} // end of void AliFlowAnalysisWithQCumulants::FlushDiffFlowBuffer(TH1 *hist, Double_t *buffer, Int_t nBins, const Int_t *bins, const Double_t *x, const Double_t *y)
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithQCumulants::FinalizeReducedCorrelations(TString type, TString ptOrEta)
 {
  // Transfer profiles into histograms and calculate statistical errors correctly.
@@ -14,6 +14,7 @@
 #ifndef ALIFLOWANALYSISWITHQCUMULANTS_H
 #define ALIFLOWANALYSISWITHQCUMULANTS_H
 
+#include <vector>
 #include "TMatrixD.h"
 #include "TH2D.h"
 #include "TRandom3.h"
@@ -39,6 +40,8 @@ class AliFlowCommonHistResults;
 
 class AliFlowAnalysisWithQCumulants{
  public:
+  enum diffFlowType {kDiffRP=0, kDiffPOI=1}; // first index of the differential flow histograms
+  enum diffFlowVariable {kDiffPt=0, kDiffEta=1}; // second index of the differential flow histograms
   AliFlowAnalysisWithQCumulants();
   virtual ~AliFlowAnalysisWithQCumulants(); 
   // 0.) methods called in the constructor:
@@ -61,6 +64,7 @@ class AliFlowAnalysisWithQCumulants{
     virtual void BookEverythingForIntegratedFlow();
     virtual void BookEverythingForDifferentialFlow();
     virtual void BookEverythingFor2DDifferentialFlow();
+    virtual void BookDiffFlowBuffers();
     virtual void BookEverythingForDistributions(); 
     virtual void BookEverythingForVarious();
     virtual void BookEverythingForNestedLoops();   
@@ -113,8 +117,10 @@ class AliFlowAnalysisWithQCumulants{
     virtual void CalculateDiffFlowCorrectionsForNUACosTermsUsingParticleWeights(TString type, TString ptOrEta);
     virtual void CalculateDiffFlowCorrectionsForNUASinTerms(TString type, TString ptOrEta);  
     virtual void CalculateDiffFlowCorrectionsForNUASinTermsUsingParticleWeights(TString type, TString ptOrEta);  
+    virtual void CalculateDiffFlowTyped(Int_t t, Int_t pe); // t = kDiffRP or kDiffPOI, pe = kDiffPt or kDiffEta
     // 2e.) 2D differential flow:
     virtual void Calculate2DDiffFlowCorrelations(TString type); // type = RP or POI
+    virtual void Calculate2DDiffFlowCorrelationsTyped(Int_t t); // t = kDiffRP or kDiffPOI
     // 2f.) Other differential correlators (i.e. Teaney-Yan correlator):    
     virtual void CalculateOtherDiffCorrelators(TString type, TString ptOrEta); // type = RP or POI    
     // 2g.) Distributions of reference flow correlations:
@@ -130,6 +136,7 @@ class AliFlowAnalysisWithQCumulants{
     virtual void EvaluateOtherDiffCorrelatorsWithNestedLoops(AliFlowEventSimple* const anEvent, TString type, TString ptOrEta);
   // 3.) method Finish() and methods called within Finish():
   virtual void Finish();
+    virtual void FlushDiffFlowBuffers();
     virtual void CheckPointersUsedInFinish();     
     // 3a.) integrated flow:
     virtual void FinalizeCorrelationsIntFlow();
@@ -287,6 +294,10 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t GetFillProfilesVsMUsingWeights() const {return this->fFillProfilesVsMUsingWeights;};
   void SetUseQvectorTerms(Bool_t const uqvt){this->fUseQvectorTerms = uqvt;if(uqvt){this->fStoreControlHistograms = kTRUE;}};
   Bool_t GetUseQvectorTerms() const {return this->fUseQvectorTerms;};
+  void SetUseTrackCache(Bool_t const utc){this->fUseTrackCache = utc;};
+  Bool_t GetUseTrackCache() const {return this->fUseTrackCache;};
+  void SetUseTypedDiffFlow(Bool_t const utdf){this->fUseTypedDiffFlow = utdf;};
+  Bool_t GetUseTypedDiffFlow() const {return this->fUseTypedDiffFlow;};
 
   // Reference flow profiles:
   void SetAvMultiplicity(TProfile* const avMultiplicity) {this->fAvMultiplicity = avMultiplicity;};
@@ -554,6 +565,18 @@ class AliFlowAnalysisWithQCumulants{
   
   AliFlowAnalysisWithQCumulants(const AliFlowAnalysisWithQCumulants& afawQc);
   AliFlowAnalysisWithQCumulants& operator=(const AliFlowAnalysisWithQCumulants& afawQc); 
+
+  // targets of the buffers of the typed differential flow path, per type and pt or eta: 
+  enum diffFlowBufferTarget {kDFBCorrelations=0, // fDiffFlowCorrelationsPro[t][pe][0..1]
+                             kDFBSquaredCorrelations=2, // fDiffFlowSquaredCorrelationsPro[t][pe][0..1]
+                             kDFBCorrectionTermsForNUA=4, // fDiffFlowCorrectionTermsForNUAPro[t][pe][0=sin,1=cos][0..3]
+                             kDFBProductOfCorrelations=12, // fDiffFlowProductOfCorrelationsPro[t][pe][][], see fgkDiffFlowBufferPairs
+                             kDFBSumOfEventWeights=21, // fDiffFlowSumOfEventWeights[t][pe][power][0..1]
+                             kDFBSumOfProductOfEventWeights=25, // fDiffFlowSumOfProductOfEventWeights[t][pe][][], see fgkDiffFlowBufferPairs
+                             kDFBNTargets=34};
+  static const Int_t fgkDiffFlowBufferPairs[9][2]; // stored products of <2>,<2'>,<4>,<4'>,<6>,<6'>,<8>,<8'>
+  TH1* GetDiffFlowBufferTarget(Int_t t, Int_t pe, Int_t target) const;
+  void FlushDiffFlowBuffer(TH1 *hist, Double_t *buffer, Int_t nBins, const Int_t *bins, const Double_t *x, const Double_t *y);
   
   // 0.) base:
   TList* fHistList; // base list to hold all output object
@@ -627,6 +650,7 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t fUse2DHistograms; // use TH2D instead of TProfile to improve numerical stability in reference flow calculation 
   Bool_t fFillProfilesVsMUsingWeights; // if the width of multiplicity bin is 1, weights are not needed  
   Bool_t fUseQvectorTerms; // use TH2D with separate Q-vector terms instead of TProfile to improve numerical stability in reference flow calculation 
+  Bool_t fUseTrackCache; // read tracks from the per-event cache of AliFlowEventSimple, shared with the other methods
 
   //  3c.) event-by-event quantities:
   TMatrixD *fReQ; //! fReQ[m][k] = sum_{i=1}^{M} w_{i}^{k} cos(m*phi_{i})
@@ -708,6 +732,7 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t fCalculateDiffFlow; // if you set kFALSE only reference flow will be calculated
   Bool_t fCalculate2DDiffFlow; // calculate 2D differential flow vs (pt,eta) (Remark: this is expensive in terms of CPU time)
   Bool_t fCalculateDiffFlowVsEta; // if you set kFALSE only differential flow vs pt is calculated
+  Bool_t fUseTypedDiffFlow; // without particle weights, evaluate diff. flow in one pass per type and pt/eta, with the fills buffered until Finish()
   //  4c.) event-by-event quantities:
   //   1D:
   TProfile *fReRPQ1dEBE[3][2][4][9]; //! real part [0=r,1=p,2=q][0=pt,1=eta][m][k]
@@ -729,6 +754,13 @@ class AliFlowAnalysisWithQCumulants{
   TProfile *fDiffFlowCorrectionTermsForNUAPro[2][2][2][10]; //! [0=RP,1=POI][0=pt,1=eta][0=sin terms,1=cos terms][correction term index]
   //   2D:                                                            
   TProfile2D *f2DDiffFlowCorrelationsPro[2][4]; //! [0=RP,1=POI][correlation index]
+  //   Buffers of the typed path, per target and bin: sum w*y, sum w*y^2, sum w, sum w^2, number of fills:
+  std::vector<Double_t> fDiffFlowBuffer[2][2]; //! [0=RP,1=POI][0=pt,1=eta] kDFBNTargets targets
+  std::vector<Double_t> fDiffFlowBufferX[2]; //! [0=pt,1=eta] pt or eta at which bin b is filled
+  std::vector<Int_t> fDiffFlowBufferBin[2]; //! [0=pt,1=eta] histogram bin filled for bin b
+  std::vector<Double_t> f2DDiffFlowBuffer[2]; //! [0=RP,1=POI] targets f2DDiffFlowCorrelationsPro[t][0..1]
+  std::vector<Double_t> f2DDiffFlowBufferXY[2]; //! [0=pt,1=eta] pt and eta at which (pt,eta) bin c is filled
+  std::vector<Int_t> f2DDiffFlowBufferBin; //! global histogram bin filled for (pt,eta) bin c
   //   Other differential correlators:
   TList *fOtherDiffCorrelatorsList; // list to hold profiles with other differential correlators
   TProfile *fOtherDiffCorrelators[2][2][2][1]; //! [0=RP,1=POI][0=pt,1=eta][0=sin terms,1=cos terms][correlator index] 
@@ -847,7 +879,7 @@ class AliFlowAnalysisWithQCumulants{
   TH2D *fBootstrapCumulants; // x-axis => QC{2}, QC{4}, QC{6}, QC{8}; y-axis => subsample # 
   TH2D *fBootstrapCumulantsVsM[4]; // index => QC{2}, QC{4}, QC{6}, QC{8}; x-axis => multiplicity; y-axis => subsample # 
 
-  ClassDef(AliFlowAnalysisWithQCumulants, 4);
+  ClassDef(AliFlowAnalysisWithQCumulants, 6);
 
 };
 
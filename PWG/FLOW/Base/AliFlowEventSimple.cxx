@@ -42,6 +42,7 @@
 #include "AliFlowTrackSimple.h"
 #include "AliFlowTrackSimpleCuts.h"
 #include "AliFlowEventSimple.h"
+#include "AliFlowEventSimpleCache.h"
 #include "TRandom.h"
 #include <random>
 
@@ -88,6 +89,7 @@ AliFlowEventSimple::AliFlowEventSimple():
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fTrackCache(NULL),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(NULL)
 {
@@ -147,6 +149,7 @@ AliFlowEventSimple::AliFlowEventSimple( Int_t n,
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fTrackCache(NULL),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -210,6 +213,7 @@ AliFlowEventSimple::AliFlowEventSimple(const AliFlowEventSimple& anEvent):
   fZPCM(anEvent.fZPCM),
   fZPAM(anEvent.fZPAM),
   fAbsOrbit(anEvent.fAbsOrbit),
+  fTrackCache(NULL),
   fNumberOfPOItypes(anEvent.fNumberOfPOItypes),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -307,6 +311,7 @@ AliFlowEventSimple& AliFlowEventSimple::operator=(const AliFlowEventSimple& anEv
     fV0A[i] = anEvent.fV0A[i];
   }
   delete [] fShuffledIndexes;
+  InvalidateTrackCache();
   return *this;
 }
 
@@ -323,6 +328,7 @@ AliFlowEventSimple::~AliFlowEventSimple()
   delete fShuffledIndexes;
   delete fMothersCollection;
   delete [] fNumberOfPOIs;
+  delete fTrackCache;
 }
 
 //-----------------------------------------------------------------------
@@ -470,6 +476,7 @@ void AliFlowEventSimple::TrackAdded()
 {
   //book keeping after a new track has been added
   fNumberOfTracks++;
+  InvalidateTrackCache();
   if (fShuffledIndexes)
   {
     delete [] fShuffledIndexes;
@@ -488,6 +495,26 @@ AliFlowTrackSimple* AliFlowEventSimple::MakeNewTrack()
    return t;
 }
 
+//-----------------------------------------------------------------------
+AliFlowEventSimpleCache* AliFlowEventSimple::GetTrackCache(Int_t maxHarmonic)
+{
+  //per-event cache of the track quantities, filled on first use in
+  //the event and shared by all methods, with cos/sin tables at least
+  //up to harmonic maxHarmonic. Code modifying tracks obtained with
+  //GetTrack() has to call InvalidateTrackCache() afterwards.
+  if (!fTrackCache) fTrackCache = new AliFlowEventSimpleCache();
+  if (!fTrackCache->IsValid(this)) fTrackCache->Fill(this);
+  fTrackCache->SetMaxHarmonic(maxHarmonic);
+  return fTrackCache;
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEventSimple::InvalidateTrackCache()
+{
+  //to be called when tracks are modified
+  if (fTrackCache) fTrackCache->Invalidate();
+}
+
 //-----------------------------------------------------------------------
 AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
                                         TList *weightsList,
@@ -551,8 +578,39 @@ AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
     }
   } // end of if(weightsList)
 
-  // loop over tracks
-  for(Int_t i=0; i<fNumberOfTracks; i++)
+  // use the track cache if it was already filled for this event
+  AliFlowEventSimpleCache* cache = NULL;
+  if(fTrackCache && fTrackCache->IsValid(this) && iOrder>0 && iOrder<=fTrackCache->GetMaxHarmonic()) cache = fTrackCache;
+  if(cache)
+  {
+    for(Int_t i=0; i<cache->GetNumberOfTracks(); i++)
+    {
+      if(!cache->InRPSelection(i)) continue;
+      dPhi = cache->Phi(i);
+      dPt  = cache->Pt(i);
+      dEta = cache->Eta(i);
+      dWeight = cache->Weight(i);
+      if(phiWeights && nBinsPhi)
+      {
+        wPhi = phiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*nBinsPhi/TMath::TwoPi())));
+      }
+      if(ptWeights && dBinWidthPt)
+      {
+        wPt=ptWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-dPtMin)/dBinWidthPt)));
+      }
+      if(etaWeights && dBinWidthEta)
+      {
+        wEta=etaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-dEtaMin)/dBinWidthEta)));
+      }
+      dQX += dWeight*wPhi*wPt*wEta*cache->Cos(iOrder,i);
+      dQY += dWeight*wPhi*wPt*wEta*cache->Sin(iOrder,i);
+      sumOfWeights += dWeight*wPhi*wPt*wEta;
+    }
+  }
+
+  // loop over tracks (if not done with the cache)
+  Int_t nTracks = cache ? 0 : fNumberOfTracks;
+  for(Int_t i=0; i<nTracks; i++)
   {
     pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
     if(pTrack)
@@ -676,11 +734,46 @@ void AliFlowEventSimple::Get2Qsub( AliFlowVector* Qarray,
     }
   } // end of if(weightsList)
 
+  // use the track cache if it was already filled for this event
+  AliFlowEventSimpleCache* cache = NULL;
+  if(fTrackCache && fTrackCache->IsValid(this) && iOrder>0 && iOrder<=fTrackCache->GetMaxHarmonic()) cache = fTrackCache;
+
   //loop over the two subevents
   for (Int_t s=0; s<2; s++)
   {
-    // loop over tracks
-    for(Int_t i=0; i<fNumberOfTracks; i++)
+    // loop over cached tracks, cos/sin are only taken from the cache if phi is not moved to the phi weight bin center
+    Bool_t usePhiBinCenter = (s == 0) ? (phiWeightsSub0 && iNbinsPhiSub0) : (phiWeightsSub1 && iNbinsPhiSub1);
+    Int_t nCachedTracks = cache ? cache->GetNumberOfTracks() : 0;
+    for(Int_t i=0; i<nCachedTracks; i++)
+    {
+      if(!cache->InRPSelection(i) || !cache->InSubevent(i,s)) continue;
+      dPhi    = cache->Phi(i);
+      dPt     = cache->Pt(i);
+      dEta    = cache->Eta(i);
+      dWeight = cache->Weight(i);
+      if(usePhiBinCenter)
+      {
+        TH1F* phiWeightsSub = (s == 0) ? phiWeightsSub0 : phiWeightsSub1;
+        Int_t phiBin = 1+(Int_t)(TMath::Floor(dPhi*phiWeightsSub->GetNbinsX()/TMath::TwoPi()));
+        dPhi  = phiWeightsSub->GetBinCenter(phiBin);
+        dWphi = phiWeightsSub->GetBinContent(phiBin);
+      }
+      if(ptWeights && dBinWidthPt)
+      {
+        dWpt=ptWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-dPtMin)/dBinWidthPt)));
+      }
+      if(etaWeights && dBinWidthEta)
+      {
+        dWeta=etaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-dEtaMin)/dBinWidthEta)));
+      }
+      dQX += dWeight*dWphi*dWpt*dWeta*(usePhiBinCenter ? TMath::Cos(iOrder*dPhi) : cache->Cos(iOrder,i));
+      dQY += dWeight*dWphi*dWpt*dWeta*(usePhiBinCenter ? TMath::Sin(iOrder*dPhi) : cache->Sin(iOrder,i));
+      sumOfWeights+=dWeight*dWphi*dWpt*dWeta;
+    }
+
+    // loop over tracks (if not done with the cache)
+    Int_t nTracks = cache ? 0 : fNumberOfTracks;
+    for(Int_t i=0; i<nTracks; i++)
     {
       pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
       if(!pTrack)
@@ -896,6 +989,7 @@ AliFlowEventSimple::AliFlowEventSimple( TTree* inputTree,
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fTrackCache(NULL),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -1001,6 +1095,7 @@ void AliFlowEventSimple::TagSubeventsInEta( Double_t etaMinA,
     if (eta >= etaMinA && eta <= etaMaxA) track->SetForSubevent(0);
     if (eta >= etaMinB && eta <= etaMaxB) track->SetForSubevent(1);
   }
+  InvalidateTrackCache();
 }
 
 //_____________________________________________________________________________
@@ -1016,6 +1111,7 @@ void AliFlowEventSimple::TagSubeventsByCharge()
     if (charge<0) track->SetForSubevent(0);
     if (charge>0) track->SetForSubevent(1);
   }
+  InvalidateTrackCache();
 }
 
 //_____________________________________________________________________________
@@ -1176,6 +1272,7 @@ void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
     }
     track->SetForRPSelection(pass);
   }
+  InvalidateTrackCache();
 }
 
 //_____________________________________________________________________________
@@ -1198,6 +1295,7 @@ void AliFlowEventSimple::TagPOI( const AliFlowTrackSimpleCuts* cuts, Int_t poiTy
     }
     track->Tag(poiType,pass);
   }
+  InvalidateTrackCache();
 }
 
 //_____________________________________________________________________________
@@ -1230,6 +1328,7 @@ void AliFlowEventSimple::DefineDeadZone( Double_t etaMin,
       track->ResetPOItype();
     }
   }
+  InvalidateTrackCache();
 }
 
 //_____________________________________________________________________________
@@ -1247,6 +1346,7 @@ Int_t AliFlowEventSimple::CleanUpDeadTracks()
   fTrackCollection->Compress(); //clean up empty slots
   fNumberOfTracks-=ncleaned; //update number of tracks
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  InvalidateTrackCache();
   return ncleaned;
 }
 
@@ -1286,4 +1386,5 @@ void AliFlowEventSimple::ClearFast()
   fAfterBurnerPrecision = 0.001;
   fUserModified = kFALSE;
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  InvalidateTrackCache();
 }
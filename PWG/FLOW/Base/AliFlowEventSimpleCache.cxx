@@ -0,0 +1,141 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/* $Id$ */
+
+// AliFlowEventSimpleCache:
+// Per-event cache of the track quantities of an AliFlowEventSimple,
+// shared by the flow analysis methods run on the same event.
+
+#include "TMath.h"
+#include "AliFlowTrackSimple.h"
+#include "AliFlowEventSimple.h"
+#include "AliFlowEventSimpleCache.h"
+
+ClassImp(AliFlowEventSimpleCache)
+
+//-----------------------------------------------------------------------
+AliFlowEventSimpleCache::AliFlowEventSimpleCache():
+  TObject(),
+  fValid(kFALSE),
+  fNumberOfTracks(0),
+  fNumberOfRPs(0),
+  fNumberOfPOIs(0),
+  fMaxHarmonic(0),
+  fPhi(),
+  fPt(),
+  fEta(),
+  fWeight(),
+  fTags(),
+  fSubevents(),
+  fCos(),
+  fSin()
+{
+  //ctor
+}
+
+//-----------------------------------------------------------------------
+AliFlowEventSimpleCache::~AliFlowEventSimpleCache()
+{
+  //dtor
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEventSimpleCache::Fill(AliFlowEventSimple* event)
+{
+  //copy the track quantities of the event, the memory of the
+  //previous event is reused
+  Invalidate();
+  if (!event) return;
+
+  fNumberOfTracks = event->NumberOfTracks();
+  fNumberOfRPs = event->GetNumberOfRPs();
+  fNumberOfPOIs = event->GetNumberOfPOIs();
+  fPhi.resize(fNumberOfTracks);
+  fPt.resize(fNumberOfTracks);
+  fEta.resize(fNumberOfTracks);
+  fWeight.resize(fNumberOfTracks);
+  fTags.resize(fNumberOfTracks);
+  fSubevents.resize(fNumberOfTracks);
+
+  for (Int_t i=0; i<fNumberOfTracks; i++)
+  {
+    AliFlowTrackSimple* track = event->GetTrack(i);
+    fTags[i] = 0;
+    fSubevents[i] = 0;
+    if (!track)
+    {
+      fPhi[i] = fPt[i] = fEta[i] = 0.;
+      fWeight[i] = 1.;
+      continue;
+    }
+    fPhi[i] = track->Phi();
+    fPt[i] = track->Pt();
+    fEta[i] = track->Eta();
+    fWeight[i] = track->Weight();
+    const TBits* tags = track->GetPOItype();
+    for (UInt_t p=tags->FirstSetBit(); p<tags->GetNbits() && p<(UInt_t)kMaxPOItypes; p=tags->FirstSetBit(p+1))
+    {
+      fTags[i] |= (1u<<p);
+    }
+    if (track->InSubevent(0)) fSubevents[i] |= 1;
+    if (track->InSubevent(1)) fSubevents[i] |= 2;
+  }
+
+  fValid = kTRUE;
+}
+
+//-----------------------------------------------------------------------
+Bool_t AliFlowEventSimpleCache::IsValid(const AliFlowEventSimple* event) const
+{
+  //cheap consistency check with the event, the event invalidates the
+  //cache when it is modified through its own methods
+  if (!fValid || !event) return kFALSE;
+  return fNumberOfTracks == event->NumberOfTracks() &&
+         fNumberOfRPs == event->GetNumberOfRPs() &&
+         fNumberOfPOIs == event->GetNumberOfPOIs();
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEventSimpleCache::Invalidate()
+{
+  //drop the content, allocated memory is kept
+  fValid = kFALSE;
+  fNumberOfTracks = 0;
+  fMaxHarmonic = 0;
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEventSimpleCache::SetMaxHarmonic(Int_t h)
+{
+  //extend the cos(h*phi), sin(h*phi) tables up to harmonic h; evaluated
+  //directly (no recurrence), so they agree exactly with TMath::Cos(h*phi)
+  if (!fValid || h <= fMaxHarmonic) return;
+  if (fNumberOfTracks == 0) { fMaxHarmonic = h; return; }
+
+  fCos.resize(h*fNumberOfTracks);
+  fSin.resize(h*fNumberOfTracks);
+  for (Int_t n=fMaxHarmonic+1; n<=h; n++)
+  {
+    Double_t* c = &fCos[0] + (n-1)*fNumberOfTracks;
+    Double_t* s = &fSin[0] + (n-1)*fNumberOfTracks;
+    for (Int_t i=0; i<fNumberOfTracks; i++)
+    {
+      c[i] = TMath::Cos(n*fPhi[i]);
+      s[i] = TMath::Sin(n*fPhi[i]);
+    }
+  }
+  fMaxHarmonic = h;
+}
@@ -0,0 +1,69 @@
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+* See cxx source for full Copyright notice */
+/* $Id$ */
+
+#ifndef ALIFLOWEVENTSIMPLECACHE_H
+#define ALIFLOWEVENTSIMPLECACHE_H
+
+#include <vector>
+#include "TObject.h"
+
+class AliFlowEventSimple;
+
+// AliFlowEventSimpleCache:
+// Per-event cache of the track quantities of an AliFlowEventSimple,
+// shared by all flow analysis methods run on the same event.
+// Phi, pt, eta, weight and the RP/POI/subevent tags are copied once
+// (structure of arrays, in AliFlowEventSimple::GetTrack() order), and
+// cos(h*phi), sin(h*phi) are computed once per harmonic h.
+// The cache is owned by the event, see AliFlowEventSimple::GetTrackCache().
+
+class AliFlowEventSimpleCache: public TObject {
+
+ public:
+
+  AliFlowEventSimpleCache();
+  virtual ~AliFlowEventSimpleCache();
+
+  void     Fill(AliFlowEventSimple* event);
+  Bool_t   IsValid(const AliFlowEventSimple* event) const;
+  void     Invalidate();
+  void     SetMaxHarmonic(Int_t h);
+
+  Int_t    GetNumberOfTracks() const                 { return fNumberOfTracks; }
+  Int_t    GetMaxHarmonic() const                    { return fMaxHarmonic; }
+  Double_t Phi(Int_t i) const                        { return fPhi[i]; }
+  Double_t Pt(Int_t i) const                         { return fPt[i]; }
+  Double_t Eta(Int_t i) const                        { return fEta[i]; }
+  Double_t Weight(Int_t i) const                     { return fWeight[i]; }
+  Bool_t   InRPSelection(Int_t i) const              { return fTags[i] & 1; }
+  Bool_t   InPOISelection(Int_t i, Int_t poiType=1) const { return poiType>=0 && poiType<kMaxPOItypes && (fTags[i] & (1u<<poiType)); }
+  Bool_t   InSubevent(Int_t i, Int_t s) const        { return s>=0 && s<2 && (fSubevents[i] & (1<<s)); }
+  Double_t Cos(Int_t h, Int_t i) const               { return h==0 ? 1. : fCos[(h-1)*fNumberOfTracks+i]; }
+  Double_t Sin(Int_t h, Int_t i) const               { return h==0 ? 0. : fSin[(h-1)*fNumberOfTracks+i]; }
+
+ private:
+
+  enum { kMaxPOItypes=32 };
+
+  AliFlowEventSimpleCache(const AliFlowEventSimpleCache& cache);
+  AliFlowEventSimpleCache& operator=(const AliFlowEventSimpleCache& cache);
+
+  Bool_t                fValid;           //! cache corresponds to current event
+  Int_t                 fNumberOfTracks;  //! number of cached tracks
+  Int_t                 fNumberOfRPs;     //! number of RPs when filled
+  Int_t                 fNumberOfPOIs;    //! number of POIs when filled
+  Int_t                 fMaxHarmonic;     //! highest harmonic of cos/sin tables
+  std::vector<Double_t> fPhi;             //! phi per track
+  std::vector<Double_t> fPt;              //! pt per track
+  std::vector<Double_t> fEta;             //! eta per track
+  std::vector<Double_t> fWeight;          //! track weight per track
+  std::vector<UInt_t>   fTags;            //! bit p set if track is POI of type p (p=0: RP)
+  std::vector<UChar_t>  fSubevents;       //! bit s set if track is in subevent s
+  std::vector<Double_t> fCos;             //! cos(h*phi), harmonic major
+  std::vector<Double_t> fSin;             //! sin(h*phi), harmonic major
+
+  ClassDef(AliFlowEventSimpleCache,1)
+};
+
+#endif
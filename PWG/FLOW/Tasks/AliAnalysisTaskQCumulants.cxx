@@ -70,6 +70,8 @@ AliAnalysisTaskQCumulants::AliAnalysisTaskQCumulants(const char *name, Bool_t us
  fUse2DHistograms(kFALSE),
  fFillProfilesVsMUsingWeights(kTRUE),
  fUseQvectorTerms(kFALSE),
+ fUseTrackCache(kFALSE),
+ fUseTypedDiffFlow(kFALSE),
  fnBinsMult(10000),
  fMinMult(0.),  
  fMaxMult(10000.), 
@@ -168,6 +170,8 @@ AliAnalysisTaskQCumulants::AliAnalysisTaskQCumulants():
  fUse2DHistograms(kFALSE),
  fFillProfilesVsMUsingWeights(kTRUE),
  fUseQvectorTerms(kFALSE),
+ fUseTrackCache(kFALSE),
+ fUseTypedDiffFlow(kFALSE),
  fnBinsMult(0),
  fMinMult(0.),  
  fMaxMult(0.), 
@@ -283,6 +287,8 @@ void AliAnalysisTaskQCumulants::UserCreateOutputObjects()
  fQC->SetUse2DHistograms(fUse2DHistograms);
  fQC->SetFillProfilesVsMUsingWeights(fFillProfilesVsMUsingWeights);
  fQC->SetUseQvectorTerms(fUseQvectorTerms);
+ fQC->SetUseTrackCache(fUseTrackCache);
+ fQC->SetUseTypedDiffFlow(fUseTypedDiffFlow);
 
  // Store phi distribution for one event to illustrate flow:
  fQC->SetStorePhiDistributionForOneEvent(fStorePhiDistributionForOneEvent);
@@ -354,6 +360,14 @@ void AliAnalysisTaskQCumulants::UserExec(Option_t *)
 
 //================================================================================================================
 
+void AliAnalysisTaskQCumulants::FinishTaskOutput()
+{
+ // add the fills buffered by the typed differential flow path to the output, before it is merged
+ if(fQC){fQC->FlushDiffFlowBuffers();}
+}
+
+//================================================================================================================
+
 void AliAnalysisTaskQCumulants::Terminate(Option_t *) 
 {
  //accessing the merged output list: 
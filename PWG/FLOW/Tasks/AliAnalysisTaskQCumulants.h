@@ -36,6 +36,7 @@ class AliAnalysisTaskQCumulants : public AliAnalysisTaskSE{
   
   virtual void UserCreateOutputObjects();
   virtual void UserExec(Option_t *option);
+  virtual void FinishTaskOutput();
   virtual void Terminate(Option_t *);
   
   // Common:
@@ -87,6 +88,10 @@ class AliAnalysisTaskQCumulants : public AliAnalysisTaskSE{
   Bool_t GetFillProfilesVsMUsingWeights() const {return this->fFillProfilesVsMUsingWeights;};
   void SetUseQvectorTerms(Bool_t const uqvt){this->fUseQvectorTerms = uqvt;if(uqvt){this->fStoreControlHistograms = kTRUE;}};
   Bool_t GetUseQvectorTerms() const {return this->fUseQvectorTerms;};
+  void SetUseTrackCache(Bool_t const utc){this->fUseTrackCache = utc;};
+  Bool_t GetUseTrackCache() const {return this->fUseTrackCache;};
+  void SetUseTypedDiffFlow(Bool_t const utdf){this->fUseTypedDiffFlow = utdf;};
+  Bool_t GetUseTypedDiffFlow() const {return this->fUseTypedDiffFlow;};
  
   // Multiparticle correlations vs multiplicity:
   void SetnBinsMult(Int_t const nbm) {this->fnBinsMult = nbm;};
@@ -165,6 +170,8 @@ class AliAnalysisTaskQCumulants : public AliAnalysisTaskSE{
   Bool_t fUse2DHistograms;               // use TH2D instead of TProfile to improve numerical stability in reference flow calculation   
   Bool_t fFillProfilesVsMUsingWeights;   // if the width of multiplicity bin is 1, weights are not needed   
   Bool_t fUseQvectorTerms; // use TH2D with separate Q-vector terms instead of TProfile to improve numerical stability in reference flow calculation    
+  Bool_t fUseTrackCache; // read tracks from the per-event cache of AliFlowEventSimple, shared with the other methods
+  Bool_t fUseTypedDiffFlow; // without particle weights, evaluate diff. flow in one pass per type and pt/eta, with the fills buffered until the end
   // Multiparticle correlations vs multiplicity:
   Int_t fnBinsMult;                   // number of multiplicity bins for flow analysis versus multiplicity  
   Double_t fMinMult;                  // minimal multiplicity for flow analysis versus multiplicity  
@@ -192,7 +199,7 @@ class AliAnalysisTaskQCumulants : public AliAnalysisTaskSE{
   Bool_t fUseBootstrapVsM; // use bootstrap to estimate statistical spread for results vs M
   Int_t fnSubsamples; // number of subsamples (SS), by default 10
   
-  ClassDef(AliAnalysisTaskQCumulants, 2); 
+  ClassDef(AliAnalysisTaskQCumulants, 4); 
 };
 
 //================================================================================================================
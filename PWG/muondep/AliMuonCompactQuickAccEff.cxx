@@ -12,12 +12,60 @@
 #include "TMath.h"
 #include "TParameter.h"
 #include "TTree.h"
+#include <algorithm>
 #include <cassert>
+#include <functional>
 #include <iostream>
+#include <thread>
+
+namespace {
+
+    /// rapidity of the pair, both tracks being muons
+    double PairRapidity(const AliMuonCompactTrack& t1, const AliMuonCompactTrack& t2)
+    {
+        const double m2 = 0.1056584*0.1056584;
+
+        double p1square = t1.mPx*t1.mPx +
+            t1.mPy*t1.mPy +
+            t1.mPz*t1.mPz;
+
+        double p2square = t2.mPx*t2.mPx +
+            t2.mPy*t2.mPy +
+            t2.mPz*t2.mPz;
+
+        double e = sqrt(m2+p1square+p2square+2.0*sqrt(p1square)*sqrt(p2square));
+        double pz = t1.mPz+t2.mPz;
+
+        return 0.5*log( (e+pz) / (e-pz) );
+    }
+}
+
+/// Run-independent index of the sample : tracks, the manus
+/// they touch, and their partners in dimuons within the
+/// rapidity range
+struct AliMuonCompactQuickAccEff::TrackIndex
+{
+    std::vector<const AliMuonCompactTrack*> mTracks; ///< all the tracks of the sample
+    std::vector<std::vector<int> > mTrackManus; ///< manu indices touched by each track
+    std::vector<std::vector<int> > mManuTracks; ///< tracks touching each manu (inverted index)
+    std::vector<std::vector<int> > mTrackPartners; ///< tracks forming a pair in the rapidity range with each track
+};
+
+/// Validation state of the sample for one cause mask
+struct AliMuonCompactQuickAccEff::CauseState
+{
+    std::vector<char> mManuBad; ///< manu status & cause mask != 0
+    std::vector<char> mTrackValid; ///< track validated
+    std::vector<int> mTrackStamp; ///< to flag the tracks to be re-validated only once per update
+    int mStamp = 0;
+    Int_t mNofValidatedTracks = 0;
+    Int_t mNofPairs = 0;
+    bool mInitialized = false;
+};
 
 /// \ingroup compact
 AliMuonCompactQuickAccEff::AliMuonCompactQuickAccEff(int maxevents, bool rejectMonoCathodeClusters)
-    : fMaxEvents(maxevents), fRejectMonoCathodeClusters(rejectMonoCathodeClusters)
+    : fMaxEvents(maxevents), fRejectMonoCathodeClusters(rejectMonoCathodeClusters), fNumberOfThreads(1)
 {
 }
 
@@ -227,10 +275,7 @@ TH1* AliMuonCompactQuickAccEff::ComputeMinv(const std::vector<AliMuonCompactEven
                             - (t1.mPx*t2.mPx+t1.mPy*t2.mPy+
                                 t1.mPz*t2.mPz)));
                 
-                double e = sqrt(m2+p1square+p2square+2.0*sqrt(p1square)*sqrt(p2square));
-                double pz = t1.mPz+t2.mPz;
-
-                double y = 0.5*log( (e+pz) / (e-pz) );
+                double y = PairRapidity(t1,t2);
 
                 // TLorentzVector v1;
                 // TLorentzVector v2;
@@ -258,6 +303,207 @@ TH1* AliMuonCompactQuickAccEff::ComputeMinv(const std::vector<AliMuonCompactEven
     return h;
 }
 
+void AliMuonCompactQuickAccEff::BuildTrackIndex(const std::vector<AliMuonCompactEvent>& events,
+        TrackIndex& index) const
+{
+    /// Index the tracks of the sample by the manus they touch, and
+    /// find, for each track, the tracks it makes a pair with in the
+    /// rapidity range. This does not depend on the manu status.
+
+    std::vector<AliMuonCompactEvent>::size_type maxevents = events.size();
+
+    if ( fMaxEvents && fMaxEvents < maxevents )
+    {
+        maxevents = fMaxEvents;
+    }
+
+    int maxManuIndex = -1;
+
+    for ( std::vector<AliMuonCompactEvent>::size_type i = 0;
+             i < maxevents; ++i )
+    {
+        const AliMuonCompactEvent& e = events[i];
+        const int firstTrack = index.mTracks.size();
+
+        for ( std::vector<AliMuonCompactTrack>::size_type j = 0;
+                j < e.mTracks.size(); ++j ) 
+        {
+            const AliMuonCompactTrack& t = e.mTracks[j];
+            std::vector<int> manus;
+
+            for ( std::vector<AliMuonCompactCluster>::size_type k = 0;
+                    k < t.mClusters.size(); ++k )
+            {
+                const AliMuonCompactCluster& cl = t.mClusters[k];
+                if ( cl.BendingManuIndex() >= 0 ) manus.push_back(cl.BendingManuIndex());
+                if ( cl.NonBendingManuIndex() >= 0 ) manus.push_back(cl.NonBendingManuIndex());
+            }
+
+            std::sort(manus.begin(),manus.end());
+            manus.erase(std::unique(manus.begin(),manus.end()),manus.end());
+
+            if ( !manus.empty() ) maxManuIndex = std::max(maxManuIndex,manus.back());
+
+            index.mTracks.push_back(&t);
+            index.mTrackManus.push_back(manus);
+            index.mTrackPartners.push_back(std::vector<int>());
+        }
+
+        for ( std::vector<AliMuonCompactTrack>::size_type j = 0;
+                j < e.mTracks.size(); ++j ) 
+        {
+            for ( std::vector<AliMuonCompactTrack>::size_type k = j+1;
+                    k < e.mTracks.size(); ++k )
+            {
+                double y = PairRapidity(e.mTracks[j],e.mTracks[k]);
+
+                if (y >= -4 && y <= -2.5 )
+                {
+                    index.mTrackPartners[firstTrack+j].push_back(firstTrack+k);
+                    index.mTrackPartners[firstTrack+k].push_back(firstTrack+j);
+                }
+            }
+        }
+    }
+
+    index.mManuTracks.resize(maxManuIndex+1);
+
+    for ( std::vector<const AliMuonCompactTrack*>::size_type t = 0; t < index.mTracks.size(); ++t )
+    {
+        for ( std::vector<int>::size_type m = 0; m < index.mTrackManus[t].size(); ++m )
+        {
+            index.mManuTracks[index.mTrackManus[t][m]].push_back(t);
+        }
+    }
+}
+
+void AliMuonCompactQuickAccEff::UpdateCauseState(const TrackIndex& index,
+        const std::vector<UInt_t>& manuStatus,
+        UInt_t causeMask,
+        CauseState& state)
+{
+    /// Update the validated tracks and the number of pairs for a new manu status.
+    /// The first time all the tracks are validated, afterwards only the tracks
+    /// touching a manu which changed from good to bad (or the reverse) for
+    /// this cause are re-validated, and the pair count is updated accordingly.
+
+    const int ntracks = index.mTracks.size();
+
+    if ( !state.mInitialized || state.mManuBad.size() != manuStatus.size() )
+    {
+        state.mManuBad.resize(manuStatus.size());
+        for ( std::vector<UInt_t>::size_type m = 0; m < manuStatus.size(); ++m )
+        {
+            state.mManuBad[m] = ( ( manuStatus[m] & causeMask ) != 0 );
+        }
+
+        state.mTrackValid.assign(ntracks,0);
+        state.mTrackStamp.assign(ntracks,0);
+        state.mNofValidatedTracks = 0;
+        state.mNofPairs = 0;
+
+        for ( int t = 0; t < ntracks; ++t )
+        {
+            state.mTrackValid[t] = ValidateTrack(*(index.mTracks[t]),manuStatus,causeMask);
+            if ( state.mTrackValid[t] ) ++state.mNofValidatedTracks;
+        }
+
+        for ( int t = 0; t < ntracks; ++t )
+        {
+            if ( !state.mTrackValid[t] ) continue;
+            const std::vector<int>& partners = index.mTrackPartners[t];
+            for ( std::vector<int>::size_type p = 0; p < partners.size(); ++p )
+            {
+                if ( partners[p] > t && state.mTrackValid[partners[p]] ) ++state.mNofPairs;
+            }
+        }
+
+        state.mInitialized = true;
+        return;
+    }
+
+    ++state.mStamp;
+
+    std::vector<int> affectedTracks;
+
+    for ( std::vector<UInt_t>::size_type m = 0; m < manuStatus.size(); ++m )
+    {
+        char bad = ( ( manuStatus[m] & causeMask ) != 0 );
+        if ( bad == state.mManuBad[m] ) continue;
+
+        state.mManuBad[m] = bad;
+
+        if ( m >= index.mManuTracks.size() ) continue;
+
+        const std::vector<int>& tracks = index.mManuTracks[m];
+        for ( std::vector<int>::size_type i = 0; i < tracks.size(); ++i )
+        {
+            if ( state.mTrackStamp[tracks[i]] == state.mStamp ) continue;
+            state.mTrackStamp[tracks[i]] = state.mStamp;
+            affectedTracks.push_back(tracks[i]);
+        }
+    }
+
+    for ( std::vector<int>::size_type i = 0; i < affectedTracks.size(); ++i )
+    {
+        const int t = affectedTracks[i];
+        char valid = ValidateTrack(*(index.mTracks[t]),manuStatus,causeMask);
+
+        if ( valid == state.mTrackValid[t] ) continue;
+
+        // pairs with the currently valid partners are gained or lost
+        Int_t nValidPartners = 0;
+        const std::vector<int>& partners = index.mTrackPartners[t];
+        for ( std::vector<int>::size_type p = 0; p < partners.size(); ++p )
+        {
+            if ( state.mTrackValid[partners[p]] ) ++nValidPartners;
+        }
+
+        state.mTrackValid[t] = valid;
+
+        if ( valid )
+        {
+            ++state.mNofValidatedTracks;
+            state.mNofPairs += nValidPartners;
+        }
+        else
+        {
+            --state.mNofValidatedTracks;
+            state.mNofPairs -= nValidPartners;
+        }
+    }
+}
+
+void AliMuonCompactQuickAccEff::ComputeRunRange(const TrackIndex& index,
+        const std::vector<int>& vrunlist,
+        std::vector<int>::size_type first,
+        std::vector<int>::size_type last,
+        const std::map<int,std::vector<UInt_t> >& manuStatusForRuns,
+        const std::vector<UInt_t>& causes,
+        std::vector<std::vector<Int_t> >& npairs,
+        std::vector<std::vector<Int_t> >& nvalidated)
+{
+    /// Compute the number of pairs for runs [first,last[ of the list,
+    /// for each cause. Only the rows first..last-1 of npairs and nvalidated
+    /// are written, so that ranges can be processed in parallel.
+
+    std::vector<CauseState> states(causes.size());
+
+    for ( std::vector<int>::size_type i = first; i < last; ++i )
+    {
+        std::map<int, std::vector<UInt_t> >::const_iterator it = manuStatusForRuns.find(vrunlist[i]);
+
+        if ( it == manuStatusForRuns.end() ) continue;
+
+        for ( std::vector<UInt_t>::size_type icause = 0; icause < causes.size(); ++icause )
+        {
+            UpdateCauseState(index,it->second,causes[icause],states[icause]);
+            npairs[i][icause] = states[icause].mNofPairs;
+            nvalidated[i][icause] = states[icause].mNofValidatedTracks;
+        }
+    }
+}
+
 void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompactEvent>& events, 
         std::vector<int>& vrunlist,
         const std::map<int,std::vector<UInt_t> >& manuStatusForRuns,
@@ -267,14 +513,10 @@ void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompac
     std::vector<TH1*> hminv;
     Int_t referenceNofJpsi;
     TH1* h = ComputeMinv(events,std::vector<UInt_t>(),0,referenceNofJpsi);
-    Int_t b1 = 1;
-    Int_t b2 = 1;
     if (h) 
     {
         hminv.push_back(h);
-        b1 = 1; //h->GetXaxis()->FindBin(2.8);
-        b2 = h->GetXaxis()->GetNbins(); //h->GetXaxis()->FindBin(3.4);
-        referenceNofJpsi = TMath::Nint(h->Integral(b1,b2));
+        referenceNofJpsi = TMath::Nint(h->Integral(1,h->GetXaxis()->GetNbins()));
     }
 
 
@@ -320,6 +562,47 @@ void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompac
         g->SetMarkerSize(1.5);
     }
 
+    // index the sample once, then process independent ranges of runs,
+    // the validation being updated incrementally from one run to the next
+    // within a range
+
+    TrackIndex index;
+    BuildTrackIndex(events,index);
+
+    std::vector<std::vector<Int_t> > npairs(vrunlist.size(),std::vector<Int_t>(causes.size(),0));
+    std::vector<std::vector<Int_t> > nvalidated(npairs);
+
+    int nthreads = std::min<int>(fNumberOfThreads,vrunlist.size());
+
+    if ( nthreads <= 1 )
+    {
+        ComputeRunRange(index,vrunlist,0,vrunlist.size(),manuStatusForRuns,causes,npairs,nvalidated);
+    }
+    else
+    {
+        std::cout << Form("Processing %d runs in %d ranges",(int)vrunlist.size(),nthreads) << std::endl;
+
+        std::vector<std::thread> threads;
+        std::vector<int>::size_type chunk = (vrunlist.size()+nthreads-1)/nthreads;
+
+        for ( int ithread = 0; ithread < nthreads; ++ithread )
+        {
+            std::vector<int>::size_type first = ithread*chunk;
+            std::vector<int>::size_type last = std::min(first+chunk,vrunlist.size());
+            if ( first >= last ) break;
+
+            threads.emplace_back(&AliMuonCompactQuickAccEff::ComputeRunRange,this,
+                    std::cref(index),std::cref(vrunlist),first,last,
+                    std::cref(manuStatusForRuns),std::cref(causes),
+                    std::ref(npairs),std::ref(nvalidated));
+        }
+
+        for ( std::vector<std::thread>::size_type ithread = 0; ithread < threads.size(); ++ithread )
+        {
+            threads[ithread].join();
+        }
+    }
+
     for ( std::vector<int>::size_type i = 0; i < vrunlist.size(); ++i )
     {
         Int_t runNumber = vrunlist[i];
@@ -328,6 +611,12 @@ void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompac
 
         std::map<int, std::vector<UInt_t> >::const_iterator it = manuStatusForRuns.find(runNumber);
 
+        if ( it == manuStatusForRuns.end() )
+        {
+            std::cout << Form("RUN %6d no manu status found, skipping",runNumber) << std::endl;
+            continue;
+        }
+
         const std::vector<UInt_t>& manustatus = it->second; 
 
         for ( std::vector<UInt_t>::size_type icause = 0; icause < causes.size(); ++icause )
@@ -340,23 +629,10 @@ void AliMuonCompactQuickAccEff::ComputeEvolution(const std::vector<AliMuonCompac
                 AliMuonCompactManuStatus::CauseAsString(causes[icause]).c_str(),
                 nbad
                 );
-            Int_t npairs(0);
-            TH1* h = ComputeMinv(events,manustatus,causes[icause],npairs);
-            if (h)
-            {
-                h->SetName(Form("hminv%6d%s",runNumber,AliMuonCompactManuStatus::CauseAsString(causes[icause]).c_str()));
-                hminv.push_back(h); 
-            }
-            Double_t drop = 0.0;
-            if ( h) 
-            {
-                drop = 100.0*(1.0-h->Integral(b1,b2)/referenceNofJpsi);
-            }
-            else
-            {
-                drop = 100.0*(1.0 - npairs*1.0/referenceNofJpsi);
-            }
-            Double_t relativeError = TMath::Sqrt(1.0/npairs + 1.0/referenceNofJpsi);
+            std::cout << Form("nTracks %d nValidated %d npairs %d",(int)index.mTracks.size(),
+                    nvalidated[i][icause],npairs[i][icause]) << std::endl;
+            Double_t drop = 100.0*(1.0 - npairs[i][icause]*1.0/referenceNofJpsi);
+            Double_t relativeError = TMath::Sqrt(1.0/npairs[i][icause] + 1.0/referenceNofJpsi);
             Double_t dropError = drop*relativeError;
             std::cout << Form("RUN %6d %30s AccxEff drop %7.2f %% +- %5.2f %%",
                     runNumber," ",drop,dropError) << std::endl;
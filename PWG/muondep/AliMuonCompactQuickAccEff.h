@@ -22,6 +22,13 @@ class TTree;
   This class is meant to get a quick computation of
   the evolution of the Acc x Eff for some runs.
 
+  In ComputeEvolution the tracks and the dimuons of the sample are
+  indexed once by the manus they touch, so that, from one run to the
+  next, only the tracks touching a manu whose status changed are
+  re-validated and the number of pairs is updated incrementally.
+  The run list can be split into independent ranges processed by
+  several threads (see SetNumberOfThreads).
+
 */
 
 
@@ -61,9 +68,31 @@ class AliMuonCompactQuickAccEff
 
         UInt_t GetEvents(const char* treeFile, std::vector<AliMuonCompactEvent>& events, Bool_t verbose=kFALSE);
 
+        void SetNumberOfThreads(int n) { fNumberOfThreads = n > 0 ? n : 1; }
+
     private:
+        struct TrackIndex;
+        struct CauseState;
+
+        void BuildTrackIndex(const std::vector<AliMuonCompactEvent>& events, TrackIndex& index) const;
+
+        void UpdateCauseState(const TrackIndex& index,
+                const std::vector<UInt_t>& manuStatus,
+                UInt_t causeMask,
+                CauseState& state);
+
+        void ComputeRunRange(const TrackIndex& index,
+                const std::vector<int>& vrunlist,
+                std::vector<int>::size_type first,
+                std::vector<int>::size_type last,
+                const std::map<int,std::vector<UInt_t> >& manuStatusForRuns,
+                const std::vector<UInt_t>& causes,
+                std::vector<std::vector<Int_t> >& npairs,
+                std::vector<std::vector<Int_t> >& nvalidated);
+
         ULong64_t fMaxEvents;
         bool fRejectMonoCathodeClusters;
+        int fNumberOfThreads;
 };
 
 #endif
@@ -27,6 +27,7 @@
 #include "AliNeutralMesonSelection.h"
 #include "AliAnaParticleHadronCorrelation.h"
 #include "AliCaloTrackReader.h"
+#include "AliCaloTrackMixingPool.h"
 #include "AliCaloTrackParticleCorrelation.h"
 #include "AliFiducialCut.h"
 #include "AliVTrack.h"
@@ -73,6 +74,9 @@ fNTrigPtBins(0),                fTrigPtBinLimit(),
 fCorrelVzBin(0),
 fListMixTrackEvents(),          fListMixCaloEvents(),
 fUseMixStoredInReader(0),       fFillNeutralEventMixPool(0),
+fUseSharedMixPool(0),           fMixPoolTrackView(-1),
+fMixPoolCaloView(-1),           fMixTrackParticles(0),
+fMixCaloParticles(0),
 fM02MaxCut(0),                  fM02MinCut(0),
 fSelectLeadingHadronAngle(0),   fFillLeadHadOppositeHisto(0),
 fMinLeadHadPhi(0),              fMaxLeadHadPhi(0),
@@ -283,6 +287,9 @@ AliAnaParticleHadronCorrelation::~AliAnaParticleHadronCorrelation()
     
     delete[] fListMixCaloEvents;
   }
+  
+  if ( fMixTrackParticles ) { fMixTrackParticles->Delete() ; delete fMixTrackParticles ; }
+  if ( fMixCaloParticles  ) { fMixCaloParticles ->Delete() ; delete fMixCaloParticles  ; }
 }
 
 //____________________________________________________________________________________________________________________________________
@@ -1243,7 +1250,15 @@ void AliAnaParticleHadronCorrelation::FillEventMixPool()
 //_____________________________________________________________
 void AliAnaParticleHadronCorrelation::FillChargedEventMixPool()
 {
-  if ( fUseMixStoredInReader && 
+  AliCaloTrackMixingPool * sharedPool = 0x0;
+  Bool_t sharedPoolFilled = kFALSE;
+  if ( fUseSharedMixPool ) 
+  {
+    // pool possibly filled previously for another analysis, only count this analysis particles
+    sharedPool = GetReader()->GetMixingPool();
+    sharedPoolFilled = ( sharedPool->GetLastFilledEvent(AliCaloTrackMixingPool::kTracks) == GetEventNumber() );
+  }
+  else if ( fUseMixStoredInReader && 
        GetReader()->GetLastTracksMixedEvent() == GetEventNumber() )
   {
     //printf("%s : Pool already filled for this event !!!\n",GetInputAODName().Data());
@@ -1265,6 +1280,34 @@ void AliAnaParticleHadronCorrelation::FillChargedEventMixPool()
   
   fhEventMBBin->Fill(eventBin, GetEventWeight());
   
+  // Compact shared pool, store the tracks accepted by any of the analysis views
+  if ( sharedPool )
+  {
+    if ( !sharedPoolFilled )
+    {
+      sharedPool->StartEvent(AliCaloTrackMixingPool::kTracks, eventBin, GetEventNumber());
+      
+      for(Int_t ipr = 0;ipr < GetCTSTracks()->GetEntriesFast() ; ipr ++ )
+      {
+        AliVTrack * track = (AliVTrack *) (GetCTSTracks()->At(ipr)) ;
+        
+        if ( !sharedPool->AcceptPt(AliCaloTrackMixingPool::kTracks, track->Pt()) ) continue ;
+        
+        UChar_t bits = AliCaloTrackMixingPool::kCharged;
+        if ( track->Charge() > 0 ) bits |= AliCaloTrackMixingPool::kPositive;
+        
+        sharedPool->AddParticle(track->Px(), track->Py(), track->Pz(), 0, kCTS, bits);
+      }
+      
+      sharedPool->FinishEvent();
+    }
+    
+    // Tracks of this analysis, as in the non shared pools
+    fhNtracksMB->Fill(sharedPool->GetNAccepted(fMixPoolTrackView, eventBin, 0), eventBin, GetEventWeight());
+    
+    return;
+  }
+  
   TObjArray * mixEventTracks = new TObjArray;
   
   if ( fUseMixStoredInReader )
@@ -1322,7 +1365,15 @@ void AliAnaParticleHadronCorrelation::FillNeutralEventMixPool()
 {
   //printf("FillNeutralEventMixPool for %s\n",GetInputAODName().Data());
   
-  if ( fUseMixStoredInReader && 
+  AliCaloTrackMixingPool * sharedPool = 0x0;
+  Bool_t sharedPoolFilled = kFALSE;
+  if ( fUseSharedMixPool ) 
+  {
+    // pool possibly filled previously for another analysis, only count this analysis particles
+    sharedPool = GetReader()->GetMixingPool();
+    sharedPoolFilled = ( sharedPool->GetLastFilledEvent(AliCaloTrackMixingPool::kCalo) == GetEventNumber() );
+  }
+  else if ( fUseMixStoredInReader && 
        GetReader()->GetLastCaloMixedEvent() == GetEventNumber() )
   {
     //printf("%s : Pool already filled for this event !!!\n",GetInputAODName().Data());
@@ -1346,6 +1397,39 @@ void AliAnaParticleHadronCorrelation::FillNeutralEventMixPool()
   // Check that the bin exists, if not (bad determination of RP, centrality or vz bin) do nothing
   if ( eventBin < 0 ) return;
   
+  // Compact shared pool, store the clusters accepted by any of the analysis views,
+  // flag the track matched ones instead of removing them
+  if ( sharedPool )
+  {
+    if ( !sharedPoolFilled )
+    {
+      sharedPool->StartEvent(AliCaloTrackMixingPool::kCalo, eventBin, GetEventNumber());
+      
+      Double_t vertex[]={0,0,0};
+      for(Int_t ipr = 0;ipr <  pl->GetEntriesFast() ; ipr ++ )
+      {
+        AliVCluster * calo = (AliVCluster *) (pl->At(ipr)) ;
+        
+        if ( GetReader()->GetDataType() != AliCaloTrackReader::kMC ) calo->GetMomentum(fMomentum,GetVertex(0)) ;
+        else                                                         calo->GetMomentum(fMomentum,vertex) ;
+        
+        if ( !sharedPool->AcceptPt(AliCaloTrackMixingPool::kCalo, fMomentum.Pt()) ) continue ;
+        
+        UChar_t bits = 0;
+        if ( IsTrackMatched( calo, GetReader()->GetInputEvent() ) ) bits |= AliCaloTrackMixingPool::kTrackMatched;
+        
+        sharedPool->AddParticle(fMomentum.Px(), fMomentum.Py(), fMomentum.Pz(), fMomentum.E(), kEMCAL, bits);
+      }
+      
+      sharedPool->FinishEvent();
+    }
+    
+    // Not matched clusters of this analysis, as in the non shared pools
+    fhNclustersMB->Fill(sharedPool->GetNAccepted(fMixPoolCaloView, eventBin, 0), eventBin, GetEventWeight());
+    
+    return;
+  }
+  
   TObjArray * mixEventCalo = new TObjArray;
   
   if ( fUseMixStoredInReader )
@@ -3353,9 +3437,39 @@ TList *  AliAnaParticleHadronCorrelation::GetCreateOutputObjects()
   
   if ( DoOwnMix() )
   {
+    // Register on the shared compact pool, fall back to the TList pools if the
+    // event binning is not the same as the one of the other analysis of the reader
+    if ( fUseSharedMixPool )
+    {
+      AliCaloTrackMixingPool * sharedPool = GetReader()->GetMixingPool();
+      
+      if ( sharedPool->Init(GetNCentrBin()*GetNZvertBin()*GetNRPBin()) )
+      {
+        fMixPoolTrackView = sharedPool->RegisterView(AliCaloTrackMixingPool::kTracks, GetNMaxEvMix(), 
+                                                     fMinAssocPt, fMaxAssocPt);
+        
+        if ( neutralMix )
+          fMixPoolCaloView = sharedPool->RegisterView(AliCaloTrackMixingPool::kCalo, GetNMaxEvMix(),
+                                                      fMinAssocPt, fMaxAssocPt, 
+                                                      0, AliCaloTrackMixingPool::kTrackMatched);
+        
+        fMixTrackParticles = new TClonesArray("AliCaloTrackParticle",100);
+        fMixCaloParticles  = new TClonesArray("AliCaloTrackParticle",100);
+      }
+      else
+      {
+        AliWarning("Different event mixing binning than other analysis, do not use the shared pool");
+        fUseSharedMixPool = kFALSE;
+      }
+    }
+    
     // Create event containers
     
-    if ( !fUseMixStoredInReader || 
+    if ( fUseSharedMixPool ) 
+    {
+      // nothing to do, pool in reader
+    }
+    else if ( !fUseMixStoredInReader || 
        (fUseMixStoredInReader && !GetReader()->ListWithMixedEventsForTracksExists()) )
     {
       Int_t nvz = GetNZvertBin();
@@ -3424,7 +3538,7 @@ TList *  AliAnaParticleHadronCorrelation::GetCreateOutputObjects()
     outputContainer->Add(fhEtaTriggerMixed);
     
     // Fill the cluster pool only in isolation analysis or if requested
-    if ( neutralMix && 
+    if ( neutralMix && !fUseSharedMixPool &&
         (!fUseMixStoredInReader || (fUseMixStoredInReader && !GetReader()->ListWithMixedEventsForCaloExists())) )
     {
       Int_t nvz = GetNZvertBin();
@@ -3452,7 +3566,7 @@ TList *  AliAnaParticleHadronCorrelation::GetCreateOutputObjects()
     }
     
     // Init the list in the reader if not done previously
-    if ( fUseMixStoredInReader )
+    if ( fUseMixStoredInReader && !fUseSharedMixPool )
     {
       if ( !GetReader()->ListWithMixedEventsForTracksExists() )
         GetReader()->SetListWithMixedEventsForTracks(fListMixTrackEvents);
@@ -4814,7 +4928,14 @@ void AliAnaParticleHadronCorrelation::MakeChargedMixCorrelation(AliCaloTrackPart
   
   TList * pool     = 0;
   TList * poolCalo = 0;
-  if ( fUseMixStoredInReader )
+  AliCaloTrackMixingPool * sharedPool = 0x0;
+  Int_t   nMixEvents = 0;
+  if ( fUseSharedMixPool )
+  {
+    sharedPool = GetReader()->GetMixingPool();
+    nMixEvents = sharedPool->GetNEvents(fMixPoolTrackView, eventBin);
+  }
+  else if ( fUseMixStoredInReader )
   {
     pool     = GetReader()->GetListWithMixedEventsForTracks(eventBin);
     if ( neutralMix ) poolCalo = GetReader()->GetListWithMixedEventsForCalo  (eventBin);
@@ -4825,9 +4946,16 @@ void AliAnaParticleHadronCorrelation::MakeChargedMixCorrelation(AliCaloTrackPart
     if ( neutralMix ) poolCalo = fListMixCaloEvents [eventBin];
   }
   
-  if ( !pool ) return ;
-  
-  if ( neutralMix && !poolCalo )
+  if ( !sharedPool )
+  {
+    if ( !pool ) return ;
+    
+    if ( neutralMix && !poolCalo )
+      AliWarning("Careful, cluster pool not available");
+    
+    nMixEvents = pool->GetSize();
+  }
+  else if ( neutralMix && fMixPoolCaloView < 0 )
     AliWarning("Careful, cluster pool not available");
   
   Double_t ptTrig  = aodParticle->Pt();
@@ -4836,7 +4964,7 @@ void AliAnaParticleHadronCorrelation::MakeChargedMixCorrelation(AliCaloTrackPart
   if ( phiTrig < 0. ) phiTrig+=TMath::TwoPi();
   
   AliDebug(1,Form("Pool bin %d size %d, trigger trigger pt=%f, phi=%f, eta=%f",
-                  eventBin,pool->GetSize(), ptTrig,phiTrig,etaTrig));
+                  eventBin,nMixEvents, ptTrig,phiTrig,etaTrig));
   
   Double_t ptAssoc  = -999.;
   Double_t phiAssoc = -999.;
@@ -4847,18 +4975,40 @@ void AliAnaParticleHadronCorrelation::MakeChargedMixCorrelation(AliCaloTrackPart
   
   // Start from first event in pool except if in this same event the pool was filled
   Int_t ev0 = 0;
-  if ( GetReader()->GetLastTracksMixedEvent() == GetEventNumber() ) ev0 = 1;
+  if      (  sharedPool && sharedPool->GetEventNumber(fMixPoolTrackView, eventBin, 0) == GetEventNumber() ) ev0 = 1;
+  else if ( !sharedPool && GetReader()->GetLastTracksMixedEvent() == GetEventNumber() ) ev0 = 1;
   
-  for(Int_t ev=ev0; ev < pool->GetSize(); ev++)
+  for(Int_t ev=ev0; ev < nMixEvents; ev++)
   {
     //
     // Recover the lists of tracks or clusters
     //
-    TObjArray* bgTracks = static_cast<TObjArray*>(pool->At(ev));
+    TObjArray* bgTracks = 0;
     TObjArray* bgCalo   = 0;
     
+    if ( sharedPool )
+    {
+      sharedPool->GetEvent(fMixPoolTrackView, eventBin, ev, fMixTrackParticles);
+      bgTracks = fMixTrackParticles;
+      
+      if ( neutralMix && fMixPoolCaloView >= 0 )
+      {
+        if ( nMixEvents != sharedPool->GetNEvents(fMixPoolCaloView, eventBin) )
+          AliWarning("Different size of calo and track pools");
+        
+        if ( ev < sharedPool->GetNEvents(fMixPoolCaloView, eventBin) )
+        {
+          sharedPool->GetEvent(fMixPoolCaloView, eventBin, ev, fMixCaloParticles);
+          bgCalo = fMixCaloParticles;
+        }
+        else AliDebug(1,Form("Event %d in calo pool not available?",ev));
+      }
+    }
+    else
+      bgTracks = static_cast<TObjArray*>(pool->At(ev));
+    
     // Recover the clusters list if requested
-    if ( neutralMix && poolCalo )
+    if ( !sharedPool && neutralMix && poolCalo )
     {
       if ( pool->GetSize()!=poolCalo->GetSize() )
         AliWarning("Different size of calo and track pools");
@@ -23,6 +23,7 @@
 
 #include "AliAnaCaloTrackCorrBaseClass.h"
 class AliCaloTrackParticleCorrelation ;
+class TClonesArray ;
 
 class AliAnaParticleHadronCorrelation : public AliAnaCaloTrackCorrBaseClass {
   
@@ -225,6 +226,10 @@ public:
   void         SwitchOnUseMixStoredInReader()    { fUseMixStoredInReader = kTRUE ; }
   void         SwitchOffUseMixStoredInReader()   { fUseMixStoredInReader = kFALSE; }
   
+  Bool_t       IsSharedMixPoolOn()         const { return fUseSharedMixPool      ; }
+  void         SwitchOnSharedMixPool()           { fUseSharedMixPool = kTRUE     ; }
+  void         SwitchOffSharedMixPool()          { fUseSharedMixPool = kFALSE    ; }
+  
   void         SwitchOnFillNeutralInMixedEvent() { fFillNeutralEventMixPool = kTRUE  ; }
   void         SwitchOffFillNeutralInMixedEvent(){ fFillNeutralEventMixPool = kFALSE ; }
   
@@ -320,6 +325,16 @@ private:
   
   Bool_t       fFillNeutralEventMixPool;                 ///<  Add clusters to pool if requested.
   
+  Bool_t       fUseSharedMixPool;                        ///<  Use the compact mixing pool of the reader, see AliCaloTrackMixingPool, instead of the TList pools.
+  
+  Int_t        fMixPoolTrackView;                        //!<! View of this analysis on the track shared pool.
+  
+  Int_t        fMixPoolCaloView;                         //!<! View of this analysis on the cluster shared pool.
+  
+  TClonesArray * fMixTrackParticles;                     //!<! Tracks of the mixed event recovered from the shared pool, objects reused.
+  
+  TClonesArray * fMixCaloParticles;                      //!<! Clusters of the mixed event recovered from the shared pool, objects reused.
+  
   Float_t      fM02MaxCut   ;                            ///<  Study photon clusters with l0 smaller than cut.
   Float_t      fM02MinCut   ;                            ///<  Study photon clusters with l0 larger than cut.
   
@@ -689,7 +704,7 @@ private:
   AliAnaParticleHadronCorrelation & operator = (const AliAnaParticleHadronCorrelation & ph) ;
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaParticleHadronCorrelation,37) ;
+  ClassDef(AliAnaParticleHadronCorrelation,38) ;
   /// \endcond
   
 } ;
@@ -24,6 +24,7 @@
 #include "AliAODEvent.h"
 #include "AliCaloTrackMatcher.h"
 #include "AliEMCALRecoUtils.h"
+#include "AliEMCALTrackExtrapolationCache.h"
 #include "AliESDEvent.h"
 #include "AliESDtrack.h"
 #include "AliESDtrackCuts.h"
@@ -57,6 +58,7 @@ AliCaloTrackMatcher::AliCaloTrackMatcher(const char *name, Int_t clusterType, In
   fMatchingWindow(200),
   fMatchingResidual(0.2),
   fRunNumber(-1),
+  fUseTrackExtrapolationCache(kFALSE),
   fGeomEMCAL(NULL),
   fGeomPHOS(NULL),
   fMapTrackToCluster(),
@@ -360,7 +362,10 @@ void AliCaloTrackMatcher::ProcessEvent(AliVEvent *event){
 
     //propagate tracks to emc surfaces
     if(fClusterType == 1 || fClusterType == 3 || fClusterType == 4){
-      if (!AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 440., 0.139, 20., eta, phi, pt)) {
+      Bool_t propagated = fUseTrackExtrapolationCache ?
+        AliEMCALTrackExtrapolationCache::Instance()->ExtrapolateTrackToEMCalSurface(inTrack, &emcParam, 440., 0.139, 20., eta, phi, pt) :
+        AliEMCALRecoUtils::ExtrapolateTrackToEMCalSurface(&emcParam, 440., 0.139, 20., eta, phi, pt);
+      if (!propagated) {
         delete trackParam;
         fHistControlMatches->Fill(2.,inTrack->Pt());
         continue;
@@ -31,6 +31,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     void SetAnalysisTrainMode(TString mode){fAnalysisTrainMode = mode; return;}
     void SetMatchingResidual(Float_t res) {fMatchingResidual = res; return;}
     void SetMatchingWindow(Float_t win) {fMatchingWindow = win; return;}
+    void SetUseTrackExtrapolationCache(Bool_t use) {fUseTrackExtrapolationCache = use; return;}
 
     // for cluster <-> primary matching
     Bool_t GetTrackClusterMatchingResidual(Int_t trackID, Int_t clusterID, Float_t &dEta, Float_t &dPhi);
@@ -107,6 +108,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     Double_t              fMatchingWindow;         // matching window to prevent unnecessary propagations
     Float_t               fMatchingResidual;       // matching residual below which track <-> cluster associations should be stored
     Int_t                 fRunNumber;              // current run number
+    Bool_t                fUseTrackExtrapolationCache; // share the propagation to the EMCal surface with other consumers (AliEMCALTrackExtrapolationCache)
 
     AliEMCALGeometry*     fGeomEMCAL;              // pointer to EMCAL geometry
     AliPHOSGeometry*      fGeomPHOS;               // pointer to PHOS geometry
@@ -132,7 +134,7 @@ class AliCaloTrackMatcher : public AliAnalysisTaskSE {
     TH2F*                 fHistControlMatches;     // bookkeeping for processed tracks/clusters and succesful matches
     TH2F*                 fSecHistControlMatches;  // bookkeeping for processed V0-tracks/clusters and succesful matches
 
-    ClassDef(AliCaloTrackMatcher,5)
+    ClassDef(AliCaloTrackMatcher,6)
 };
 
 #endif
@@ -27,6 +27,12 @@ class AliHFDhadronCorrSystUnc : public TNamed{
   AliHFDhadronCorrSystUnc();
   AliHFDhadronCorrSystUnc(const char* name);
   ~AliHFDhadronCorrSystUnc();
+
+  // File with the values of the InitStandardUncertainties* configurations, indexed once and
+  // read per configuration (default: $ALICE_PHYSICS/PWGHF/correlationHF/AliHFDhadronCorrSystUncTables.txt)
+  static void SetTablesFile(const char* fileName);
+  static const char* GetTablesFile();
+
   void InitEmptyHistosFromTemplate();
   void InitStandardUncertaintiesPP2010(Int_t meson,Double_t ptD,Double_t minptAss,Double_t maxptAss);
   void InitStandardUncertaintiesPPb2013(Int_t meson,Double_t ptD,Double_t minptAss,Double_t maxptAss);
@@ -575,6 +581,8 @@ class AliHFDhadronCorrSystUnc : public TNamed{
   TGraphAsymmErrors* GetTotFlatUncGraph(){return fgrTotalFlatDPhi;}
   
  private:
+  void InitFromTable(const char* key);
+
   Int_t fmeson;                       // 0=D0, 1=D*, 2=D+
   TString fstrmeson;                  // meson name
   TString fstrptAss;                  // string with pt range associated tracks
@@ -139,7 +139,11 @@ AliCFTaskVertexingHF::AliCFTaskVertexingHF() :
   fUseCascadeTaskForLctoV0bachelor(kFALSE),
   fFillMinimumSteps(kFALSE),
   fCutOnMomConservation(0.00001),
-  fAODProtection(1)
+  fAODProtection(1),
+  fFillBufferSize(0),
+  fEntryVars(),
+  fEntrySteps(),
+  fEntryWeights()
 {
   //
   //Default ctor
@@ -207,7 +211,11 @@ AliCFTaskVertexingHF::AliCFTaskVertexingHF(const Char_t* name, AliRDHFCuts* cuts
   fUseCascadeTaskForLctoV0bachelor(kFALSE),
   fFillMinimumSteps(kFALSE),
   fCutOnMomConservation(0.00001),
-  fAODProtection(1)
+  fAODProtection(1),
+  fFillBufferSize(0),
+  fEntryVars(),
+  fEntrySteps(),
+  fEntryWeights()
 {
   //
   // Constructor. Initialization of Inputs and Outputs
@@ -307,7 +315,11 @@ AliCFTaskVertexingHF::AliCFTaskVertexingHF(const AliCFTaskVertexingHF& c) :
   fUseCascadeTaskForLctoV0bachelor(c.fUseCascadeTaskForLctoV0bachelor),
   fFillMinimumSteps(c.fFillMinimumSteps),
   fCutOnMomConservation(c.fCutOnMomConservation),
-  fAODProtection(c.fAODProtection)
+  fAODProtection(c.fAODProtection),
+  fFillBufferSize(c.fFillBufferSize),
+  fEntryVars(),
+  fEntrySteps(),
+  fEntryWeights()
 
 {
   //
@@ -945,13 +957,13 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
 
       //MC Limited Acceptance
       if (TMath::Abs(containerInputMC[1]) < 0.5) {
-        fCFManager->GetParticleContainer()->Fill(containerInputMC,kStepGeneratedLimAcc, fWeight);
+        AddContainerEntry(containerInputMC,kStepGeneratedLimAcc,fWeight);
         icountGenLimAcc++;
 	AliDebug(3,"MC Lim Acc container filled\n");
 	if (fCFManager->GetParticleContainer()->GetNStep() == kStepGenLimAccNoAcc+1) {
 	  if (!(cfVtxHF-> MCAcceptanceStep())) {
       if(!fFillMinimumSteps)
-        fCFManager->GetParticleContainer()->Fill(containerInputMC,kStepGenLimAccNoAcc, fWeight);
+        AddContainerEntry(containerInputMC,kStepGenLimAccNoAcc,fWeight);
 	    icountGenLimAccNoAcc++;
 	    AliDebug(3,"MC Lim Acc No Acc container filled\n");
 	  }
@@ -960,7 +972,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
 
       //MC
       if(!fFillMinimumSteps)
-        fCFManager->GetParticleContainer()->Fill(containerInputMC, kStepGenerated, fWeight);
+        AddContainerEntry(containerInputMC,kStepGenerated,fWeight);
       icountMC++;
       AliDebug(3,"MC container filled \n");
 
@@ -969,7 +981,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
       // since standard CF functions are not applicable, using Kine Cuts on daughters
       Bool_t mcAccepStep = cfVtxHF-> MCAcceptanceStep();
       if (mcAccepStep){
-        fCFManager->GetParticleContainer()->Fill(containerInputMC,kStepAcceptance, fWeight);
+        AddContainerEntry(containerInputMC,kStepAcceptance,fWeight);
         AliDebug(3,"MC acceptance cut passed\n");
         icountAcc++;
 
@@ -977,7 +989,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
         if (fCuts->IsEventSelected(aodEvent)){
           // filling the container if the vertex is ok
           if(!fFillMinimumSteps)
-            fCFManager->GetParticleContainer()->Fill(containerInputMC,kStepVertex, fWeight) ;
+            AddContainerEntry(containerInputMC,kStepVertex,fWeight);
           AliDebug(3,"Vertex cut passed and container filled\n");
           icountVertex++;
 
@@ -985,7 +997,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
           Bool_t mcRefitStep = cfVtxHF->MCRefitStep(aodEvent, &trackCuts[0]);
           if (mcRefitStep){
             if(!fFillMinimumSteps)
-              fCFManager->GetParticleContainer()->Fill(containerInputMC,kStepRefit, fWeight);
+              AddContainerEntry(containerInputMC,kStepRefit,fWeight);
             AliDebug(3,"MC Refit cut passed and container filled\n");
             icountRefit++;
           }
@@ -1156,7 +1168,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
 
       if (recoStep && recoContFilled && vtxCheck){
         if(!fFillMinimumSteps)
-          fCFManager->GetParticleContainer()->Fill(containerInput,kStepReconstructed, fWeight) ;
+          AddContainerEntry(containerInput,kStepReconstructed,fWeight);
         icountReco++;
         AliDebug(3,"Reco step  passed and container filled\n");
 
@@ -1164,7 +1176,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
         Bool_t recoAcceptanceStep = cfVtxHF->RecoAcceptStep(&trackCuts[0]);
         if (recoAcceptanceStep) {
           if(!fFillMinimumSteps)
-            fCFManager->GetParticleContainer()->Fill(containerInput,kStepRecoAcceptance, fWeight) ;
+            AddContainerEntry(containerInput,kStepRecoAcceptance,fWeight);
           icountRecoAcc++;
           AliDebug(3,"Reco acceptance cut passed and container filled\n");
 
@@ -1178,7 +1190,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
           Int_t recoITSnCluster = fCuts->IsSelected(charmCandidate, AliRDHFCuts::kTracks, aodEvent);
           if (recoITSnCluster){
             if(!fFillMinimumSteps)
-              fCFManager->GetParticleContainer()->Fill(containerInput,kStepRecoITSClusters, fWeight) ;
+              AddContainerEntry(containerInput,kStepRecoITSClusters,fWeight);
             icountRecoITSClusters++;
             AliDebug(3,"Reco n ITS cluster cut passed and container filled\n");
 
@@ -1208,7 +1220,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
             if (fDecayChannel == 32) tempAn=(recoAnalysisCuts >0 || recoAnalysisCuts == isPartOrAntipart);
 
             if (tempAn){
-              fCFManager->GetParticleContainer()->Fill(containerInput, kStepRecoPPR, fWeight);
+              AddContainerEntry(containerInput,kStepRecoPPR,fWeight);
               icountRecoPPR++;
               AliDebug(3,"Reco Analysis cuts passed and container filled \n");
               //pid selection
@@ -1256,7 +1268,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
                     }
                   }
                 }
-                fCFManager->GetParticleContainer()->Fill(containerInput, kStepRecoPID, fWeight*weigPID);
+                AddContainerEntry(containerInput,kStepRecoPID,fWeight*weigPID);
                 icountRecoPID++;
                 AliDebug(3,"Reco PID cuts passed and container filled \n");
                 if(!fAcceptanceUnf){
@@ -1299,6 +1311,7 @@ void AliCFTaskVertexingHF::UserExec(Option_t *)
     if(unsetvtx) charmCandidate->UnsetOwnPrimaryVtx();
   } // end loop on candidate
   delete vHF;
+  FillContainerEntries();
   fCountReco+= icountReco;
   fCountRecoAcc+= icountRecoAcc;
   fCountRecoITSClusters+= icountRecoITSClusters;
@@ -1648,12 +1661,39 @@ void AliCFTaskVertexingHF::UserCreateOutputObjects()
   fHistEventsProcessed->GetXaxis()->SetBinLabel(7,"AOD/dAOD mismatch");
   fHistEventsProcessed->GetXaxis()->SetBinLabel(8,"AOD/dAOD #events ok");
 
+  if(fFillBufferSize>0) fCFManager->GetParticleContainer()->SetFillBuffer(fFillBufferSize);
+
   PostData(1,fHistEventsProcessed) ;
   PostData(2,fCFManager->GetParticleContainer()) ;
   PostData(3,fCorrelation) ;
 
 }
 
+//_________________________________________________________________________
+void AliCFTaskVertexingHF::AddContainerEntry(const Double_t* var, Int_t step, Double_t weight)
+{
+  //
+  // collect an entry of the container, the entries of the event are filled at once
+  // by FillContainerEntries()
+  //
+  Int_t nVar=fCFManager->GetParticleContainer()->GetNVar();
+  fEntryVars.insert(fEntryVars.end(),var,var+nVar);
+  fEntrySteps.push_back(step);
+  fEntryWeights.push_back(weight);
+}
+
+//_________________________________________________________________________
+void AliCFTaskVertexingHF::FillContainerEntries()
+{
+  //
+  // fill the container with the entries collected in the event
+  //
+  if(!fEntrySteps.empty()) fCFManager->GetParticleContainer()->Fill((Int_t)fEntrySteps.size(),&fEntryVars[0],&fEntrySteps[0],&fEntryWeights[0]);
+  fEntryVars.clear();
+  fEntrySteps.clear();
+  fEntryWeights.clear();
+}
+
 
 //_________________________________________________________________________
 void AliCFTaskVertexingHF::SetPtWeightsFromFONLL276overLHC12a17a(){
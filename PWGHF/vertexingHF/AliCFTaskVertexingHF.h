@@ -32,6 +32,7 @@
 #include "AliCFVertexingHF.h"
 #include <TH1F.h>
 #include <TProfile.h>
+#include <vector>
 
 class TH1I;
 class TFile ;
@@ -280,7 +281,14 @@ class AliCFTaskVertexingHF: public AliAnalysisTaskSE {
  
   void SetAODMismatchProtection(Int_t opt=1) {fAODProtection=opt;}
 
+  /// buffer the fills of the container in a hash table of at most maxBins bins (0: no buffer), see AliCFGridSparse::SetFillBuffer()
+  void SetContainerFillBuffer(Int_t maxBins=100000) {fFillBufferSize=maxBins;}
+  Int_t GetContainerFillBuffer() const {return fFillBufferSize;}
+
  protected:
+  void AddContainerEntry(const Double_t* var, Int_t step, Double_t weight);
+  void FillContainerEntries();
+
   AliCFManager   *fCFManager;   ///  pointer to the CF manager
   TH1I *fHistEventsProcessed;   //!<! simple histo for monitoring the number of events processed
   THnSparse* fCorrelation;      ///  response matrix for unfolding
@@ -344,9 +352,13 @@ class AliCFTaskVertexingHF: public AliAnalysisTaskSE {
   Float_t fCutOnMomConservation; /// cut on momentum conservation
   Int_t fAODProtection;         /// flag to activate protection against AOD-dAOD mismatch.
                                 /// -1: no protection,  0: check AOD/dAOD nEvents only,  1: check AOD/dAOD nEvents + TProcessID names
+  Int_t fFillBufferSize;        /// size of the fill buffer of the container (0: fills are not buffered)
+  std::vector<Double_t> fEntryVars;    //!<! variables of the container entries of the event
+  std::vector<Int_t> fEntrySteps;      //!<! steps of the container entries of the event
+  std::vector<Double_t> fEntryWeights; //!<! weights of the container entries of the event
 
   /// \cond CLASSIMP     
-  ClassDef(AliCFTaskVertexingHF,27); /// class for HF corrections as a function of many variables
+  ClassDef(AliCFTaskVertexingHF,28); /// class for HF corrections as a function of many variables
   /// \endcond
 };
 
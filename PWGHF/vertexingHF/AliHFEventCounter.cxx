@@ -0,0 +1,371 @@
+/**************************************************************************
+ * Copyright(c) 2008-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//*************************************************************************
+// Class AliHFEventCounter
+// Event counter with integer-resolved rubrics and keys,
+// exportable to AliCounterCollection
+/////////////////////////////////////////////////////////////
+
+#include <TCollection.h>
+#include <TObjArray.h>
+#include <TObjString.h>
+#include <TMath.h>
+#include "AliLog.h"
+#include "AliCounterCollection.h"
+#include "AliHFEventCounter.h"
+
+/// \cond CLASSIMP
+ClassImp(AliHFEventCounter);
+/// \endcond
+
+//____________________________________________
+AliHFEventCounter::AliHFEventCounter():
+  TNamed(),
+  fRubricNames(),
+  fMaxNKeys(),
+  fIntKeyRubric(),
+  fKeyLabels(),
+  fIntKeys(),
+  fCounts(),
+  fInitialized(kFALSE),
+  fIntKeyIndex(),
+  fLastIntKey(),
+  fLastIntKeyIndex()
+{
+  /// default constructor
+}
+
+//____________________________________________
+AliHFEventCounter::AliHFEventCounter(const char *name):
+  TNamed(name,name),
+  fRubricNames(),
+  fMaxNKeys(),
+  fIntKeyRubric(),
+  fKeyLabels(),
+  fIntKeys(),
+  fCounts(),
+  fInitialized(kFALSE),
+  fIntKeyIndex(),
+  fLastIntKey(),
+  fLastIntKeyIndex()
+{
+  /// standard constructor
+}
+
+//____________________________________________
+Int_t AliHFEventCounter::AddRubric(TString name, TString listOfKeys){
+  /// add a rubric with a fixed list of keys separated by "/"
+  /// returns the index of the rubric (-1 in case of error)
+
+  if(fInitialized){
+    AliError("Rubrics cannot be added after Init()");
+    return -1;
+  }
+  if(GetRubricIndex(name)>=0){
+    AliError(Form("Rubric %s already exists",name.Data()));
+    return -1;
+  }
+  TObjArray* keys=listOfKeys.Tokenize("/");
+  std::vector<TString> labels;
+  for(Int_t i=0; i<keys->GetEntriesFast(); i++){
+    TString key=((TObjString*)keys->At(i))->String();
+    if(key.IsNull()) continue;
+    labels.push_back(key);
+  }
+  delete keys;
+  if(labels.empty()){
+    AliError(Form("Rubric %s has no keys",name.Data()));
+    return -1;
+  }
+  fRubricNames.push_back(name);
+  fMaxNKeys.push_back((Int_t)labels.size());
+  fIntKeyRubric.push_back(0);
+  fKeyLabels.push_back(labels);
+  fIntKeys.push_back(std::vector<Int_t>());
+  return (Int_t)fRubricNames.size()-1;
+}
+
+//____________________________________________
+Int_t AliHFEventCounter::AddRubric(TString name, Int_t maxNKeys){
+  /// add a rubric with integer keys (e.g. run number, multiplicity)
+  /// that are registered on the fly, up to maxNKeys different values
+  /// returns the index of the rubric (-1 in case of error)
+
+  if(fInitialized){
+    AliError("Rubrics cannot be added after Init()");
+    return -1;
+  }
+  if(GetRubricIndex(name)>=0){
+    AliError(Form("Rubric %s already exists",name.Data()));
+    return -1;
+  }
+  if(maxNKeys<=0){
+    AliError(Form("Rubric %s: invalid number of keys %d",name.Data(),maxNKeys));
+    return -1;
+  }
+  fRubricNames.push_back(name);
+  fMaxNKeys.push_back(maxNKeys);
+  fIntKeyRubric.push_back(1);
+  fKeyLabels.push_back(std::vector<TString>());
+  fIntKeys.push_back(std::vector<Int_t>());
+  return (Int_t)fRubricNames.size()-1;
+}
+
+//____________________________________________
+void AliHFEventCounter::Init(){
+  /// freeze the rubrics and prepare the lookup tables
+
+  Double_t nCells=1.;
+  for(UInt_t ir=0; ir<fMaxNKeys.size(); ir++) nCells*=fMaxNKeys[ir];
+  if(nCells>=(Double_t)TMath::Limits<Long64_t>::Max()){
+    AliFatal("Too many cells for the declared rubrics");
+  }
+  fInitialized=kTRUE;
+  BuildLookup();
+}
+
+//____________________________________________
+void AliHFEventCounter::BuildLookup(){
+  /// (re)build the transient maps for integer keys,
+  /// needed also after reading the object from file
+
+  Int_t nRubrics=GetNRubrics();
+  fIntKeyIndex.assign(nRubrics,std::map<Int_t,Int_t>());
+  fLastIntKey.assign(nRubrics,0);
+  fLastIntKeyIndex.assign(nRubrics,-1);
+  for(Int_t ir=0; ir<nRubrics; ir++){
+    for(UInt_t ik=0; ik<fIntKeys[ir].size(); ik++) fIntKeyIndex[ir][fIntKeys[ir][ik]]=(Int_t)ik;
+  }
+}
+
+//____________________________________________
+Int_t AliHFEventCounter::GetRubricIndex(TString name) const {
+  /// index of the rubric with the given name (case insensitive), -1 if not found
+
+  for(UInt_t ir=0; ir<fRubricNames.size(); ir++){
+    if(fRubricNames[ir].EqualTo(name,TString::kIgnoreCase)) return (Int_t)ir;
+  }
+  return -1;
+}
+
+//____________________________________________
+Int_t AliHFEventCounter::GetKeyIndex(Int_t rubric, TString key) const {
+  /// index of a string key in a rubric (case insensitive), -1 if not found
+  /// to be called before the event loop
+
+  if(rubric<0 || rubric>=GetNRubrics()) return -1;
+  if(fIntKeyRubric[rubric]){
+    AliError(Form("Rubric %s has integer keys",fRubricNames[rubric].Data()));
+    return -1;
+  }
+  const std::vector<TString>& labels=fKeyLabels[rubric];
+  for(UInt_t ik=0; ik<labels.size(); ik++){
+    if(labels[ik].EqualTo(key,TString::kIgnoreCase)) return (Int_t)ik;
+  }
+  AliError(Form("Key %s not found in rubric %s",key.Data(),fRubricNames[rubric].Data()));
+  return -1;
+}
+
+//____________________________________________
+Int_t AliHFEventCounter::GetKeyIndex(Int_t rubric, Int_t key){
+  /// index of an integer key in a rubric, the key is registered if new
+  /// returns -1 if the maximum number of keys is exceeded
+
+  if(rubric<0 || rubric>=GetNRubrics()) return -1;
+  if(!fIntKeyRubric[rubric]){
+    AliError(Form("Rubric %s has string keys",fRubricNames[rubric].Data()));
+    return -1;
+  }
+  if((Int_t)fIntKeyIndex.size()!=GetNRubrics()) BuildLookup();
+  if(fLastIntKeyIndex[rubric]>=0 && fLastIntKey[rubric]==key) return fLastIntKeyIndex[rubric];
+
+  Int_t index=-1;
+  std::map<Int_t,Int_t>::const_iterator it=fIntKeyIndex[rubric].find(key);
+  if(it!=fIntKeyIndex[rubric].end()){
+    index=it->second;
+  }else{
+    if((Int_t)fIntKeys[rubric].size()>=fMaxNKeys[rubric]){
+      AliError(Form("Rubric %s: max. number of keys (%d) reached, key %d not counted",fRubricNames[rubric].Data(),fMaxNKeys[rubric],key));
+      return -1;
+    }
+    index=(Int_t)fIntKeys[rubric].size();
+    fIntKeys[rubric].push_back(key);
+    fKeyLabels[rubric].push_back(TString::Format("%d",key));
+    fIntKeyIndex[rubric][key]=index;
+  }
+  fLastIntKey[rubric]=key;
+  fLastIntKeyIndex[rubric]=index;
+  return index;
+}
+
+//____________________________________________
+Long64_t AliHFEventCounter::GetCell(const Int_t* keyIndices) const {
+  /// linear index of the cell, -1 if any key index is invalid
+
+  Long64_t cell=0;
+  for(UInt_t ir=0; ir<fMaxNKeys.size(); ir++){
+    Int_t ik=keyIndices[ir];
+    if(ik<0 || ik>=fMaxNKeys[ir]) return -1;
+    cell=cell*fMaxNKeys[ir]+ik;
+  }
+  return cell;
+}
+
+//____________________________________________
+void AliHFEventCounter::DecodeCell(Long64_t cell, Int_t* keyIndices) const {
+  /// key indices from the linear index of the cell
+
+  for(Int_t ir=GetNRubrics()-1; ir>=0; ir--){
+    keyIndices[ir]=(Int_t)(cell%fMaxNKeys[ir]);
+    cell/=fMaxNKeys[ir];
+  }
+}
+
+//____________________________________________
+TString AliHFEventCounter::GetCellKey(Long64_t cell) const {
+  /// external key "rubric:key/rubric:key/..." in AliCounterCollection format
+
+  std::vector<Int_t> indices(GetNRubrics());
+  DecodeCell(cell,indices.data());
+  TString key="";
+  for(Int_t ir=0; ir<GetNRubrics(); ir++){
+    if(ir>0) key.Append("/");
+    key.Append(Form("%s:%s",fRubricNames[ir].Data(),fKeyLabels[ir][indices[ir]].Data()));
+  }
+  return key;
+}
+
+//____________________________________________
+Double_t AliHFEventCounter::GetCount(const Int_t* keyIndices) const {
+  /// content of one cell
+
+  Long64_t cell=GetCell(keyIndices);
+  if(cell<0) return 0.;
+  std::map<Long64_t,Double_t>::const_iterator it=fCounts.find(cell);
+  return (it!=fCounts.end()) ? it->second : 0.;
+}
+
+//____________________________________________
+Double_t AliHFEventCounter::GetSum() const {
+  /// sum over all cells
+
+  Double_t sum=0.;
+  for(std::map<Long64_t,Double_t>::const_iterator it=fCounts.begin(); it!=fCounts.end(); ++it) sum+=it->second;
+  return sum;
+}
+
+//____________________________________________
+Bool_t AliHFEventCounter::ExportTo(AliCounterCollection& counters) const {
+  /// add the content to an AliCounterCollection with the same rubrics
+  /// (one Count per non-empty cell, not per event)
+
+  if(!fInitialized){
+    AliError(Form("Counter %s not initialized",GetName()));
+    return kFALSE;
+  }
+  for(std::map<Long64_t,Double_t>::const_iterator it=fCounts.begin(); it!=fCounts.end(); ++it){
+    counters.Count(GetCellKey(it->first),(Int_t)TMath::Nint(it->second));
+  }
+  return kTRUE;
+}
+
+//____________________________________________
+AliCounterCollection* AliHFEventCounter::CreateCounterCollection(const char* name) const {
+  /// create a new AliCounterCollection with the same rubrics and content
+  /// the caller takes ownership
+
+  AliCounterCollection* counters=new AliCounterCollection(name ? name : GetName());
+  for(Int_t ir=0; ir<GetNRubrics(); ir++){
+    if(fIntKeyRubric[ir]){
+      counters->AddRubric(fRubricNames[ir],fMaxNKeys[ir]);
+    }else{
+      TString keys="";
+      for(UInt_t ik=0; ik<fKeyLabels[ir].size(); ik++){
+        if(ik>0) keys.Append("/");
+        keys.Append(fKeyLabels[ir][ik]);
+      }
+      counters->AddRubric(fRubricNames[ir],keys);
+    }
+  }
+  counters->Init();
+  ExportTo(*counters);
+  return counters;
+}
+
+//____________________________________________
+void AliHFEventCounter::Add(const AliHFEventCounter* other){
+  /// add the content of another counter with the same rubrics
+  /// integer keys can be registered in a different order in the two objects
+
+  if(!other || other->IsEmpty()) return;
+  Int_t nRubrics=GetNRubrics();
+  if(other->GetNRubrics()!=nRubrics){
+    AliError(Form("Counter %s has different rubrics, not added",other->GetName()));
+    return;
+  }
+  for(Int_t ir=0; ir<nRubrics; ir++){
+    if(!fRubricNames[ir].EqualTo(other->fRubricNames[ir],TString::kIgnoreCase) ||
+       fIntKeyRubric[ir]!=other->fIntKeyRubric[ir]){
+      AliError(Form("Counter %s has different rubrics, not added",other->GetName()));
+      return;
+    }
+  }
+
+  // translate the key indices of the other counter
+  std::vector<std::vector<Int_t> > translation(nRubrics);
+  for(Int_t ir=0; ir<nRubrics; ir++){
+    UInt_t nKeys=other->fKeyLabels[ir].size();
+    translation[ir].resize(nKeys);
+    for(UInt_t ik=0; ik<nKeys; ik++){
+      if(fIntKeyRubric[ir]) translation[ir][ik]=GetKeyIndex(ir,other->fIntKeys[ir][ik]);
+      else translation[ir][ik]=GetKeyIndex(ir,other->fKeyLabels[ir][ik]);
+    }
+  }
+
+  std::vector<Int_t> indices(nRubrics);
+  for(std::map<Long64_t,Double_t>::const_iterator it=other->fCounts.begin(); it!=other->fCounts.end(); ++it){
+    other->DecodeCell(it->first,indices.data());
+    for(Int_t ir=0; ir<nRubrics; ir++) indices[ir]=translation[ir][indices[ir]];
+    Count(indices.data(),it->second);
+  }
+}
+
+//____________________________________________
+Long64_t AliHFEventCounter::Merge(TCollection* list){
+  /// merge a list of AliHFEventCounter
+
+  if(!list) return 0;
+  if(list->IsEmpty()) return (Long64_t)fCounts.size();
+
+  TIter next(list);
+  const TObject* obj=0x0;
+  while((obj=next())){
+    const AliHFEventCounter* counter=dynamic_cast<const AliHFEventCounter*>(obj);
+    if(!counter){
+      AliError(Form("object named %s is not AliHFEventCounter! Skipping it.",obj->GetName()));
+      continue;
+    }
+    Add(counter);
+  }
+  return (Long64_t)fCounts.size();
+}
+
+//____________________________________________
+void AliHFEventCounter::Reset(Option_t* /*opt*/){
+  /// reset the counts, keeping rubrics and registered keys
+
+  fCounts.clear();
+}
@@ -0,0 +1,87 @@
+#ifndef ALIHFEVENTCOUNTER_H
+#define ALIHFEVENTCOUNTER_H
+/* Copyright(c) 2008-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//*************************************************************************
+/// \class Class AliHFEventCounter
+/// \brief Event counter with rubrics and keys resolved to integer
+/// coordinates before the event loop.
+///
+/// Rubrics are declared once (either with a list of string keys or
+/// with a maximum number of integer keys, as in AliCounterCollection).
+/// In the event loop the user only passes the key indices, so no string
+/// is formatted or parsed per event. The content can be exported to an
+/// AliCounterCollection (ExportTo/CreateCounterCollection) so that the
+/// existing normalization macros keep working.
+//*************************************************************************
+
+#include <TNamed.h>
+#include <TString.h>
+#include <map>
+#include <vector>
+
+class TCollection;
+class AliCounterCollection;
+
+class AliHFEventCounter : public TNamed
+{
+ public:
+
+  AliHFEventCounter();
+  AliHFEventCounter(const char *name);
+  virtual ~AliHFEventCounter(){}
+
+  Int_t AddRubric(TString name, TString listOfKeys);
+  Int_t AddRubric(TString name, Int_t maxNKeys);
+  void Init();
+
+  Int_t GetNRubrics() const {return (Int_t)fRubricNames.size();}
+  Int_t GetRubricIndex(TString name) const;
+  Int_t GetKeyIndex(Int_t rubric, TString key) const;
+  Int_t GetKeyIndex(Int_t rubric, Int_t key);
+
+  /// count value in the cell with the given key index for each rubric
+  /// (array of size GetNRubrics(), entries from GetKeyIndex)
+  void Count(const Int_t* keyIndices, Double_t value=1.){
+    Long64_t cell=GetCell(keyIndices);
+    if(cell>=0) fCounts[cell]+=value;
+  }
+  Double_t GetCount(const Int_t* keyIndices) const;
+  Double_t GetSum() const;
+  Bool_t IsEmpty() const {return fCounts.empty();}
+
+  Bool_t ExportTo(AliCounterCollection& counters) const;
+  AliCounterCollection* CreateCounterCollection(const char* name=0x0) const;
+
+  void Add(const AliHFEventCounter* other);
+  Long64_t Merge(TCollection* list);
+  void Reset(Option_t* opt="");
+
+ private:
+
+  AliHFEventCounter(const AliHFEventCounter &source);
+  AliHFEventCounter& operator=(const AliHFEventCounter& source);
+
+  Long64_t GetCell(const Int_t* keyIndices) const;
+  void DecodeCell(Long64_t cell, Int_t* keyIndices) const;
+  void BuildLookup();
+  TString GetCellKey(Long64_t cell) const;
+
+  std::vector<TString> fRubricNames;                /// names of the rubrics
+  std::vector<Int_t> fMaxNKeys;                     /// max. number of keys per rubric
+  std::vector<Int_t> fIntKeyRubric;                 /// 1 for rubrics with integer keys
+  std::vector<std::vector<TString> > fKeyLabels;    /// key names per rubric (in index order)
+  std::vector<std::vector<Int_t> > fIntKeys;        /// integer key values per rubric (in index order)
+  std::map<Long64_t,Double_t> fCounts;              /// non-empty cells (linear index -> counts)
+  Bool_t fInitialized;                              /// flag for rubrics frozen
+
+  std::vector<std::map<Int_t,Int_t> > fIntKeyIndex; //! integer key value -> key index
+  std::vector<Int_t> fLastIntKey;                   //! last integer key looked up per rubric
+  std::vector<Int_t> fLastIntKeyIndex;              //! index of last integer key per rubric
+
+  /// \cond CLASSIMP
+  ClassDef(AliHFEventCounter,1);
+  /// \endcond
+};
+#endif
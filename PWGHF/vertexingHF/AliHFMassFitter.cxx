@@ -38,6 +38,10 @@
 #include <TStyle.h>
 #include <TPaveText.h>
 #include <TDatabasePDG.h>
+#include <Foption.h>
+#include <HFitInterface.h>
+#include <Fit/DataRange.h>
+#include <Math/MinimizerOptions.h>
 
 #include "AliHFMassFitter.h"
 #include "AliVertexingHFUtils.h"
@@ -80,7 +84,8 @@ AliHFMassFitter::AliHFMassFitter() :
   fcounter(0),
   fNpfits(0),
   fFitOption("L,E"),
-  fContourGraph(0)
+  fContourGraph(0),
+  fMinimizer()
 {
   // default constructor
 
@@ -120,7 +125,8 @@ AliHFMassFitter::AliHFMassFitter (const TH1F *histoToFit, Double_t minvalue, Dou
  fcounter(0),
  fNpfits(0),
  fFitOption("L,E"),
- fContourGraph(0)
+ fContourGraph(0),
+ fMinimizer()
 {
   // standard constructor
 
@@ -178,7 +184,8 @@ AliHFMassFitter::AliHFMassFitter(const AliHFMassFitter &mfit):
   fcounter(mfit.fcounter),
   fNpfits(mfit.fNpfits),
   fFitOption(mfit.fFitOption),
-  fContourGraph(mfit.fContourGraph)
+  fContourGraph(mfit.fContourGraph),
+  fMinimizer(mfit.fMinimizer)
 {
   //copy constructor
 
@@ -239,6 +246,7 @@ AliHFMassFitter& AliHFMassFitter::operator=(const AliHFMassFitter &mfit){
   fcounter= mfit.fcounter;
   fNpfits = mfit.fNpfits;
   fContourGraph= mfit.fContourGraph;
+  fMinimizer= mfit.fMinimizer;
 
   if(mfit.fParsSize > 0){
     delete[] fFitPars;
@@ -946,8 +954,9 @@ Bool_t AliHFMassFitter::CheckRangeFit(){
 Bool_t AliHFMassFitter::MassFitter(Bool_t draw){  
   // Main method of the class: performs the fit of the histogram
 
-  //Set default fitter Minuit in order to use gMinuit in the contour plots    
-  TVirtualFitter::SetDefaultFitter("Minuit");
+  //Set default fitter Minuit in order to use gMinuit in the contour plots,
+  //unless a minimizer is passed to each fit (SetMinimizer)
+  MinuitDefaultScope minuitDefault(fMinimizer.IsNull());
 
 
   Bool_t isBkgOnly=kFALSE;
@@ -1072,7 +1081,7 @@ Bool_t AliHFMassFitter::MassFitter(Bool_t draw){
   //if only signal and reflection: skip
   if (!(ftypeOfFit4Bkg==3 && ftypeOfFit4Sgn==1)) {
     ftypeOfFit4Sgn=0;
-    fhistoInvMass->Fit(bkgname.Data(),Form("R,%s,0",fFitOption.Data()));
+    FitHisto(fhistoInvMass,funcbkg,Form("R,%s,0",fFitOption.Data()));
 
     for(Int_t i=0;i<bkgPar;i++){
       fFitPars[i]=funcbkg->GetParameter(i);
@@ -1155,7 +1164,7 @@ Bool_t AliHFMassFitter::MassFitter(Bool_t draw){
     //cout<<"Parameters set to: "<<0.5*(totInt-intbkg1)<<"\t"<<fMass<<"\t"<<ffactor*fSigmaSgn<<"\t"<<intbkg1<<"\t"<<slope1<<"\t"<<conc1<<"\t"<<endl;
     //cout<<"Limits: ("<<fminMass<<","<<fmaxMass<<")\tnPar = "<<bkgPar<<"\tgsidebands = "<<fSideBands<<endl;
 
-    Int_t status=fhistoInvMass->Fit(bkg1name.Data(),Form("R,%s,+,0",fFitOption.Data()));
+    Int_t status=FitHisto(fhistoInvMass,funcbkg1,Form("R,%s,+,0",fFitOption.Data()));
     if (status != 0){
       cout<<"Minuit returned "<<status<<endl;
       return kFALSE;
@@ -1270,7 +1279,7 @@ Bool_t AliHFMassFitter::MassFitter(Bool_t draw){
 
   Int_t status;
 
-  status = fhistoInvMass->Fit(massname.Data(),Form("R,%s,+,0",fFitOption.Data()));
+  status = FitHisto(fhistoInvMass,funcmass,Form("R,%s,+,0",fFitOption.Data()));
   if (status != 0){
     cout<<"Minuit returned "<<status<<endl;
     return kFALSE;
@@ -1306,7 +1315,7 @@ Bool_t AliHFMassFitter::MassFitter(Bool_t draw){
   fcounter++;
 
   //contour plots
-  if(draw){
+  if(draw && fMinimizer.IsNull()){
 
     for (Int_t kpar=1; kpar<fNFinalPars;kpar++){
 
@@ -1424,7 +1433,7 @@ Bool_t AliHFMassFitter::RefitWithBkgOnly(Bool_t draw){
   }
 
 
-  Int_t status=fhistoInvMass->Fit(bkgname.Data(),Form("R,%s,+,0",fFitOption.Data()));
+  Int_t status=FitHisto(fhistoInvMass,funcbkg,Form("R,%s,+,0",fFitOption.Data()));
   if (status != 0){
     cout<<"Minuit returned "<<status<<endl;
     return kFALSE;
@@ -1552,6 +1561,43 @@ void AliHFMassFitter::IntS(Float_t *valuewitherror) const {
 }
 
 
+//_________________________________________________________________________
+Int_t AliHFMassFitter::FitHisto(TH1* h,TF1* f,Option_t* option,Option_t* goption) const{
+  //
+  /// Fit as TH1::Fit, with the minimizer set by SetMinimizer, if any, passed to
+  /// this fit only, so that the default minimizer of ROOT is not changed
+  //
+  if(fMinimizer.IsNull()) return h->Fit(f,option,goption);
+  Foption_t fitOption;
+  ROOT::Fit::FitOptionsMake(ROOT::Fit::EFitObjectType::kHistogram,option,fitOption);
+  ROOT::Fit::DataRange range;
+  ROOT::Math::MinimizerOptions minOption;
+  minOption.SetMinimizerType(fMinimizer.Data());
+  return ROOT::Fit::FitObject(h,f,fitOption,minOption,goption,range);
+}
+
+//_________________________________________________________________________
+AliHFMassFitter::MinuitDefaultScope::MinuitDefaultScope(Bool_t active):
+  fActive(active),
+  fType(ROOT::Math::MinimizerOptions::DefaultMinimizerType().c_str()),
+  fAlgo(ROOT::Math::MinimizerOptions::DefaultMinimizerAlgo().c_str())
+{
+  //
+  /// Set Minuit as default fitter if active
+  //
+  if(fActive) TVirtualFitter::SetDefaultFitter("Minuit");
+}
+
+//_________________________________________________________________________
+AliHFMassFitter::MinuitDefaultScope::~MinuitDefaultScope(){
+  //
+  /// Restore the default minimizer of the caller
+  //
+  if(!fActive) return;
+  TVirtualFitter::SetDefaultFitter(fType.Data());
+  ROOT::Math::MinimizerOptions::SetDefaultMinimizer(fType.Data(),fAlgo.Data());
+}
+
 //_________________________________________________________________________
 void AliHFMassFitter::AddFunctionsToHisto(){
 
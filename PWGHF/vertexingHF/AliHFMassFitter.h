@@ -21,6 +21,7 @@ class TF1;
 class TNtuple;
 class TFile;
 class TList;
+class TH1;
 class TH1F;
 class TVirtualPad;
 class TPaveText;
@@ -128,6 +129,10 @@ class AliHFMassFitter : public TNamed {
   void SetUseLikelihoodWithWeightsFit(){fFitOption="WL,E";}
   void SetUseChi2Fit(){fFitOption="E";}
   void SetFitOption(TString opt){fFitOption=opt.Data();};
+  /// Minimizer type (e.g. "Minuit2") passed to each fit, instead of setting
+  /// Minuit as default fitter during MassFitter; needed to run fitters on
+  /// several threads, no contour plots are produced
+  void SetMinimizer(const char* type){fMinimizer=type;}
 
 
  protected:
@@ -139,6 +144,21 @@ class AliHFMassFitter : public TNamed {
   Bool_t   SideBandsBounds();
   virtual  Bool_t   CheckRangeFit();
   virtual  void     AddFunctionsToHisto();
+  Int_t    FitHisto(TH1* h,TF1* f,Option_t* option,Option_t* goption="") const;
+
+  /// Minuit as default fitter while MassFitter runs, in order to use gMinuit
+  /// in the contour plots; the default minimizer of the caller is restored
+  class MinuitDefaultScope {
+   public:
+    MinuitDefaultScope(Bool_t active);
+    ~MinuitDefaultScope();
+   private:
+    MinuitDefaultScope(const MinuitDefaultScope&);
+    MinuitDefaultScope& operator=(const MinuitDefaultScope&);
+    Bool_t  fActive;           /// default fitter changed
+    TString fType;             /// default minimizer type of the caller
+    TString fAlgo;             /// default minimizer algorithm of the caller
+  };
   
   TH1F*     fhistoInvMass;     /// histogram to fit
   Double_t  fminMass;          /// lower mass limit
@@ -168,9 +188,10 @@ class AliHFMassFitter : public TNamed {
   Int_t     fNpfits;           /// Number of points used in the fit
   TString   fFitOption;        /// L, LW or Chi2
   TList*    fContourGraph;     /// TList of TGraph containing contour plots
+  TString   fMinimizer;        /// minimizer type of each fit, empty: Minuit as default fitter
 
   /// \cond CLASSIMP     
-  ClassDef(AliHFMassFitter,9); /// class for invariant mass fit
+  ClassDef(AliHFMassFitter,10); /// class for invariant mass fit
   /// \endcond
 };
 
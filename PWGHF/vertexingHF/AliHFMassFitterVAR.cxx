@@ -352,7 +352,7 @@ TH1F*  AliHFMassFitterVAR::SetTemplateReflections(const TH1F *h, TString opt,Dou
     f->SetParameter(1,1.865);
     f->SetParameter(2,0.050);
 
-    fhTemplRefl->Fit(f,"REM","");//,h->GetBinLowEdge(1),h->GetXaxis()->GetBinUpEdge(h->GetNbinsX()));
+    FitHisto(fhTemplRefl,f,"REM","");//,h->GetBinLowEdge(1),h->GetXaxis()->GetBinUpEdge(h->GetNbinsX()));
     for(Int_t j=1;j<=fhTemplRefl->GetNbinsX();j++){
       fhTemplRefl->SetBinContent(j,f->Integral(fhTemplRefl->GetBinLowEdge(j),fhTemplRefl->GetXaxis()->GetBinUpEdge(j))/fhTemplRefl->GetBinWidth(j));
       if(fhTemplRefl->GetBinContent(j)>=0.&&TMath::Abs(h->GetBinError(j)*h->GetBinError(j)-h->GetBinContent(j))>0.1*h->GetBinContent(j))isPoissErr=kFALSE;
@@ -384,7 +384,7 @@ TH1F*  AliHFMassFitterVAR::SetTemplateReflections(const TH1F *h, TString opt,Dou
     f->SetParameter(4,1.88);
     f->SetParameter(5,0.050);
 
-    fhTemplRefl->Fit(f,"REM","");//,h->GetBinLowEdge(1),h->GetXaxis()->GetBinUpEdge(h->GetNbinsX()));
+    FitHisto(fhTemplRefl,f,"REM","");//,h->GetBinLowEdge(1),h->GetXaxis()->GetBinUpEdge(h->GetNbinsX()));
     for(Int_t j=1;j<=fhTemplRefl->GetNbinsX();j++){
       fhTemplRefl->SetBinContent(j,f->Integral(fhTemplRefl->GetBinLowEdge(j),fhTemplRefl->GetXaxis()->GetBinUpEdge(j))/fhTemplRefl->GetBinWidth(j));
       if(fhTemplRefl->GetBinContent(j)>=0.&&TMath::Abs(h->GetBinError(j)*h->GetBinError(j)-h->GetBinContent(j))>0.1*h->GetBinContent(j))isPoissErr=kFALSE;
@@ -409,7 +409,7 @@ TH1F*  AliHFMassFitterVAR::SetTemplateReflections(const TH1F *h, TString opt,Dou
     //    f->SetParLimits(0,0,100.*h->Integral());
     // Hard to initialize the other parameters...
     for(Int_t nf=0;nf<10;nf++){
-      fhTemplRefl->Fit(f,"REM","");
+      FitHisto(fhTemplRefl,f,"REM","");
       //,h->GetBinLowEdge(1),h->GetXaxis()->GetBinUpEdge(h->GetNbinsX()));
     }
     //    Printf("We USED %d POINTS in the Fit",f->GetNumberFitPoints());
@@ -437,7 +437,7 @@ TH1F*  AliHFMassFitterVAR::SetTemplateReflections(const TH1F *h, TString opt,Dou
     //    f->SetParLimits(0,0,100.*h->Integral());
     // Hard to initialize the other parameters...
 
-    fhTemplRefl->Fit(f,"RLEMI","");//,h->GetBinLowEdge(1),h->GetXaxis()->GetBinUpEdge(h->GetNbinsX()));
+    FitHisto(fhTemplRefl,f,"RLEMI","");//,h->GetBinLowEdge(1),h->GetXaxis()->GetBinUpEdge(h->GetNbinsX()));
 
 
     for(Int_t j=1;j<=fhTemplRefl->GetNbinsX();j++){
@@ -792,8 +792,9 @@ Bool_t AliHFMassFitterVAR::CheckRangeFit(){
 Bool_t AliHFMassFitterVAR::MassFitter(Bool_t draw){  
   // Main method of the class: performs the fit of the histogram
 
-  //Set default fitter Minuit in order to use gMinuit in the contour plots    
-  TVirtualFitter::SetDefaultFitter("Minuit");
+  //Set default fitter Minuit as in AliHFMassFitter, unless a minimizer is
+  //passed to each fit (SetMinimizer)
+  MinuitDefaultScope minuitDefault(fMinimizer.IsNull());
 
   Bool_t isBkgOnly=kFALSE;
   Double_t slope1=-1,slope2=1,slope3=1;
@@ -899,7 +900,7 @@ Bool_t AliHFMassFitterVAR::MassFitter(Bool_t draw){
   //if only signal and reflection: skip
   if (!(ftypeOfFit4Bkg==3 && ftypeOfFit4Sgn==1)) {
     //    ftypeOfFit4Sgn=0;
-    fhistoInvMass->Fit(funcbkg,"R,E,0");
+    FitHisto(fhistoInvMass,funcbkg,"R,E,0");
 
     fSideBands = kFALSE;
     //intbkg1 = funcbkg->GetParameter(0);
@@ -994,7 +995,7 @@ Bool_t AliHFMassFitterVAR::MassFitter(Bool_t draw){
 
   Int_t status;
   Printf("Fitting");
-  status = fhistoInvMass->Fit(massname.Data(),Form("R,%s,+,0",fFitOption.Data()));
+  status = FitHisto(fhistoInvMass,funcmass,Form("R,%s,+,0",fFitOption.Data()));
   if (status != 0){
     cout<<"Minuit returned "<<status<<endl;
     delete funcbkg;
@@ -1082,7 +1083,7 @@ Bool_t AliHFMassFitterVAR::PrepareHighPolFit(TF1 *fback){
       funcbkg->SetParameter(1,estimateslope);
 
     }
-    hCp->Fit(funcbkg,"REMN","");
+    FitHisto(hCp,funcbkg,"REMN","");
     funcPrev=(TF1*)funcbkg->Clone("ftemp");
     delete funcbkg;
     fpolbackdegreeTayHelp++;
@@ -1095,7 +1096,7 @@ Bool_t AliHFMassFitterVAR::PrepareHighPolFit(TF1 *fback){
     fback->SetParameter(j,funcPrev->GetParameter(j));
     fback->SetParError(j,funcPrev->GetParError(j));
   }
-  hCp->Fit(fback,"REMN","");// THIS IS JUST TO SET NOT ONLY THE PARAMETERS BUT ALSO chi2, etc...
+  FitHisto(hCp,fback,"REMN","");// THIS IS JUST TO SET NOT ONLY THE PARAMETERS BUT ALSO chi2, etc...
 
 
   // The following lines might be useful for debugging
@@ -1178,7 +1179,7 @@ Bool_t AliHFMassFitterVAR::RefitWithBkgOnly(Bool_t draw){
       fhistoInvMass->GetFunction(funcbkg->GetName())->SetBit(1<<9,kTRUE);
     }
   }
-  else status=fhistoInvMass->Fit(bkgname.Data(),"R,E,+,0");
+  else status=FitHisto(fhistoInvMass,funcbkg,"R,E,+,0");
   if (status != 0){
     ftypeOfFit4Sgn=typesSave;
     cout<<"Minuit returned "<<status<<endl;
@@ -22,6 +22,11 @@
 #include <TF1.h>
 #include <TLatex.h>
 #include <TFile.h>
+#include <TROOT.h>
+#include <TDirectory.h>
+#include <TStopwatch.h>
+#include <atomic>
+#include <thread>
 #include "AliHFMassFitter.h"
 #include "AliHFMassFitterVAR.h"
 #include "AliHFMultiTrials.h"
@@ -30,6 +35,32 @@
 ClassImp(AliHFMultiTrials);
 /// \endcond
 
+/// outcome of a single fit of the multi trial
+struct AliHFMultiTrials::TrialResult {
+  TrialResult() : fAccepted(kFALSE), fConfSig(0), fConfMean(0), fChisq(-1.), fSigma(0.), fSigmaErr(0.),
+    fMean(0.), fMeanErr(0.), fRawYield(0.), fRawYieldErr(0.), fSignif(0.), fSignifErr(0.),
+    fBkg(0.), fBkgErr(0.), fBkgBEdge(0.), fBkgBEdgeErr(0.), fBinCount(), fBinCountErr(), fFitTime(0.) {}
+  Bool_t fAccepted;     /// fit converged and passed the sigma/chi2 quality selection
+  Int_t fConfSig;       /// sigma configuration stored in the ntuple
+  Int_t fConfMean;      /// mean configuration stored in the ntuple
+  Double_t fChisq;      /// reduced chi2
+  Double_t fSigma;      /// gaussian sigma
+  Double_t fSigmaErr;   /// error on gaussian sigma
+  Double_t fMean;       /// gaussian mean
+  Double_t fMeanErr;    /// error on gaussian mean
+  Double_t fRawYield;   /// raw yield
+  Double_t fRawYieldErr; /// error on raw yield
+  Double_t fSignif;     /// significance
+  Double_t fSignifErr;  /// error on significance
+  Double_t fBkg;        /// background in nsigma
+  Double_t fBkgErr;     /// error on background in nsigma
+  Double_t fBkgBEdge;   /// background in mass bin edges
+  Double_t fBkgBEdgeErr; /// error on background in mass bin edges
+  std::vector<Double_t> fBinCount;    /// bin counting yield per nsigma step
+  std::vector<Double_t> fBinCountErr; /// error on bin counting yield per nsigma step
+  Double_t fFitTime;    /// wall time of the fit (s)
+};
+
 
 //_________________________________________________________________________
 AliHFMultiTrials::AliHFMultiTrials() : 
@@ -90,6 +121,8 @@ AliHFMultiTrials::AliHFMultiTrials() :
   fNtupleMultiTrials(0x0),
   fMinYieldGlob(0),
   fMaxYieldGlob(0),
+  fNumOfThreads(1),
+  fUseNeighbourSeeding(kFALSE),
   fMassFitters()
 {
   // constructor
@@ -101,6 +134,10 @@ AliHFMultiTrials::AliHFMultiTrials() :
   ConfigureLowLimFitSteps(6,minMassStep);
   ConfigureUpLimFitSteps(6,maxMassStep);
   ConfigurenSigmaBinCSteps(11,nSigmasBC);
+  for(Int_t ic=0; ic<kNBkgFuncCases*kNFitConfCases; ic++){
+    fFitTimePerCase[ic]=0.;
+    fNumOfFitsPerCase[ic]=0;
+  }
 }
 
 //________________________________________________________________________
@@ -186,242 +223,183 @@ Bool_t AliHFMultiTrials::CreateHistos(){
 
 }
 
+//________________________________________________________________________
+Bool_t AliHFMultiTrials::IsCaseEnabled(Int_t typeb, Int_t igs) const{
+  // check if the background function and the sigma/mean configuration are used
+  if(typeb==kExpoBkg && !fUseExpoBkg) return kFALSE;
+  if(typeb==kLinBkg && !fUseLinBkg) return kFALSE;
+  if(typeb==kPol2Bkg && !fUsePol2Bkg) return kFALSE;
+  if(typeb==kPol3Bkg && !fUsePol3Bkg) return kFALSE;
+  if(typeb==kPol4Bkg && !fUsePol4Bkg) return kFALSE;
+  if(typeb==kPol5Bkg && !fUsePol5Bkg) return kFALSE;
+  if(typeb==kPowBkg && !fUsePowLawBkg) return kFALSE;
+  if(typeb==kPowTimesExpoBkg && !fUsePowLawTimesExpoBkg) return kFALSE;
+  if (igs==kFixSigUpFreeMean && !fUseFixSigUpFreeMean) return kFALSE;
+  if (igs==kFixSigDownFreeMean && !fUseFixSigDownFreeMean) return kFALSE;
+  if (igs==kFreeSigFixMean  && !fUseFixedMeanFreeS) return kFALSE;
+  if (igs==kFreeSigFreeMean  && !fUseFreeS) return kFALSE;
+  if (igs==kFixSigFreeMean  && !fUseFixSigFreeMean) return kFALSE;
+  if (igs==kFixSigFixMean   && !fUseFixSigFixMean) return kFALSE;
+  return kTRUE;
+}
+
 //________________________________________________________________________
 Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
   // perform the multiple fits
+  // The fits are grouped in chains of fit ranges with the same rebin, first bin,
+  // background function and sigma/mean configuration. Chains are independent and
+  // are distributed over fNumOfThreads threads (each fit has its own fitter and
+  // functions). Results are stored per trial and the output histograms and ntuple
+  // are filled afterwards in the same order as the serial loop.
 
   Bool_t hOK=CreateHistos();
   if(!hOK) return kFALSE;
 
-  Int_t itrial=0;
-  Int_t types=0;
+  const Int_t nCases=kNBkgFuncCases*kNFitConfCases;
   Int_t itrialBC=0;
   Int_t totTrials=fNumOfRebinSteps*fNumOfFirstBinSteps*fNumOfLowLimFitSteps*fNumOfUpLimFitSteps;
+  Int_t nRangeSteps=fNumOfLowLimFitSteps*fNumOfUpLimFitSteps;
 
   fMinYieldGlob=999999.;
   fMaxYieldGlob=0.;
-  Float_t xnt[15];
+  for(Int_t ic=0; ic<nCases; ic++){
+    fFitTimePerCase[ic]=0.;
+    fNumOfFitsPerCase[ic]=0;
+  }
 
+  // rebinned histograms are prepared once and only read during the fits
+  Int_t nHistos=fNumOfRebinSteps*fNumOfFirstBinSteps;
+  std::vector<TH1F*> hRebinned(nHistos,0x0);
+  for(Int_t ir=0; ir<fNumOfRebinSteps; ir++){
+    for(Int_t iFirstBin=1; iFirstBin<=fNumOfFirstBinSteps; iFirstBin++) {
+      Int_t ih=ir*fNumOfFirstBinSteps+iFirstBin-1;
+      if(fNumOfFirstBinSteps==1) hRebinned[ih]=RebinHisto(hInvMassHisto,fRebinSteps[ir],-1);
+      else hRebinned[ih]=RebinHisto(hInvMassHisto,fRebinSteps[ir],iFirstBin);
+    }
+  }
+
+  // chains of fits that can run independently
+  std::vector<Int_t> chains;
+  for(Int_t ih=0; ih<nHistos; ih++){
+    for(Int_t typeb=0; typeb<kNBkgFuncCases; typeb++){
+      for(Int_t igs=0; igs<kNFitConfCases; igs++){
+        if(!IsCaseEnabled(typeb,igs)) continue;
+        chains.push_back(ih*nCases+igs*kNBkgFuncCases+typeb);
+      }
+    }
+  }
+
+  std::vector<TrialResult> results(totTrials*nCases);
+  Int_t nThreads=fNumOfThreads;
+  if(fDrawIndividualFits && thePad) nThreads=1; // drawing is not thread safe
+  if(nThreads>(Int_t)chains.size()) nThreads=(Int_t)chains.size();
+
+  // the fit functions are kept off the global list, where equally named TF1s
+  // of different fitters would replace each other
+  Bool_t addToGlobList=TF1::DefaultAddToGlobalList(kFALSE);
+  if(nThreads<=1){
+    for(UInt_t jc=0; jc<chains.size(); jc++) FitTrialChain(hInvMassHisto,hRebinned,chains[jc],results,thePad);
+  }else{
+    ROOT::EnableThreadSafety();
+    printf("AliHFMultiTrials: running %d chains of fits on %d threads\n",(Int_t)chains.size(),nThreads);
+    std::atomic<UInt_t> nextChain(0);
+    std::vector<std::thread> workers;
+    for(Int_t it=0; it<nThreads; it++){
+      workers.push_back(std::thread([&](){
+            TDirectory::TContext context(nullptr);
+            UInt_t jc;
+            while((jc=nextChain++)<chains.size()) FitTrialChain(hInvMassHisto,hRebinned,chains[jc],results,0x0);
+          }));
+    }
+    for(UInt_t it=0; it<workers.size(); it++) workers[it].join();
+  }
+  TF1::DefaultAddToGlobalList(addToGlobList);
+
+  // fill the output in the order of the serial loops
+  Float_t xnt[15];
+  Int_t itrial=0;
   for(Int_t ir=0; ir<fNumOfRebinSteps; ir++){
     Int_t rebin=fRebinSteps[ir];
     for(Int_t iFirstBin=1; iFirstBin<=fNumOfFirstBinSteps; iFirstBin++) {
-      TH1F* hRebinned=0x0;
-      if(fNumOfFirstBinSteps==1) hRebinned=RebinHisto(hInvMassHisto,rebin,-1);
-      else hRebinned=RebinHisto(hInvMassHisto,rebin,iFirstBin);
+      TH1F* hReb=hRebinned[ir*fNumOfFirstBinSteps+iFirstBin-1];
       for(Int_t iMinMass=0; iMinMass<fNumOfLowLimFitSteps; iMinMass++){
         Double_t minMassForFit=fLowLimFitSteps[iMinMass];
-        Double_t hmin=TMath::Max(minMassForFit,hRebinned->GetBinLowEdge(2));
         for(Int_t iMaxMass=0; iMaxMass<fNumOfUpLimFitSteps; iMaxMass++){
           Double_t maxMassForFit=fUpLimFitSteps[iMaxMass];
-          Double_t hmax=TMath::Min(maxMassForFit,hRebinned->GetBinLowEdge(hRebinned->GetNbinsX()));
           ++itrial;
           for(Int_t typeb=0; typeb<kNBkgFuncCases; typeb++){
-            if(typeb==kExpoBkg && !fUseExpoBkg) continue;
-            if(typeb==kLinBkg && !fUseLinBkg) continue;
-            if(typeb==kPol2Bkg && !fUsePol2Bkg) continue;
-            if(typeb==kPol3Bkg && !fUsePol3Bkg) continue;
-            if(typeb==kPol4Bkg && !fUsePol4Bkg) continue;
-            if(typeb==kPol5Bkg && !fUsePol5Bkg) continue;
-            if(typeb==kPowBkg && !fUsePowLawBkg) continue;
-            if(typeb==kPowTimesExpoBkg && !fUsePowLawTimesExpoBkg) continue;
             for(Int_t igs=0; igs<kNFitConfCases; igs++){
-              if (igs==kFixSigUpFreeMean && !fUseFixSigUpFreeMean) continue;
-              if (igs==kFixSigDownFreeMean && !fUseFixSigDownFreeMean) continue;
-              if (igs==kFreeSigFixMean  && !fUseFixedMeanFreeS) continue;
-              if (igs==kFreeSigFreeMean  && !fUseFreeS) continue;
-              if (igs==kFixSigFreeMean  && !fUseFixSigFreeMean) continue;
-              if (igs==kFixSigFixMean   && !fUseFixSigFixMean) continue;
+              if(!IsCaseEnabled(typeb,igs)) continue;
               Int_t theCase=igs*kNBkgFuncCases+typeb;
               Int_t globBin=itrial+theCase*totTrials;
+              const TrialResult& res=results[(itrial-1)*nCases+theCase];
+              fFitTimePerCase[theCase]+=res.fFitTime;
+              fNumOfFitsPerCase[theCase]++;
               for(Int_t j=0; j<15; j++) xnt[j]=0.;
-
-              Bool_t mustDeleteFitter = kTRUE;
-              AliHFMassFitterVAR*  fitter=0x0;
-              //if D0 Reflection
-              if(fhTemplRefl){
-                fitter=new AliHFMassFitterVAR(hRebinned,hmin,hmax,1,typeb,2);
-                fitter->SetTemplateReflections(fhTemplRefl);
-                fitter->SetFixReflOverS(fFixRefloS,kTRUE);
-              }
-              else {
-                if(typeb<=kPol2Bkg){
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,typeb,types);
-                }else if(typeb==kPowBkg){
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,4,types);
-                }else if(typeb==kPowTimesExpoBkg){
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,5,types);
-                }else{
-                  fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,6,types);
-                  if(typeb==kPol3Bkg) fitter->SetBackHighPolDegree(3);
-                  if(typeb==kPol4Bkg) fitter->SetBackHighPolDegree(4);
-                  if(typeb==kPol5Bkg) fitter->SetBackHighPolDegree(5);
-                }
-                fitter->SetReflectionSigmaFactor(0);
-              }
-              if(fFitOption==0) {
-                fitter->SetUseLikelihoodFit();
-                Printf("Using likelihood fit");
-              }
-              else if(fFitOption==1) {
-                fitter->SetUseChi2Fit();
-                Printf("Using chi2 fit");
-              }
-              else if (fFitOption==2) {
-                fitter->SetUseLikelihoodWithWeightsFit();
-                Printf("Using likelihood fit with weights");
-              }
-              fitter->SetInitialGaussianMean(fMassD);
-              fitter->SetInitialGaussianSigma(fSigmaGausMC);
               xnt[0]=rebin;
               xnt[1]=iFirstBin;
               xnt[2]=minMassForFit;
               xnt[3]=maxMassForFit;
               xnt[4]=typeb;
-              xnt[6]=0;
-              if(igs==kFixSigFreeMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
-                xnt[5]=1;
-              }else if(igs==kFixSigUpFreeMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC*(1.+fSigmaMCVariation),kTRUE);
-                xnt[5]=2;
-              }else if(igs==kFixSigDownFreeMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC*(1.-fSigmaMCVariation),kTRUE);
-                xnt[5]=3;
-              }else if(igs==kFreeSigFreeMean){
-                xnt[5]=0;
-              }else if(igs==kFixSigFixMean){
-                fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
-                fitter->SetFixGaussianMean(fMassD,kTRUE);
-                xnt[5]=1;
-                xnt[6]=1;
-              }else if(igs==kFreeSigFixMean){
-                fitter->SetFixGaussianMean(fMassD,kTRUE);
-                xnt[5]=0;
-                xnt[6]=1;
-              }
-              Bool_t out=kFALSE;
-              Double_t chisq=-1.;
-              Double_t sigma=0.;
-              Double_t esigma=0.;
-              Double_t pos=.0;
-              Double_t epos=.0;
-              Double_t ry=.0;
-              Double_t ery=.0;
-              Double_t significance=0.;
-              Double_t erSignif=0.;
-              Double_t bkg=0.;
-              Double_t erbkg=0.;
-              Double_t bkgBEdge=0;
-              Double_t erbkgBEdge=0;
-              TF1* fB1=0x0;
-              if(typeb<kNBkgFuncCases){
-                printf("****** START FIT OF HISTO %s WITH REBIN %d FIRST BIN %d MASS RANGE %f-%f BACKGROUND FIT FUNCTION=%d CONFIG SIGMA/MEAN=%d\n",hInvMassHisto->GetName(),rebin,iFirstBin,minMassForFit,maxMassForFit,typeb,igs);
-                out=fitter->MassFitter(0);
-                chisq=fitter->GetReducedChiSquare();
-                fitter->Significance(fnSigmaForBkgEval,significance,erSignif);
-                sigma=fitter->GetSigma();
-                pos=fitter->GetMean();
-                esigma=fitter->GetSigmaUncertainty();
-                if(esigma<0.00001) esigma=0.0001;
-                epos=fitter->GetMeanUncertainty();
-                if(epos<0.00001) epos=0.0001;
-                ry=fitter->GetRawYield();
-                ery=fitter->GetRawYieldError();
-                fB1=fitter->GetBackgroundFullRangeFunc();
-                fitter->Background(fnSigmaForBkgEval,bkg,erbkg);
-                Double_t minval = hInvMassHisto->GetXaxis()->GetBinLowEdge(hInvMassHisto->FindBin(pos-fnSigmaForBkgEval*sigma));
-                Double_t maxval = hInvMassHisto->GetXaxis()->GetBinUpEdge(hInvMassHisto->FindBin(pos+fnSigmaForBkgEval*sigma));
-                fitter->Background(minval,maxval,bkgBEdge,erbkgBEdge);
-                if(out && fDrawIndividualFits && thePad){
-                  thePad->Clear();
-                  fitter->DrawHere(thePad, fnSigmaForBkgEval);
-                  fMassFitters.push_back(fitter);
-                  mustDeleteFitter = kFALSE;
-                  for (auto format : fInvMassFitSaveAsFormats) {
-                    thePad->SaveAs(Form("FitOutput_%s_Trial%d.%s",hInvMassHisto->GetName(),globBin, format.c_str()));
-                  }
-                }
-              }
-              // else{
-              //   out=DoFitWithPol3Bkg(hRebinned,hmin,hmax,igs);
-              //   if(out && thePad){
-              // 	thePad->Clear();
-              // 	hRebinned->Draw();
-              // 	TF1* fSB=(TF1*)hRebinned->GetListOfFunctions()->FindObject("fSB");
-              // 	fB1=new TF1("fB1","[0]+[1]*x+[2]*x*x+[3]*x*x*x",hmin,hmax);
-              // 	for(Int_t j=0; j<4; j++) fB1->SetParameter(j,fSB->GetParameter(3+j));
-              // 	fB1->SetLineColor(2);
-              // 	fB1->Draw("same");
-              // 	fSB->SetLineColor(4);
-              // 	fSB->Draw("same");
-              // 	thePad->Update();
-              // 	chisq=fSB->GetChisquare()/fSB->GetNDF();;
-              // 	sigma=fSB->GetParameter(2);
-              // 	esigma=fSB->GetParError(2);
-              // 	if(esigma<0.00001) esigma=0.0001;
-              // 	pos=fSB->GetParameter(1);
-              // 	epos=fSB->GetParError(1);
-              // 	if(epos<0.00001) epos=0.0001;
-              // 	ry=fSB->GetParameter(0)/hRebinned->GetBinWidth(1);
-              // 	ery=fSB->GetParError(0)/hRebinned->GetBinWidth(1);
-              //   }
-              // }
-              xnt[7]=chisq;
-              if(out && chisq>0. && sigma>0.5*fSigmaGausMC && sigma<2.0*fSigmaGausMC){
-                xnt[8]=significance;
-                xnt[9]=pos;
-                xnt[10]=epos;
-                xnt[11]=sigma;
-                xnt[12]=esigma;
+              xnt[5]=res.fConfSig;
+              xnt[6]=res.fConfMean;
+              xnt[7]=res.fChisq;
+              if(res.fAccepted){
+                Double_t ry=res.fRawYield;
+                xnt[8]=res.fSignif;
+                xnt[9]=res.fMean;
+                xnt[10]=res.fMeanErr;
+                xnt[11]=res.fSigma;
+                xnt[12]=res.fSigmaErr;
                 xnt[13]=ry;
-                xnt[14]=ery;
+                xnt[14]=res.fRawYieldErr;
                 fHistoRawYieldDistAll->Fill(ry);
                 fHistoRawYieldTrialAll->SetBinContent(globBin,ry);
-                fHistoRawYieldTrialAll->SetBinError(globBin,ery);
-                fHistoSigmaTrialAll->SetBinContent(globBin,sigma);
-                fHistoSigmaTrialAll->SetBinError(globBin,esigma);
-                fHistoMeanTrialAll->SetBinContent(globBin,pos);
-                fHistoMeanTrialAll->SetBinError(globBin,epos);
-                fHistoChi2TrialAll->SetBinContent(globBin,chisq);
+                fHistoRawYieldTrialAll->SetBinError(globBin,res.fRawYieldErr);
+                fHistoSigmaTrialAll->SetBinContent(globBin,res.fSigma);
+                fHistoSigmaTrialAll->SetBinError(globBin,res.fSigmaErr);
+                fHistoMeanTrialAll->SetBinContent(globBin,res.fMean);
+                fHistoMeanTrialAll->SetBinError(globBin,res.fMeanErr);
+                fHistoChi2TrialAll->SetBinContent(globBin,res.fChisq);
                 fHistoChi2TrialAll->SetBinError(globBin,0.00001);
-                fHistoSignifTrialAll->SetBinContent(globBin,significance);
-                fHistoSignifTrialAll->SetBinError(globBin,erSignif);
+                fHistoSignifTrialAll->SetBinContent(globBin,res.fSignif);
+                fHistoSignifTrialAll->SetBinError(globBin,res.fSignifErr);
                 if(fSaveBkgVal) {
-                  fHistoBkgTrialAll->SetBinContent(globBin,bkg);
-                  fHistoBkgTrialAll->SetBinError(globBin,erbkg);
-                  fHistoBkgInBinEdgesTrialAll->SetBinContent(globBin,bkgBEdge);
-                  fHistoBkgInBinEdgesTrialAll->SetBinError(globBin,erbkgBEdge);
+                  fHistoBkgTrialAll->SetBinContent(globBin,res.fBkg);
+                  fHistoBkgTrialAll->SetBinError(globBin,res.fBkgErr);
+                  fHistoBkgInBinEdgesTrialAll->SetBinContent(globBin,res.fBkgBEdge);
+                  fHistoBkgInBinEdgesTrialAll->SetBinError(globBin,res.fBkgBEdgeErr);
                 }
 
                 if(ry<fMinYieldGlob) fMinYieldGlob=ry;
                 if(ry>fMaxYieldGlob) fMaxYieldGlob=ry;
                 fHistoRawYieldDist[theCase]->Fill(ry);
                 fHistoRawYieldTrial[theCase]->SetBinContent(itrial,ry);
-                fHistoRawYieldTrial[theCase]->SetBinError(itrial,ery);
-                fHistoSigmaTrial[theCase]->SetBinContent(itrial,sigma);
-                fHistoSigmaTrial[theCase]->SetBinError(itrial,esigma);
-                fHistoMeanTrial[theCase]->SetBinContent(itrial,pos);
-                fHistoMeanTrial[theCase]->SetBinError(itrial,epos);
-                fHistoChi2Trial[theCase]->SetBinContent(itrial,chisq);
+                fHistoRawYieldTrial[theCase]->SetBinError(itrial,res.fRawYieldErr);
+                fHistoSigmaTrial[theCase]->SetBinContent(itrial,res.fSigma);
+                fHistoSigmaTrial[theCase]->SetBinError(itrial,res.fSigmaErr);
+                fHistoMeanTrial[theCase]->SetBinContent(itrial,res.fMean);
+                fHistoMeanTrial[theCase]->SetBinError(itrial,res.fMeanErr);
+                fHistoChi2Trial[theCase]->SetBinContent(itrial,res.fChisq);
                 fHistoChi2Trial[theCase]->SetBinError(itrial,0.00001);
-                fHistoSignifTrial[theCase]->SetBinContent(itrial,significance);
-                fHistoSignifTrial[theCase]->SetBinError(itrial,erSignif);
+                fHistoSignifTrial[theCase]->SetBinContent(itrial,res.fSignif);
+                fHistoSignifTrial[theCase]->SetBinError(itrial,res.fSignifErr);
                 if(fSaveBkgVal) {
-                  fHistoBkgTrial[theCase]->SetBinContent(itrial,bkg);
-                  fHistoBkgTrial[theCase]->SetBinError(itrial,erbkg);
-                  fHistoBkgInBinEdgesTrial[theCase]->SetBinContent(itrial,bkgBEdge);
-                  fHistoBkgInBinEdgesTrial[theCase]->SetBinError(itrial,erbkgBEdge);
+                  fHistoBkgTrial[theCase]->SetBinContent(itrial,res.fBkg);
+                  fHistoBkgTrial[theCase]->SetBinError(itrial,res.fBkgErr);
+                  fHistoBkgInBinEdgesTrial[theCase]->SetBinContent(itrial,res.fBkgBEdge);
+                  fHistoBkgInBinEdgesTrial[theCase]->SetBinError(itrial,res.fBkgBEdgeErr);
                 }
 
                 for(Int_t iStepBC=0; iStepBC<fNumOfnSigmaBinCSteps; iStepBC++){
-                  Double_t minMassBC=fMassD-fnSigmaBinCSteps[iStepBC]*sigma;
-                  Double_t maxMassBC=fMassD+fnSigmaBinCSteps[iStepBC]*sigma;
+                  Double_t minMassBC=fMassD-fnSigmaBinCSteps[iStepBC]*res.fSigma;
+                  Double_t maxMassBC=fMassD+fnSigmaBinCSteps[iStepBC]*res.fSigma;
                   if(minMassBC>minMassForFit &&
                       maxMassBC<maxMassForFit &&
-                      minMassBC>(hRebinned->GetXaxis()->GetXmin()) &&
-                      maxMassBC<(hRebinned->GetXaxis()->GetXmax())){
-                    Double_t cnts,ecnts;
-                    BinCount(hRebinned,fB1,1,minMassBC,maxMassBC,cnts,ecnts);
+                      minMassBC>(hReb->GetXaxis()->GetXmin()) &&
+                      maxMassBC<(hReb->GetXaxis()->GetXmax())){
+                    Double_t cnts=res.fBinCount[iStepBC];
+                    Double_t ecnts=res.fBinCountErr[iStepBC];
                     ++itrialBC;
                     fHistoRawYieldDistBinCAll->Fill(cnts);
                     fHistoRawYieldTrialBinCAll->SetBinContent(globBin,iStepBC+1,cnts);
@@ -432,18 +410,187 @@ Bool_t AliHFMultiTrials::DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad){
                   }
                 }
               }
-              if (mustDeleteFitter) delete fitter;
               fNtupleMultiTrials->Fill(xnt);
             }
           }
         }
       }
-      delete hRebinned;
     }
   }
+  for(Int_t ih=0; ih<nHistos; ih++) delete hRebinned[ih];
+  PrintTimingReport();
   return kTRUE;
 }
 
+//________________________________________________________________________
+void AliHFMultiTrials::FitTrialChain(TH1D* hInvMassHisto, const std::vector<TH1F*>& hRebinned, Int_t chain, std::vector<TrialResult>& results, TPad* thePad){
+  // fit all the mass ranges for one rebinned histogram, background function
+  // and sigma/mean configuration; each fit can be seeded with the
+  // converged mean and sigma of the previous mass range
+
+  const Int_t nCases=kNBkgFuncCases*kNFitConfCases;
+  Int_t theCase=chain%nCases;
+  Int_t ih=chain/nCases;
+  Int_t typeb=theCase%kNBkgFuncCases;
+  Int_t igs=theCase/kNBkgFuncCases;
+  Int_t ir=ih/fNumOfFirstBinSteps;
+  Int_t iFirstBin=ih%fNumOfFirstBinSteps+1;
+  Int_t totTrials=fNumOfRebinSteps*fNumOfFirstBinSteps*fNumOfLowLimFitSteps*fNumOfUpLimFitSteps;
+  const TrialResult* seed=0x0;
+  for(Int_t iMinMass=0; iMinMass<fNumOfLowLimFitSteps; iMinMass++){
+    for(Int_t iMaxMass=0; iMaxMass<fNumOfUpLimFitSteps; iMaxMass++){
+      Int_t itrial=ih*fNumOfLowLimFitSteps*fNumOfUpLimFitSteps+iMinMass*fNumOfUpLimFitSteps+iMaxMass+1;
+      Int_t globBin=itrial+theCase*totTrials;
+      TrialResult& res=results[(itrial-1)*nCases+theCase];
+      FitTrial(hInvMassHisto,hRebinned[ih],fRebinSteps[ir],iFirstBin,fLowLimFitSteps[iMinMass],fUpLimFitSteps[iMaxMass],typeb,igs,globBin,fUseNeighbourSeeding ? seed : 0x0,res,thePad);
+      if(res.fAccepted) seed=&res;
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliHFMultiTrials::FitTrial(TH1D* hInvMassHisto, TH1F* hRebinned, Int_t rebin, Int_t iFirstBin,
+                                Double_t minMassForFit, Double_t maxMassForFit, Int_t typeb, Int_t igs,
+                                Int_t globBin, const TrialResult* seed, TrialResult& res, TPad* thePad){
+  // perform one fit and store its outcome
+  // (thePad must be null when called from the worker threads)
+
+  TStopwatch timer;
+  timer.Start();
+  Int_t types=0;
+  Double_t hmin=TMath::Max(minMassForFit,hRebinned->GetBinLowEdge(2));
+  Double_t hmax=TMath::Min(maxMassForFit,hRebinned->GetBinLowEdge(hRebinned->GetNbinsX()));
+
+  Bool_t mustDeleteFitter = kTRUE;
+  AliHFMassFitterVAR*  fitter=0x0;
+  //if D0 Reflection
+  if(fhTemplRefl){
+    fitter=new AliHFMassFitterVAR(hRebinned,hmin,hmax,1,typeb,2);
+    fitter->SetTemplateReflections(fhTemplRefl);
+    fitter->SetFixReflOverS(fFixRefloS,kTRUE);
+  }
+  else {
+    if(typeb<=kPol2Bkg){
+      fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,typeb,types);
+    }else if(typeb==kPowBkg){
+      fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,4,types);
+    }else if(typeb==kPowTimesExpoBkg){
+      fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,5,types);
+    }else{
+      fitter=new AliHFMassFitterVAR(hRebinned,hmin, hmax,1,6,types);
+      if(typeb==kPol3Bkg) fitter->SetBackHighPolDegree(3);
+      if(typeb==kPol4Bkg) fitter->SetBackHighPolDegree(4);
+      if(typeb==kPol5Bkg) fitter->SetBackHighPolDegree(5);
+    }
+    fitter->SetReflectionSigmaFactor(0);
+  }
+  // Minuit2 is passed to each fit, for any number of threads, so that the
+  // trial results do not depend on it (TMinuit is not reentrant) and the
+  // default minimizer of the caller is not changed
+  fitter->SetMinimizer("Minuit2");
+  if(fFitOption==0) {
+    fitter->SetUseLikelihoodFit();
+    Printf("Using likelihood fit");
+  }
+  else if(fFitOption==1) {
+    fitter->SetUseChi2Fit();
+    Printf("Using chi2 fit");
+  }
+  else if (fFitOption==2) {
+    fitter->SetUseLikelihoodWithWeightsFit();
+    Printf("Using likelihood fit with weights");
+  }
+  // fixed values set below override the seed
+  fitter->SetInitialGaussianMean(seed ? seed->fMean : fMassD);
+  fitter->SetInitialGaussianSigma(seed ? seed->fSigma : fSigmaGausMC);
+  res.fConfMean=0;
+  if(igs==kFixSigFreeMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
+    res.fConfSig=1;
+  }else if(igs==kFixSigUpFreeMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC*(1.+fSigmaMCVariation),kTRUE);
+    res.fConfSig=2;
+  }else if(igs==kFixSigDownFreeMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC*(1.-fSigmaMCVariation),kTRUE);
+    res.fConfSig=3;
+  }else if(igs==kFreeSigFreeMean){
+    res.fConfSig=0;
+  }else if(igs==kFixSigFixMean){
+    fitter->SetFixGaussianSigma(fSigmaGausMC,kTRUE);
+    fitter->SetFixGaussianMean(fMassD,kTRUE);
+    res.fConfSig=1;
+    res.fConfMean=1;
+  }else if(igs==kFreeSigFixMean){
+    fitter->SetFixGaussianMean(fMassD,kTRUE);
+    res.fConfSig=0;
+    res.fConfMean=1;
+  }
+  Bool_t out=kFALSE;
+  TF1* fB1=0x0;
+  if(typeb<kNBkgFuncCases){
+    printf("****** START FIT OF HISTO %s WITH REBIN %d FIRST BIN %d MASS RANGE %f-%f BACKGROUND FIT FUNCTION=%d CONFIG SIGMA/MEAN=%d\n",hInvMassHisto->GetName(),rebin,iFirstBin,minMassForFit,maxMassForFit,typeb,igs);
+    out=fitter->MassFitter(0);
+    res.fChisq=fitter->GetReducedChiSquare();
+    fitter->Significance(fnSigmaForBkgEval,res.fSignif,res.fSignifErr);
+    res.fSigma=fitter->GetSigma();
+    res.fMean=fitter->GetMean();
+    res.fSigmaErr=fitter->GetSigmaUncertainty();
+    if(res.fSigmaErr<0.00001) res.fSigmaErr=0.0001;
+    res.fMeanErr=fitter->GetMeanUncertainty();
+    if(res.fMeanErr<0.00001) res.fMeanErr=0.0001;
+    res.fRawYield=fitter->GetRawYield();
+    res.fRawYieldErr=fitter->GetRawYieldError();
+    fB1=fitter->GetBackgroundFullRangeFunc();
+    fitter->Background(fnSigmaForBkgEval,res.fBkg,res.fBkgErr);
+    Double_t minval = hInvMassHisto->GetXaxis()->GetBinLowEdge(hInvMassHisto->FindBin(res.fMean-fnSigmaForBkgEval*res.fSigma));
+    Double_t maxval = hInvMassHisto->GetXaxis()->GetBinUpEdge(hInvMassHisto->FindBin(res.fMean+fnSigmaForBkgEval*res.fSigma));
+    fitter->Background(minval,maxval,res.fBkgBEdge,res.fBkgBEdgeErr);
+    if(out && fDrawIndividualFits && thePad){
+      thePad->Clear();
+      fitter->DrawHere(thePad, fnSigmaForBkgEval);
+      fMassFitters.push_back(fitter);
+      mustDeleteFitter = kFALSE;
+      for (auto format : fInvMassFitSaveAsFormats) {
+        thePad->SaveAs(Form("FitOutput_%s_Trial%d.%s",hInvMassHisto->GetName(),globBin, format.c_str()));
+      }
+    }
+  }
+  res.fAccepted=(out && res.fChisq>0. && res.fSigma>0.5*fSigmaGausMC && res.fSigma<2.0*fSigmaGausMC);
+  if(res.fAccepted){
+    res.fBinCount.assign(fNumOfnSigmaBinCSteps,0.);
+    res.fBinCountErr.assign(fNumOfnSigmaBinCSteps,0.);
+    for(Int_t iStepBC=0; iStepBC<fNumOfnSigmaBinCSteps; iStepBC++){
+      Double_t minMassBC=fMassD-fnSigmaBinCSteps[iStepBC]*res.fSigma;
+      Double_t maxMassBC=fMassD+fnSigmaBinCSteps[iStepBC]*res.fSigma;
+      BinCount(hRebinned,fB1,1,minMassBC,maxMassBC,res.fBinCount[iStepBC],res.fBinCountErr[iStepBC]);
+    }
+  }
+  if (mustDeleteFitter) delete fitter;
+  timer.Stop();
+  res.fFitTime=timer.RealTime();
+}
+
+//________________________________________________________________________
+void AliHFMultiTrials::PrintTimingReport() const{
+  // print the wall time spent in the fits for each background function
+  // and sigma/mean configuration
+
+  TString funcBkg[kNBkgFuncCases]={"Expo","Lin","Pol2","Pol3","Pol4","Pol5","PowLaw","PowLawExpo"};
+  TString gausSig[kNFitConfCases]={"FixedS","FixedSp20","FixedSm20","FreeS","FixedMeanFixedS","FixedMeanFreeS"};
+  Double_t totTime=0.;
+  printf("AliHFMultiTrials: timing report %s\n",fSuffix.Data());
+  for(Int_t ib=0; ib<kNBkgFuncCases; ib++){
+    for(Int_t igs=0; igs<kNFitConfCases; igs++){
+      Int_t theCase=igs*kNBkgFuncCases+ib;
+      if(fNumOfFitsPerCase[theCase]==0) continue;
+      printf("  %10s %16s : %5d fits, %8.2f s (%.3f s/fit)\n",funcBkg[ib].Data(),gausSig[igs].Data(),
+             fNumOfFitsPerCase[theCase],fFitTimePerCase[theCase],fFitTimePerCase[theCase]/fNumOfFitsPerCase[theCase]);
+      totTime+=fFitTimePerCase[theCase];
+    }
+  }
+  printf("  total fit time (summed over threads) %.2f s\n",totTime);
+}
+
 //________________________________________________________________________
 void AliHFMultiTrials::SaveToRoot(TString fileName, TString option) const{
   // save histos in a root file for further analysis
@@ -86,6 +86,12 @@ class AliHFMultiTrials : public TNamed {
   void SetSaveBkgValue(Bool_t opt=kTRUE, Double_t nsigma=3) {fSaveBkgVal=opt; fnSigmaForBkgEval=nsigma;}
 
   void SetDrawIndividualFits(Bool_t opt=kTRUE){fDrawIndividualFits=opt;}
+  /// number of threads used for the fits (fits are run serially when drawing individual fits);
+  /// the trials are always fitted with Minuit2, independently of the number of threads
+  void SetNumberOfThreads(Int_t nThreads){fNumOfThreads=nThreads>0 ? nThreads : 1;}
+  /// start each fit from the mean and sigma of the previous fit range with same settings
+  void SetUseNeighbourSeeding(Bool_t opt=kTRUE){fUseNeighbourSeeding=opt;}
+  void PrintTimingReport() const;
 
   Bool_t DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad=0x0);
   void SaveToRoot(TString fileName, TString option="recreate") const;
@@ -103,7 +109,13 @@ class AliHFMultiTrials : public TNamed {
 
  private:
 
+  struct TrialResult;
+
   Bool_t CreateHistos();
+  Bool_t IsCaseEnabled(Int_t typeb, Int_t igs) const;
+  void FitTrialChain(TH1D* hInvMassHisto, const std::vector<TH1F*>& hRebinned, Int_t chain, std::vector<TrialResult>& results, TPad* thePad);
+  void FitTrial(TH1D* hInvMassHisto, TH1F* hRebinned, Int_t rebin, Int_t iFirstBin, Double_t minMassForFit, Double_t maxMassForFit,
+                Int_t typeb, Int_t igs, Int_t globBin, const TrialResult* seed, TrialResult& res, TPad* thePad);
   TH1F* RebinHisto(TH1D* hOrig, Int_t reb, Int_t firstUse) const;
   void BinCount(TH1F* h, TF1* fB, Int_t rebin, Double_t minMass, Double_t maxMass, Double_t& count, Double_t& ecount) const;
   Bool_t DoFitWithPol3Bkg(TH1F* histoToFit, Double_t  hmin, Double_t  hmax,
@@ -178,10 +190,15 @@ class AliHFMultiTrials : public TNamed {
   Double_t fMinYieldGlob;   /// minimum yield
   Double_t fMaxYieldGlob;   /// maximum yield
 
+  Int_t fNumOfThreads;          /// number of threads for the fits
+  Bool_t fUseNeighbourSeeding;  /// flag to seed fits with the result of the previous fit range
+  Double_t fFitTimePerCase[kNBkgFuncCases*kNFitConfCases];  /// fit wall time per bkg function and sigma/mean config
+  Int_t fNumOfFitsPerCase[kNBkgFuncCases*kNFitConfCases];   /// number of fits per bkg function and sigma/mean config
+
   std::vector<AliHFMassFitterVAR*> fMassFitters; //!<! Mass fitters
 
   /// \cond CLASSIMP
-  ClassDef(AliHFMultiTrials,5); /// class for multiple trials of invariant mass fit
+  ClassDef(AliHFMultiTrials,6); /// class for multiple trials of invariant mass fit
   /// \endcond
 };
 
@@ -124,6 +124,11 @@ class AliHFSystErr : public TNamed
   /// Function to initialize the variables/histograms
   void Init(Int_t decay);
 
+  /// File with the uncertainty tables, indexed once and cached per configuration
+  /// (default: $ALICE_PHYSICS/PWGHF/vertexingHF/AliHFSystErrTables.txt)
+  static void SetTablesFile(const char* fileName);
+  static const char* GetTablesFile();
+
   void InitD0toKpi2010PbPb010CentScan();
   void InitD0toKpi2010PbPb1020CentScan();
   void InitD0toKpi2010PbPb2040CentScan();
@@ -255,129 +260,7 @@ class AliHFSystErr : public TNamed
   AliHFSystErr(const AliHFSystErr& source);
   AliHFSystErr& operator=(const AliHFSystErr& source);
 
-  void InitD0toKpi2010pp();
-  void InitD0toKpi2010ppLowEn();
-  void InitD0toKpi2010ppLowPtAn();
-  void InitD0toKpi2010ppPass4();
-  void InitD0toKpi2015pp5TeV();
-  void InitD0toKpi2017pp5TeV();
-  void InitD0toKpi2017pp5TeV_finebins();
-  void InitD0toKpi2017pp5TeVLowPtAn();
-  void InitD0toKpi2017pp5TeVLowPtAn_finebins();
-  void InitD0toKpi2016pp13TeV();
-  void InitD0toKpi20161718pp13TeVmb();
-  void InitD0toKpi20161718pp13TeVlm();
-  void InitD0toKpi20161718pp13TeVhm();
-  void InitD0toKpi2011PbPb07half();
-  void InitD0toKpi2010PbPb020();
-  void InitD0toKpi2010PbPb4080();
-  void InitD0toKpi2011PbPb3050();
-  void InitD0toKpi2011PbPb010();
-  void InitD0toKpi2013pPb0100();
-  void InitD0toKpi2016pPb0100();
-  void InitD0toKpi2016pPb5TeV_finebins();
-  void InitD0toKpi2013pPb0100LowPtAn();
-  void InitD0toKpi2016pPb0100LowPtAn();
-
-  void InitDplustoKpipi2010pp();
-  void InitDplustoKpipi2010ppPass4();
-  void InitDplustoKpipi2010ppLowEn();
-  void InitDplustoKpipi2012pp();
-  void InitDplustoKpipi2015pp5TeV();
-  void InitDplustoKpipi2017pp5TeV();
-  void InitDplustoKpipi2017pp5TeV_finebins();
-  void InitDplustoKpipi2016pp13TeV();
-  void InitDplustoKpipi2011PbPb07half();
-  void InitDplustoKpipi2010PbPb020();
-  void InitDplustoKpipi2010PbPb4080();
-  void InitDplustoKpipi2011PbPb3050();
-  void InitDplustoKpipi2011PbPb010();
-  void InitDplustoKpipi2013pPb0100();
-  void InitDplustoKpipi2016pPb0100();
-  void InitDplustoKpipi2016pPb5TeV_finebins();
-
-  void InitDstartoD0pi2010pp();
-  void InitDstartoD0pi2010ppLowEn();
-  void InitDstartoD0pi2012pp();
-  void InitDstartoD0pi2011PbPb07half();
-  void InitDstartoD0pi2010PbPb020();
-  void InitDstartoD0pi2010PbPb2040();
-  void InitDstartoD0pi2010PbPb4080();
-  void InitDstartoD0pi2011PbPb3050();
-  void InitDstartoD0pi2011PbPb010();
-  void InitDstartoD0pi2013pPb0100();
-  void InitDstartoD0pi2016pPb0100();
-  void InitDstartoD0pi2016pPb0100_fb();
-  void InitDstartoD0pi2010ppPass4();
-  void InitDstartoD0pi2017pp5TeV();
-  void InitDstartoD0pi2017pp5TeV_finebins();
-  void InitDstartoKpipi2016pp13TeV();
-
-  void InitDstoKKpi2010pp();
-  void InitDstoKKpi2010ppPass4();
-  void InitDstoKKpi2017pp5TeV();
-  void InitDstoKKpi2017pp5TeVBDT();
-  void InitDstoKKpi2011PbPb07half();
-  void InitDstoKKpi2011PbPb010();
-  void InitDstoKKpi2011PbPb2050();
-  void InitDstoKKpi2013pPb0100();
-  void InitDstoKKpi2016pPb0100();
-  void InitDstoKKpi2016pPb140trkl();
-  void InitDstoKKpi2016pPb4070trkl();
-  void InitDstoKKpi2016pPb70200trkl();
-  void InitDstoKKpi2016pp13TeV();
-
-  void InitLctopKpi2010pp();
-  void InitLctopKpi2010ppBDT();
-  void InitLctopKpi2013pPb();
-  void InitLctopKpi2013pPbBDT();
-  void InitLctopKpi2016pPb();
-  void InitLctopKpi2017pp();
-  void InitLctopKpi20161718pp13TeV();
-
-  void InitLctopK0S2010pp();
-  void InitLctopK0S2013pPb();
-  void InitLctopK0S2013pPbBDT();
-  void InitLctopK0S2016pPb();
-  void InitLctopK0S2016pPbBDT();
-  void InitLctopK0S2017pp5TeV();
-
-  void InitLctopK0S2018PbPb010BDT();
-  void InitLctopK0S2018PbPb3050BDT();
-  void InitLctopK0S2018PbPb010ML();
-  void InitLctopK0S2018PbPb3050ML();
-  void InitLctopK0S2018PbPb010();
-  void InitLctopK0S2018PbPb3050();
-
-  void InitD0toKpi2015PbPb010();
-  void InitD0toKpi2015PbPb3050();
-  void InitD0toKpi2015PbPb6080();
-
-  void InitDplustoKpipi2015PbPb010();
-  void InitDplustoKpipi2015PbPb3050();
-  void InitDplustoKpipi2015PbPb6080();
-
-  void InitDplustoKpipi2018PbPb010();
-  void InitDplustoKpipi2018PbPb3050();
-
-  void InitDstoKKpi2015PbPb010();
-  void InitDstoKKpi2015PbPb3050();
-  void InitDstoKKpi2015PbPb6080();
-  void InitDstoKKpi2018PbPb010();
-  void InitDstoKKpi2018PbPb010BDT();
-  void InitDstoKKpi2018PbPb3050();
-  void InitDstoKKpi2018PbPb3050BDT();
-
-  void InitDstartoD0pi2015PbPb010();
-  void InitDstartoD0pi2015PbPb3050();
-  void InitDstartoD0pi2015PbPb6080();
-
-  void InitDstartoD0pi2018PbPb010();
-  void InitDstartoD0pi2018PbPb3050();
-
-  void InitD0toKpi2018PbPb010();
-  void InitD0toKpi2018PbPb3050();
-  void InitD0toKpi2018PbPb010LowPtAn();
+  void InitFromTable(const char* key);
 
   TH1F* ReflectHisto(TH1F *hin) const;
 
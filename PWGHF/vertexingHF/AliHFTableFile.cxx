@@ -0,0 +1,169 @@
+/**************************************************************************
+ * Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/////////////////////////////////////////////////////////////
+//
+// Indexed text file of configurations, see AliHFTableFile.h
+//
+/////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <TSystem.h>
+#include <TError.h>
+
+#include "AliHFTableFile.h"
+
+//--------------------------------------------------------------------------
+AliHFTableFile::AliHFTableFile(const char* fileName) :
+  fFileName(fileName),
+  fIndexed(kFALSE),
+  fIndex()
+{
+  //
+  /// Constructor, the file is read at the first OpenConfig
+  //
+}
+
+//--------------------------------------------------------------------------
+void AliHFTableFile::SetFileName(const char* fileName) {
+  //
+  /// Set another file and drop the index
+  //
+  fFileName=fileName;
+  fIndexed=kFALSE;
+  fIndex.clear();
+}
+
+//--------------------------------------------------------------------------
+Bool_t AliHFTableFile::OpenConfig(const char* key, std::ifstream &in, std::string &header) {
+  //
+  /// Open the file at configuration key, the file is indexed at the first call
+  //
+  TString fileName(fFileName);
+  gSystem->ExpandPathName(fileName);
+  in.open(fileName.Data());
+  if(!in.is_open()){
+    ::Error("AliHFTableFile","Cannot open tables file %s",fileName.Data());
+    return kFALSE;
+  }
+  std::string line;
+  if(!fIndexed){
+    std::streamoff offset=in.tellg();
+    while(std::getline(in,line)){
+      if(IsConfigLine(line)){
+        size_t start=line.find_first_not_of(" ",7);
+        size_t end=line.find_first_of(" \t\r",start);
+        if(start!=std::string::npos) fIndex[line.substr(start,end-start)]=offset;
+      }
+      offset=in.tellg();
+    }
+    fIndexed=kTRUE;
+    in.clear();
+  }
+  std::unordered_map<std::string,std::streamoff>::const_iterator pos=fIndex.find(key);
+  if(pos==fIndex.end()) return kFALSE;
+  in.seekg(pos->second);
+  if(!std::getline(in,line) || !IsConfigLine(line)) return kFALSE;
+  header=line.substr(7);
+  return kTRUE;
+}
+
+//--------------------------------------------------------------------------
+Bool_t AliHFTableFile::NextLine(std::istream &in, std::string &line) {
+  //
+  /// Read the next line which is neither empty nor a comment
+  //
+  while(std::getline(in,line)){
+    size_t first=line.find_first_not_of(" \t\r");
+    if(first==std::string::npos || line[first]=='#') continue;
+    return kTRUE;
+  }
+  return kFALSE;
+}
+
+//--------------------------------------------------------------------------
+Bool_t AliHFTableFile::ReadValues(std::istream &in, std::vector<Double_t> &values) {
+  //
+  /// Append the numbers of in to values, "v*n" stands for n times v
+  //
+  std::string token;
+  while(in >> token){
+    char *end=0;
+    Double_t val=strtod(token.c_str(),&end);
+    if(end==token.c_str()) return kFALSE;
+    Int_t n=1;
+    if(*end=='*') n=atoi(end+1);
+    else if(*end!='\0') return kFALSE;
+    values.insert(values.end(),n,val);
+  }
+  return kTRUE;
+}
+
+//--------------------------------------------------------------------------
+std::string AliHFTableFile::FormatFloat(Float_t val) {
+  //
+  /// Shortest %g representation which reads back to val
+  //
+  if(val==0) return "0";
+  char buf[32];
+  for(Int_t prec=1; prec<=9; prec++){
+    snprintf(buf,sizeof(buf),"%.*g",prec,val);
+    if((Float_t)atof(buf)==val) break;
+  }
+  return buf;
+}
+
+//--------------------------------------------------------------------------
+std::string AliHFTableFile::FormatDouble(Double_t val) {
+  //
+  /// Shortest representation which reads back to val, in fixed notation
+  /// for exponents between -4 and 15 and in scientific notation otherwise
+  //
+  if(val==0) return "0";
+  char buf[64];
+  Int_t prec=1;
+  for(; prec<17; prec++){
+    snprintf(buf,sizeof(buf),"%.*e",prec-1,val);
+    if(atof(buf)==val) break;
+  }
+  snprintf(buf,sizeof(buf),"%.*e",prec-1,val);
+  Int_t exponent=atoi(strchr(buf,'e')+1);
+  if(exponent<-4 || exponent>=16) return buf;
+  snprintf(buf,sizeof(buf),"%.*f",prec-1-exponent>0 ? prec-1-exponent : 0,val);
+  return buf;
+}
+
+//--------------------------------------------------------------------------
+std::string AliHFTableFile::JoinValues(const std::vector<std::string> &values) {
+  //
+  /// Values separated by blanks, "v*n" for n equal consecutive values v
+  //
+  std::string out;
+  for(size_t i=0; i<values.size();){
+    size_t j=i;
+    while(j<values.size() && values[j]==values[i]) j++;
+    if(i) out+=" ";
+    out+=values[i];
+    if(j-i>1){
+      char count[16];
+      snprintf(count,sizeof(count),"*%d",(Int_t)(j-i));
+      out+=count;
+    }
+    i=j;
+  }
+  return out;
+}
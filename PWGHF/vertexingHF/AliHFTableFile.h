@@ -0,0 +1,55 @@
+#ifndef ALIHFTABLEFILE_H
+#define ALIHFTABLEFILE_H
+/* Copyright(c) 1998-2019, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//***********************************************************
+/// \class AliHFTableFile
+/// \brief Text file of configurations, each starting with a line
+/// "config <key> ...", indexed once so that one configuration is read
+/// without parsing the whole file. Empty lines and lines starting with
+/// '#' are skipped. Used for the uncertainty tables of AliHFSystErr and
+/// AliHFDhadronCorrSystUnc.
+//***********************************************************
+
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <TString.h>
+
+class AliHFTableFile
+{
+ public:
+
+  AliHFTableFile(const char* fileName);
+
+  /// Set another file, the index is rebuilt at the next OpenConfig
+  void SetFileName(const char* fileName);
+  const char* GetFileName() const {return fFileName.Data();}
+
+  /// Open the file positioned after the line of configuration key, the
+  /// rest of that line is returned in header; kFALSE if the file cannot
+  /// be opened or has no such configuration
+  Bool_t OpenConfig(const char* key, std::ifstream &in, std::string &header);
+
+  /// Next line which is neither empty nor a comment
+  static Bool_t NextLine(std::istream &in, std::string &line);
+  /// Line starting a configuration
+  static Bool_t IsConfigLine(const std::string &line) {return !line.compare(0,7,"config ");}
+  /// Append the values of in, "v*n" stands for n times v; kFALSE if a token is not a number
+  static Bool_t ReadValues(std::istream &in, std::vector<Double_t> &values);
+  /// Shortest text which reads back to the same float or double
+  static std::string FormatFloat(Float_t val);
+  static std::string FormatDouble(Double_t val);
+  /// Values separated by blanks, "v*n" for n equal consecutive values
+  static std::string JoinValues(const std::vector<std::string> &values);
+
+ private:
+
+  TString fFileName;    ///< file name, may contain environment variables
+  Bool_t fIndexed;      ///< configurations of the file are indexed
+  std::unordered_map<std::string,std::streamoff> fIndex; ///< configuration -> offset of its line
+};
+
+#endif
@@ -50,6 +50,10 @@ ClassImp(AliNormalizationCounter);
 AliNormalizationCounter::AliNormalizationCounter(): 
 TNamed(),
 fCounters(),
+fFastCounters(),
+fRubricMult(-1),
+fRubricSphero(-1),
+fRubricRun(-1),
 fESD(kFALSE),
 fMultiplicity(kFALSE),
 fMultiplicityEtaRange(1.0),
@@ -70,6 +74,10 @@ fHistRecoVertexZ(0)
 AliNormalizationCounter::AliNormalizationCounter(const char *name): 
 TNamed(name,name),
 fCounters(name),
+fFastCounters(name),
+fRubricMult(-1),
+fRubricSphero(-1),
+fRubricRun(-1),
 fESD(kFALSE),
 fMultiplicity(kFALSE),
 fMultiplicityEtaRange(1.0),
@@ -115,11 +123,22 @@ AliNormalizationCounter::~AliNormalizationCounter()
 void AliNormalizationCounter::Init()
 {
   //variables initialization
-  fCounters.AddRubric("Event","triggered/V0AND/PileUp/PbPbC0SMH-B-NOPF-ALLNOTRD/Candles0.3/PrimaryV/countForNorm/noPrimaryV/zvtxGT10/!V0A&Candle03/!V0A&PrimaryV/Candid(Filter)/Candid(Analysis)/NCandid(Filter)/NCandid(Analysis)");
-  if(fMultiplicity)  fCounters.AddRubric("Multiplicity", 5000);
-  if(fSpherocity)  fCounters.AddRubric("Spherocity", (Int_t)fSpherocitySteps+1);
+  // keys of the Event rubric must follow the order of EEventKey
+  TString eventKeys="triggered/V0AND/PileUp/PbPbC0SMH-B-NOPF-ALLNOTRD/Candles0.3/PrimaryV/countForNorm/noPrimaryV/zvtxGT10/!V0A&Candle03/!V0A&PrimaryV/Candid(Filter)/Candid(Analysis)/NCandid(Filter)/NCandid(Analysis)";
+  fCounters.AddRubric("Event",eventKeys);
+  fFastCounters.AddRubric("Event",eventKeys);
+  if(fMultiplicity){
+    fCounters.AddRubric("Multiplicity", 5000);
+    fRubricMult=fFastCounters.AddRubric("Multiplicity", 5000);
+  }
+  if(fSpherocity){
+    fCounters.AddRubric("Spherocity", (Int_t)fSpherocitySteps+1);
+    fRubricSphero=fFastCounters.AddRubric("Spherocity", (Int_t)fSpherocitySteps+1);
+  }
   fCounters.AddRubric("Run", 1000000);
+  fRubricRun=fFastCounters.AddRubric("Run", 1000000);
   fCounters.Init();
+  fFastCounters.Init();
   fHistTrackFilterEvMult=new TH2F("FiltCandidvsTracksinEv","FiltCandidvsTracksinEv",10000,-0.5,9999.5,200,-0.5,199.5);
   fHistTrackFilterEvMult->GetYaxis()->SetTitle("NCandidates");
   fHistTrackFilterEvMult->GetXaxis()->SetTitle("NTracksinEvent");
@@ -162,6 +181,7 @@ Long64_t AliNormalizationCounter::Merge(TCollection* list){
 //_______________________________________
 void AliNormalizationCounter::Add(const AliNormalizationCounter *norm){
   fCounters.Add(&(norm->fCounters));
+  fFastCounters.Add(&(norm->fFastCounters));
   fHistTrackFilterEvMult->Add(norm->fHistTrackFilterEvMult);
   fHistTrackAnaEvMult->Add(norm->fHistTrackAnaEvMult);
   fHistTrackFilterSpdMult->Add(norm->fHistTrackFilterSpdMult);
@@ -202,7 +222,7 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   //event must be either physics or MC
   if(!(event->GetEventType() == 7||event->GetEventType() == 0))return;
   
-  FillCounters("triggered",runNumber,multiplicity,spherocity);
+  FillCounters(kTriggered,runNumber,multiplicity,spherocity);
 
   //Find V0AND
   AliTriggerAnalysis trAn; /// Trigger Analysis
@@ -213,7 +233,7 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
     v0B = trAn.IsOfflineTriggerFired(eventESD , AliTriggerAnalysis::kV0C);
     v0A = trAn.IsOfflineTriggerFired(eventESD , AliTriggerAnalysis::kV0A);
   }
-  if(v0A&&v0B) FillCounters("V0AND",runNumber,multiplicity,spherocity);
+  if(v0A&&v0B) FillCounters(kV0AND,runNumber,multiplicity,spherocity);
   
   //FindPrimary vertex  
   // AliVVertex *vtrc =  (AliVVertex*)event->GetPrimaryVertex();
@@ -226,30 +246,30 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   AliAODEvent *eventAOD = (AliAODEvent*)event;
   TString trigclass=eventAOD->GetFiredTriggerClasses();
   if(trigclass.Contains("C0SMH-B-NOPF-ALLNOTRD")||trigclass.Contains("C0SMH-B-NOPF-ALL")){
-    FillCounters("PbPbC0SMH-B-NOPF-ALLNOTRD",runNumber,multiplicity,spherocity);
+    FillCounters(kPbPbC0SMH,runNumber,multiplicity,spherocity);
   }
 
   //FindPrimary vertex  
   if(isEventSelected){
-    FillCounters("PrimaryV",runNumber,multiplicity,spherocity);
+    FillCounters(kPrimaryV,runNumber,multiplicity,spherocity);
     flagPV=kTRUE;
   }else{
     if(rdCut->GetWhyRejection()==0){
-      FillCounters("noPrimaryV",runNumber,multiplicity,spherocity);
+      FillCounters(kNoPrimaryV,runNumber,multiplicity,spherocity);
     }
     //find good vtx outside range
     if(rdCut->GetWhyRejection()==6){
-      FillCounters("zvtxGT10",runNumber,multiplicity,spherocity);
-      FillCounters("PrimaryV",runNumber,multiplicity,spherocity);
+      FillCounters(kZvtxGT10,runNumber,multiplicity,spherocity);
+      FillCounters(kPrimaryV,runNumber,multiplicity,spherocity);
       flagPV=kTRUE;
     }
     if(rdCut->GetWhyRejection()==1){
-      FillCounters("PileUp",runNumber,multiplicity,spherocity);
+      FillCounters(kPileUp,runNumber,multiplicity,spherocity);
     }
   }
   //to be counted for normalization
   if(rdCut->CountEventForNormalization()){
-    FillCounters("countForNorm",runNumber,multiplicity,spherocity);
+    FillCounters(kCountForNorm,runNumber,multiplicity,spherocity);
   }
   // fill histograms of vertex position
   if(mc){
@@ -270,17 +290,17 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   for(Int_t i=0;i<trkEntries&&!flag03;i++){
     AliAODTrack *track=(AliAODTrack*)event->GetTrack(i);
     if((track->Pt()>0.3)&&(!flag03)){
-      FillCounters("Candles0.3",runNumber,multiplicity,spherocity);
+      FillCounters(kCandles03,runNumber,multiplicity,spherocity);
       flag03=kTRUE;
       break;
     }
   }
   
   if(!(v0A&&v0B)&&(flag03)){ 
-    FillCounters("!V0A&Candle03",runNumber,multiplicity,spherocity);
+    FillCounters(kNotV0ACandle03,runNumber,multiplicity,spherocity);
   }
   if(!(v0A&&v0B)&&flagPV){
-    FillCounters("!V0A&PrimaryV",runNumber,multiplicity,spherocity);
+    FillCounters(kNotV0APrimaryV,runNumber,multiplicity,spherocity);
   }
   
   return;
@@ -308,33 +328,16 @@ void AliNormalizationCounter::StoreCandidates(AliVEvent *event,Int_t nCand,Bool_
   Int_t runNumber = event->GetRunNumber();
   Int_t multiplicity = Multiplicity(event);
   if(nCand==0)return;
-  if(flagFilter){
-    if(fMultiplicity) 
-      fCounters.Count(Form("Event:Candid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-    else 
-      fCounters.Count(Form("Event:Candid(Filter)/Run:%d",runNumber));
-    for(Int_t i=0;i<nCand;i++){ 
-      if(fMultiplicity) 
-	fCounters.Count(Form("Event:NCandid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-      else 
-	fCounters.Count(Form("Event:NCandid(Filter)/Run:%d",runNumber));
-    }
-  }else{
-    if(fMultiplicity) 
-      fCounters.Count(Form("Event:Candid(Analysis)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-    else
-      fCounters.Count(Form("Event:Candid(Analysis)/Run:%d",runNumber));
-    for(Int_t i=0;i<nCand;i++){ 
-      if(fMultiplicity) 
-	fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-      else
-	fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d",runNumber));
-    }
-  }
+  Int_t keyCand = flagFilter ? kCandidFilter : kCandidAnalysis;
+  Int_t keyNCand = flagFilter ? kNCandidFilter : kNCandidAnalysis;
+  // no spherocity is known here, with the spherocity rubric the candidates go to Spherocity:0
+  FillCounters(keyCand,runNumber,multiplicity,0.);
+  FillCounters(keyNCand,runNumber,multiplicity,0.,(Double_t)nCand);
   return;
 }
 //_______________________________________________________________________
 TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
+  SyncCounters();
   //
   fCounters.SortRubric("Run");
   TString selection;
@@ -347,6 +350,7 @@ TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
 }
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
+  SyncCounters();
   //
   fCounters.SortRubric("Run");
   TString name;
@@ -365,10 +369,12 @@ TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
 }
 //___________________________________________________________________________
 void AliNormalizationCounter::PrintRubrics(){
+  SyncCounters();
   fCounters.PrintKeyWords();
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetSum(TString candle){
+  SyncCounters();
   TString selection="event:";
   selection.Append(candle);
   return fCounters.GetSum(selection.Data());
@@ -400,6 +406,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(){
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t runnumber){
+  SyncCounters();
   TString listofruns = fCounters.GetKeyWords("RUN");
   if(!listofruns.Contains(Form("%d",runnumber))){
     printf("WARNING: %d is not a valid run number\n",runnumber);
@@ -417,6 +424,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t runnumber){
 
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t maxmultiplicity){
+  SyncCounters();
 
   if(!fMultiplicity) {
     AliInfo("Sorry, you didn't activate the multiplicity in the counter!");
@@ -448,6 +456,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t maxmultiplicity, Double_t minspherocity, Double_t maxspherocity){
+  SyncCounters();
 
   if(!fMultiplicity || !fSpherocity) {
     AliInfo("You must activate both multiplicity and spherocity in the counters to use this method!");
@@ -489,6 +498,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
 
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNormSpheroOnly(Double_t minspherocity, Double_t maxspherocity){
+  SyncCounters();
 
   if(!fSpherocity) {
     AliInfo("Sorry, you didn't activate the sphericity in the counter!");
@@ -524,6 +534,7 @@ Double_t AliNormalizationCounter::GetNEventsForNormSpheroOnly(Double_t minsphero
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, Int_t maxmultiplicity){
+  SyncCounters();
   // counts events of given type in a given multiplicity range
 
   if(!fMultiplicity) {
@@ -548,6 +559,7 @@ Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, I
 
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawNEventsForNorm(Bool_t drawRatio){
+  SyncCounters();
   //usare algebra histos
   fCounters.SortRubric("Run");
   TString selection;
@@ -603,17 +615,27 @@ Int_t AliNormalizationCounter::Multiplicity(AliVEvent* event){
 }
 
 //___________________________________________________________________________
-void AliNormalizationCounter::FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity){
-
-
-  Int_t sphToInteger=spherocity*fSpherocitySteps;
-  if(fMultiplicity  && !fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d",name.Data(),runNumber,multiplicity));
-  else if(fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d/Spherocity:%d",name.Data(),runNumber,multiplicity,sphToInteger));
-  else if(!fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Spherocity:%d",name.Data(),runNumber,sphToInteger));
-  else 
-    fCounters.Count(Form("Event:%s/Run:%d",name.Data(),runNumber));
+void AliNormalizationCounter::FillCounters(Int_t eventKey, Int_t runNumber, Int_t multiplicity, Double_t spherocity, Double_t value){
+  // count in the fast counter through the key indices, no string formatting per event
+
+  Int_t keys[4];
+  keys[0]=eventKey;
+  if(fMultiplicity) keys[fRubricMult]=fFastCounters.GetKeyIndex(fRubricMult,multiplicity);
+  if(fSpherocity){
+    Int_t sphToInteger=spherocity*fSpherocitySteps;
+    keys[fRubricSphero]=fFastCounters.GetKeyIndex(fRubricSphero,sphToInteger);
+  }
+  keys[fRubricRun]=fFastCounters.GetKeyIndex(fRubricRun,runNumber);
+  fFastCounters.Count(keys,value);
+  return;
+}
+
+//___________________________________________________________________________
+void AliNormalizationCounter::SyncCounters(){
+  // move the content of the fast counter to the AliCounterCollection
+  // (called before any access to fCounters)
+
+  if(fFastCounters.IsEmpty()) return;
+  if(fFastCounters.ExportTo(fCounters)) fFastCounters.Reset();
   return;
 }
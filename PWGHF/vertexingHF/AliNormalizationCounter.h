@@ -40,6 +40,7 @@
 #include <AliVParticle.h>
 #include "AliAnalysisTaskSE.h"
 #include "AliCounterCollection.h"
+#include "AliHFEventCounter.h"
 #include "AliAnalysisDataSlot.h"
 #include "AliAnalysisDataContainer.h"
 #include "AliRDHFCuts.h"
@@ -54,7 +55,7 @@ class AliNormalizationCounter : public TNamed
   virtual ~AliNormalizationCounter();
   Long64_t Merge(TCollection* list);
 
-  AliCounterCollection* GetCounter(){return &fCounters;}
+  AliCounterCollection* GetCounter(){SyncCounters(); return &fCounters;}
   void Init();
   void Add(const AliNormalizationCounter*);
   void SetESD(Bool_t flag){fESD=flag;}
@@ -62,6 +63,9 @@ class AliNormalizationCounter : public TNamed
   void SetStudySpherocity(Bool_t flag, Double_t nsteps=100.){fSpherocity=flag;
     fSpherocitySteps=nsteps;}
   void StoreEvent(AliVEvent*,AliRDHFCuts *,Bool_t mc=kFALSE, Int_t multiplicity=-9999, Double_t spherocity=-99.);
+  /// With SetStudySpherocity the candidates are counted in the Spherocity:0 bin, since no
+  /// spherocity is passed here (the string keys used before did not give the Spherocity
+  /// rubric, which AliCounterCollection rejects, so no candidates were counted then)
   void StoreCandidates(AliVEvent*, Int_t nCand=0,Bool_t flagFilter=kTRUE);
   TH1D* DrawAgainstRuns(TString candle="candid(filter)",Bool_t drawHist=kTRUE);
   TH1D* DrawRatio(TString candle1="candid(filter)",TString candle2="triggered");
@@ -82,15 +86,25 @@ class AliNormalizationCounter : public TNamed
   TH1F* GetHistoGenVertexZ() const { return fHistGenVertexZ;}
   TH1F* GetHistoGenVertexZRecoPV() const { return fHistGenVertexZRecoPV;}
   TH1F* GetHistoRecoVertexZ() const { return fHistRecoVertexZ;}
+  void SyncCounters();
+
+  /// keys of the "Event" rubric, same order as in Init()
+  enum EEventKey {kTriggered, kV0AND, kPileUp, kPbPbC0SMH, kCandles03, kPrimaryV, kCountForNorm,
+                  kNoPrimaryV, kZvtxGT10, kNotV0ACandle03, kNotV0APrimaryV, kCandidFilter,
+                  kCandidAnalysis, kNCandidFilter, kNCandidAnalysis, kNEventKeys};
 
  private:
   AliNormalizationCounter(const AliNormalizationCounter &source);
   AliNormalizationCounter& operator=(const AliNormalizationCounter& source);
   Int_t Multiplicity(AliVEvent* event);
-  void FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity);
+  void FillCounters(Int_t eventKey, Int_t runNumber, Int_t multiplicity, Double_t spherocity, Double_t value=1.);
 
 
   AliCounterCollection fCounters; /// internal counter
+  AliHFEventCounter fFastCounters; /// counter filled in the event loop, moved to fCounters by SyncCounters
+  Int_t fRubricMult;   /// index of multiplicity rubric in fFastCounters (-1 if not used)
+  Int_t fRubricSphero; /// index of spherocity rubric in fFastCounters (-1 if not used)
+  Int_t fRubricRun;    /// index of run rubric in fFastCounters
   Bool_t fESD; /// flag for ESD vs AOD
   Bool_t fMultiplicity; /// flag for multiplicity
   Float_t fMultiplicityEtaRange;
@@ -105,7 +119,7 @@ class AliNormalizationCounter : public TNamed
   TH1F *fHistRecoVertexZ;      /// histo of reconstructed z vertex
 
   /// \cond CLASSIMP    
-  ClassDef(AliNormalizationCounter,8);
+  ClassDef(AliNormalizationCounter,9);
   /// \endcond
 };
 #endif
@@ -47,6 +47,7 @@
 #include <AliEmcalJet.h>
 #include <AliRhoParameter.h>
 #include <AliLocalRhoParameter.h>
+#include <AliRhoModulationFit.h>
 #include <AliAnalysisTaskLocalRho.h>
 #include "AliMultSelection.h"
 
@@ -65,7 +66,7 @@ AliAnalysisTaskLocalRho::AliAnalysisTaskLocalRho() :
   fFitModulationOptions("WLQI"), fRunModeType(kGrid), fFitModulation(0), fMinPvalue(0.01), fMaxPvalue(1), 
   fLocalJetMinEta(-10), fLocalJetMaxEta(-10), fLocalJetMinPhi(-10), fLocalJetMaxPhi(-10), fSoftTrackMinPt(0.15), 
   fSoftTrackMaxPt(5.), fHistPvalueCDF(0), fHistRhoStatusCent(0), fAbsVnHarmonics(kTRUE), fExcludeLeadingJetsFromFit(1.), 
-  fRebinSwapHistoOnTheFly(kTRUE), fPercentageOfFits(10.), fUseV0EventPlaneFromHeader(kTRUE), fOutputList(0), 
+  fRebinSwapHistoOnTheFly(kTRUE), fPercentageOfFits(10.), fUseLinearModulationFit(kFALSE), fUseV0EventPlaneFromHeader(kTRUE), fOutputList(0), 
   fOutputListGood(0), fOutputListBad(0), fHistSwap(0), fHistAnalysisSummary(0), fProfV2(0), fProfV2Cumulant(0), 
   fProfV3(0), fProfV3Cumulant(0) 
 {
@@ -87,7 +88,7 @@ AliAnalysisTaskLocalRho::AliAnalysisTaskLocalRho(const char* name, runModeType t
   fFitModulationOptions("WLQI"), fRunModeType(type), fFitModulation(0), fMinPvalue(0.01), fMaxPvalue(1), 
   fLocalJetMinEta(-10), fLocalJetMaxEta(-10), fLocalJetMinPhi(-10), fLocalJetMaxPhi(-10), fSoftTrackMinPt(0.15), 
   fSoftTrackMaxPt(5.), fHistPvalueCDF(0), fHistRhoStatusCent(0), fAbsVnHarmonics(kTRUE), fExcludeLeadingJetsFromFit(1.), 
-  fRebinSwapHistoOnTheFly(kTRUE), fPercentageOfFits(10.), fUseV0EventPlaneFromHeader(kTRUE), fOutputList(0), 
+  fRebinSwapHistoOnTheFly(kTRUE), fPercentageOfFits(10.), fUseLinearModulationFit(kFALSE), fUseV0EventPlaneFromHeader(kTRUE), fOutputList(0), 
   fOutputListGood(0), fOutputListBad(0), fHistSwap(0), fHistAnalysisSummary(0), fProfV2(0), fProfV2Cumulant(0), 
   fProfV3(0), fProfV3Cumulant(0) 
 {
@@ -931,7 +932,20 @@ Bool_t AliAnalysisTaskLocalRho::CorrectRho(Double_t psi2, Double_t psi3)
   } break;
   default : break;
   }
-  _tempSwap.Fit(fFitModulation, fFitModulationOptions.Data(), "", 0, TMath::TwoPi());
+  // with the event plane angles fixed, the modulation is linear in its free parameters and the
+  // chi2 minimum can be obtained in closed form, without minimizer. other fit types use TH1::Fit
+  Bool_t linearFit(kFALSE);
+  if(fUseLinearModulationFit) {
+    Bool_t unitWeights(AliRhoModulationFit::UnitWeights(fFitModulationOptions.Data()));
+    switch (fFitModulationType) {
+    case kNoFit : linearFit = AliRhoModulationFit::Fit(_tempSwap, fFitModulation, 0, 0, TMath::TwoPi(), unitWeights); break;
+    case kV2 :
+    case kV3 : linearFit = AliRhoModulationFit::Fit(_tempSwap, fFitModulation, 1, 0, TMath::TwoPi(), unitWeights); break;
+    case kCombined : linearFit = AliRhoModulationFit::Fit(_tempSwap, fFitModulation, 2, 0, TMath::TwoPi(), unitWeights); break;
+    default : break;
+    }
+  }
+  if(!linearFit) _tempSwap.Fit(fFitModulation, fFitModulationOptions.Data(), "", 0, TMath::TwoPi());
   // the quality of the fit is evaluated from 1 - the cdf of the chi square distribution
   Double_t CDF(1.-ChiSquareCDF(fFitModulation->GetNDF(), fFitModulation->GetChisquare()));
   if(fFillHistograms) fHistPvalueCDF->Fill(CDF);
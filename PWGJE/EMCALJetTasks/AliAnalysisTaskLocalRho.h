@@ -122,6 +122,7 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   void                    SetExcludeLeadingJetsFromFit(Float_t n)         {fExcludeLeadingJetsFromFit = n; }
   void                    SetRebinSwapHistoOnTheFly(Bool_t r)             {fRebinSwapHistoOnTheFly = r; }
   void                    SetSaveThisPercentageOfFits(Float_t p)          {fPercentageOfFits = p; }
+  void                    SetUseLinearModulationFit(Bool_t l)             {fUseLinearModulationFit = l; }
   void                    SetUseV0EventPlaneFromHeader(Bool_t h)          {fUseV0EventPlaneFromHeader = h;}
   void                    SetSoftTrackMinMaxPt(Float_t min, Float_t max)  {fSoftTrackMinPt = min; fSoftTrackMaxPt = max;}
   // getters
@@ -187,6 +188,7 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   Float_t                 fExcludeLeadingJetsFromFit;     ///< exclude n leading jets from fit
   Bool_t                  fRebinSwapHistoOnTheFly;        ///< rebin swap histo on the fly
   Float_t                 fPercentageOfFits;              ///< save this percentage of fits
+  Bool_t                  fUseLinearModulationFit;        ///< closed form least squares estimate of the modulation instead of TH1::Fit
   Bool_t                  fUseV0EventPlaneFromHeader;     ///< use the vzero event plane from the header
   // transient object pointers
   TList*                  fOutputList;            //!<! output list
@@ -204,6 +206,6 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   AliAnalysisTaskLocalRho(const AliAnalysisTaskLocalRho&);                  // not implemented
   AliAnalysisTaskLocalRho& operator=(const AliAnalysisTaskLocalRho&);       // not implemented
 
-  ClassDef(AliAnalysisTaskLocalRho, 6);
+  ClassDef(AliAnalysisTaskLocalRho, 7);
 };
 #endif
@@ -0,0 +1,312 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <TMath.h>
+
+#include "AliEmcalFastConstituentSubtractor.h"
+
+//______________________________________________________________________________
+AliEmcalFastConstituentSubtractor::AliEmcalFastConstituentSubtractor() :
+  fRho(0),
+  fRhom(0),
+  fAlpha(),
+  fMaxDelR(),
+  fGridMaxRap(0),
+  fGridGhostArea(0),
+  fIndexValid(kFALSE),
+  fGhosts(),
+  fGhostAreas(),
+  fGhostIndex(),
+  fSubtracted(),
+  fParticleIndex()
+{
+  // Default constructor.
+}
+
+//______________________________________________________________________________
+void AliEmcalFastConstituentSubtractor::SetGhostGrid(Double_t maxRap, Double_t ghostArea)
+{
+  // Build the regular ghost grid covering |y| < maxRap, with a ghost area as close as
+  // possible to ghostArea (same placement as the fastjet GhostedAreaSpec, without scatter).
+  // The grid is kept if the parameters did not change.
+
+  if (!fGhosts.empty() && maxRap == fGridMaxRap && ghostArea == fGridGhostArea) return;
+
+  fGridMaxRap = maxRap;
+  fGridGhostArea = ghostArea;
+  fGhosts.clear();
+  fGhostAreas.clear();
+  fIndexValid = kFALSE;
+
+  if (maxRap <= 0 || ghostArea <= 0) return;
+
+  Double_t size = TMath::Sqrt(ghostArea);
+  Int_t nRap = TMath::Max(1, TMath::CeilNint(2 * maxRap / size));
+  Int_t nPhi = TMath::Max(1, TMath::CeilNint(TMath::TwoPi() / size));
+  Double_t dRap = 2 * maxRap / nRap;
+  Double_t dPhi = TMath::TwoPi() / nPhi;
+
+  fGhosts.reserve(nRap * nPhi);
+  for (Int_t iRap = 0; iRap < nRap; iRap++) {
+    Double_t rap = -maxRap + (iRap + 0.5) * dRap;
+    for (Int_t iPhi = 0; iPhi < nPhi; iPhi++) {
+      fGhosts.push_back(fastjet::PseudoJet::PtYPhiM(1e-100, rap, (iPhi + 0.5) * dPhi, 0));
+      fGhosts.back().set_user_index(-1);
+    }
+  }
+  fGhostAreas.assign(fGhosts.size(), dRap * dPhi);
+}
+
+//______________________________________________________________________________
+void AliEmcalFastConstituentSubtractor::SubtractEvent(const std::vector<fastjet::PseudoJet>& particles)
+{
+  // Subtract all the particles of the event with the ghost grid, for all the settings.
+
+  if (!fIndexValid) {
+    fGhostIndex.Build(fGhosts, GetCellSize());
+    fIndexValid = kTRUE;
+  }
+
+  SubtractWithIndex(particles, fGhosts, fGhostAreas, fGhostIndex, fSubtracted);
+
+  fParticleIndex.clear();
+  for (UInt_t i = 0; i < particles.size(); i++) fParticleIndex.insert(std::make_pair(particles[i].user_index(), i));
+}
+
+//______________________________________________________________________________
+fastjet::PseudoJet AliEmcalFastConstituentSubtractor::GetSubtractedJet(const std::vector<fastjet::PseudoJet>& constituents, Int_t isetting) const
+{
+  // Subtracted jet made of the subtracted particles of the event matching the constituents
+  // of an unsubtracted jet (by user index). Ghosts and fully subtracted particles are dropped.
+
+  std::vector<fastjet::PseudoJet> subtracted;
+  for (UInt_t ic = 0; ic < constituents.size(); ic++) {
+    std::unordered_map<Int_t, Int_t>::const_iterator it = fParticleIndex.find(constituents[ic].user_index());
+    if (it == fParticleIndex.end()) continue;
+    const fastjet::PseudoJet& particle = fSubtracted[isetting][it->second];
+    if (particle.perp() > 0) subtracted.push_back(particle);
+  }
+
+  if (subtracted.empty()) return fastjet::PseudoJet(0., 0., 0., 0.);
+  return fastjet::join(subtracted);
+}
+
+//______________________________________________________________________________
+void AliEmcalFastConstituentSubtractor::Subtract(const std::vector<fastjet::PseudoJet>& particles, const std::vector<fastjet::PseudoJet>& ghosts,
+                                                 const std::vector<Double_t>& ghostAreas, std::vector<std::vector<fastjet::PseudoJet> >& subtracted) const
+{
+  // Subtract the particles with the given ghosts, for all the settings.
+  // The output has one entry per particle, in the input order, with zero momentum when fully subtracted.
+
+  GhostIndex_t index;
+  index.Build(ghosts, GetCellSize());
+  SubtractWithIndex(particles, ghosts, ghostAreas, index, subtracted);
+}
+
+//______________________________________________________________________________
+Double_t AliEmcalFastConstituentSubtractor::GetCellSize() const
+{
+  // Cell size of the ghost index: the largest DeltaR_max of the settings,
+  // or no index if none is limited.
+
+  Double_t cellSize = -1;
+  for (UInt_t i = 0; i < fMaxDelR.size(); i++) {
+    if (fMaxDelR[i] > cellSize) cellSize = fMaxDelR[i];
+  }
+  if (cellSize > 0 && cellSize < 0.01) cellSize = 0.01;
+  return cellSize;
+}
+
+//______________________________________________________________________________
+void AliEmcalFastConstituentSubtractor::SubtractWithIndex(const std::vector<fastjet::PseudoJet>& particles, const std::vector<fastjet::PseudoJet>& ghosts,
+                                                          const std::vector<Double_t>& ghostAreas, const GhostIndex_t& index,
+                                                          std::vector<std::vector<fastjet::PseudoJet> >& subtracted) const
+{
+  // Run the subtraction for all the settings. The pairs are found and sorted once for each alpha;
+  // the settings sharing it are processed by increasing DeltaR_max, the result of each one being
+  // taken when the sorted pairs pass its DeltaR_max.
+
+  const Double_t kUnlimited = std::numeric_limits<Double_t>::infinity();
+  Int_t nSettings = fAlpha.size();
+  subtracted.assign(nSettings, std::vector<fastjet::PseudoJet>());
+  if (particles.empty()) return;
+
+  std::vector<Bool_t> done(nSettings, kFALSE);
+  std::vector<Pair_t> pairs;
+  std::vector<Double_t> particlePt(particles.size()), particleMtMinusPt(particles.size());
+  std::vector<Double_t> ghostPt(ghosts.size()), ghostMtMinusPt(ghosts.size());
+
+  for (Int_t is0 = 0; is0 < nSettings; is0++) {
+    if (done[is0]) continue;
+
+    // Settings with the same alpha, by increasing DeltaR_max
+    std::vector<std::pair<Double_t, Int_t> > group;
+    for (Int_t is = is0; is < nSettings; is++) {
+      if (done[is] || fAlpha[is] != fAlpha[is0]) continue;
+      group.push_back(std::make_pair(fMaxDelR[is] > 0 ? fMaxDelR[is] : kUnlimited, is));
+      done[is] = kTRUE;
+    }
+    std::sort(group.begin(), group.end());
+
+    Double_t maxDelR = group.back().first;
+    FindPairs(particles, ghosts, index, fAlpha[is0], maxDelR < kUnlimited ? maxDelR : -1, pairs);
+    std::sort(pairs.begin(), pairs.end());
+
+    for (UInt_t i = 0; i < particles.size(); i++) {
+      particlePt[i] = particles[i].pt();
+      particleMtMinusPt[i] = particles[i].mt() - particles[i].pt();
+    }
+    for (UInt_t j = 0; j < ghosts.size(); j++) {
+      ghostPt[j] = fRho * ghostAreas[j];
+      ghostMtMinusPt[j] = fRhom * ghostAreas[j];
+    }
+
+    UInt_t ipair = 0;
+    for (UInt_t ig = 0; ig < group.size(); ig++) {
+      Double_t maxDistance2 = group[ig].first < kUnlimited ? group[ig].first * group[ig].first : kUnlimited;
+      for (; ipair < pairs.size() && pairs[ipair].fDistance2 <= maxDistance2; ipair++) {
+        Int_t i = pairs[ipair].fParticle;
+        Int_t j = pairs[ipair].fGhost;
+        if (particlePt[i] > 0 && ghostPt[j] > 0) {
+          if (particlePt[i] >= ghostPt[j]) {
+            particlePt[i] -= ghostPt[j];
+            ghostPt[j] = 0;
+          }
+          else {
+            ghostPt[j] -= particlePt[i];
+            particlePt[i] = 0;
+          }
+        }
+        if (particleMtMinusPt[i] > 0 && ghostMtMinusPt[j] > 0) {
+          if (particleMtMinusPt[i] >= ghostMtMinusPt[j]) {
+            particleMtMinusPt[i] -= ghostMtMinusPt[j];
+            ghostMtMinusPt[j] = 0;
+          }
+          else {
+            ghostMtMinusPt[j] -= particleMtMinusPt[i];
+            particleMtMinusPt[i] = 0;
+          }
+        }
+      }
+
+      std::vector<fastjet::PseudoJet>& output = subtracted[group[ig].second];
+      output.reserve(particles.size());
+      for (UInt_t i = 0; i < particles.size(); i++) {
+        fastjet::PseudoJet particle(0., 0., 0., 0.);
+        if (particlePt[i] > 0) {
+          Double_t mt = particlePt[i] + particleMtMinusPt[i];
+          Double_t m2 = mt * mt - particlePt[i] * particlePt[i];
+          particle = fastjet::PseudoJet::PtYPhiM(particlePt[i], particles[i].rap(), particles[i].phi(), m2 > 0 ? TMath::Sqrt(m2) : 0.);
+        }
+        particle.set_user_index(particles[i].user_index());
+        output.push_back(particle);
+      }
+    }
+  }
+}
+
+//______________________________________________________________________________
+void AliEmcalFastConstituentSubtractor::FindPairs(const std::vector<fastjet::PseudoJet>& particles, const std::vector<fastjet::PseudoJet>& ghosts,
+                                                  const GhostIndex_t& index, Double_t alpha, Double_t maxDelR, std::vector<Pair_t>& pairs) const
+{
+  // Find the particle-ghost pairs with pt^(2 alpha) * DeltaR^2 <= DeltaR_max^2, as in the contrib.
+  // With a ghost index, only the ghosts of the cells within DeltaR_max / pt^alpha are tested.
+
+  pairs.clear();
+
+  Bool_t useMaxDelR = maxDelR > 0;
+  Double_t maxDistance2 = maxDelR * maxDelR;
+  Double_t alphaTimesTwo = 2 * alpha;
+  std::vector<Int_t> candidates;
+
+  for (UInt_t i = 0; i < particles.size(); i++) {
+    Double_t ptFactor = 1.;
+    if (TMath::Abs(alphaTimesTwo) > 1e-5) ptFactor = TMath::Power(particles[i].pt(), alphaTimesTwo);
+
+    if (useMaxDelR && index.fCellSize > 0 && ptFactor > 0 && std::isfinite(ptFactor)) {
+      index.FindCandidates(particles[i], TMath::Sqrt(maxDistance2 / ptFactor), candidates);
+      for (UInt_t ic = 0; ic < candidates.size(); ic++) {
+        Int_t j = candidates[ic];
+        Double_t distance2 = ghosts[j].squared_distance(particles[i]) * ptFactor;
+        if (distance2 <= maxDistance2) {
+          Pair_t pair = {distance2, static_cast<Int_t>(i), j};
+          pairs.push_back(pair);
+        }
+      }
+    }
+    else {
+      for (UInt_t j = 0; j < ghosts.size(); j++) {
+        Double_t distance2 = ghosts[j].squared_distance(particles[i]) * ptFactor;
+        if (!useMaxDelR || distance2 <= maxDistance2) {
+          Pair_t pair = {distance2, static_cast<Int_t>(i), static_cast<Int_t>(j)};
+          pairs.push_back(pair);
+        }
+      }
+    }
+  }
+}
+
+//______________________________________________________________________________
+void AliEmcalFastConstituentSubtractor::GhostIndex_t::Build(const std::vector<fastjet::PseudoJet>& ghosts, Double_t cellSize)
+{
+  // Bin the ghosts in (y, phi) cells of size cellSize. The index is left empty
+  // (all ghosts are tested) if cellSize is not positive.
+
+  fCellSize = -1;
+  fCellStart.clear();
+  fCellGhosts.clear();
+  if (ghosts.empty() || cellSize <= 0) return;
+
+  Double_t rapMin = ghosts[0].rap(), rapMax = ghosts[0].rap();
+  for (UInt_t j = 1; j < ghosts.size(); j++) {
+    rapMin = TMath::Min(rapMin, ghosts[j].rap());
+    rapMax = TMath::Max(rapMax, ghosts[j].rap());
+  }
+
+  fCellSize = cellSize;
+  fRapMin = rapMin;
+  fNRap = TMath::Max(1, TMath::CeilNint((rapMax - rapMin) / cellSize));
+  fNPhi = TMath::Max(1, TMath::FloorNint(TMath::TwoPi() / cellSize));
+  fPhiCell = TMath::TwoPi() / fNPhi;
+
+  std::vector<Int_t> cells(ghosts.size());
+  fCellStart.assign(fNRap * fNPhi + 1, 0);
+  for (UInt_t j = 0; j < ghosts.size(); j++) {
+    Int_t iRap = TMath::Min(fNRap - 1, static_cast<Int_t>((ghosts[j].rap() - fRapMin) / fCellSize));
+    Int_t iPhi = TMath::Min(fNPhi - 1, static_cast<Int_t>(ghosts[j].phi() / fPhiCell));
+    cells[j] = iRap * fNPhi + iPhi;
+    fCellStart[cells[j] + 1]++;
+  }
+  for (UInt_t ic = 1; ic < fCellStart.size(); ic++) fCellStart[ic] += fCellStart[ic - 1];
+
+  std::vector<Int_t> fill(fCellStart.begin(), fCellStart.end() - 1);
+  fCellGhosts.resize(ghosts.size());
+  for (UInt_t j = 0; j < ghosts.size(); j++) fCellGhosts[fill[cells[j]]++] = j;
+}
+
+//______________________________________________________________________________
+void AliEmcalFastConstituentSubtractor::GhostIndex_t::FindCandidates(const fastjet::PseudoJet& p, Double_t r, std::vector<Int_t>& candidates) const
+{
+  // Ghosts of the cells overlapping the (y, phi) window of half size r around the particle.
+
+  candidates.clear();
+  r += 1e-9;
+
+  Int_t iRapMin = TMath::Max(0, TMath::FloorNint((p.rap() - r - fRapMin) / fCellSize));
+  Int_t iRapMax = TMath::Min(fNRap - 1, TMath::FloorNint((p.rap() + r - fRapMin) / fCellSize));
+  if (iRapMin > iRapMax) return;
+
+  Int_t iPhiMin = 0, iPhiMax = fNPhi - 1;
+  if (TMath::FloorNint((p.phi() + r) / fPhiCell) - TMath::FloorNint((p.phi() - r) / fPhiCell) + 1 < fNPhi) {
+    iPhiMin = TMath::FloorNint((p.phi() - r) / fPhiCell);
+    iPhiMax = TMath::FloorNint((p.phi() + r) / fPhiCell);
+  }
+
+  for (Int_t iRap = iRapMin; iRap <= iRapMax; iRap++) {
+    for (Int_t k = iPhiMin; k <= iPhiMax; k++) {
+      Int_t cell = iRap * fNPhi + ((k % fNPhi) + fNPhi) % fNPhi;
+      candidates.insert(candidates.end(), fCellGhosts.begin() + fCellStart[cell], fCellGhosts.begin() + fCellStart[cell + 1]);
+    }
+  }
+}
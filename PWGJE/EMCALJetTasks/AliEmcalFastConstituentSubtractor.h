@@ -0,0 +1,107 @@
+#ifndef ALIEMCALFASTCONSTITUENTSUBTRACTOR_H
+#define ALIEMCALFASTCONSTITUENTSUBTRACTOR_H
+
+#include <unordered_map>
+#include <vector>
+
+#include <Rtypes.h>
+
+#include "fastjet/PseudoJet.hh"
+
+/**
+ * @class AliEmcalFastConstituentSubtractor
+ * @brief Event-wide constituent subtraction with a cached ghost grid
+ *
+ * Implements the algorithm of fastjet::contrib::ConstituentSubtractor
+ * with fixed rho and rho_m: particle-ghost pairs with a distance
+ * pt^alpha * DeltaR below DeltaR_max are sorted by distance and the pt
+ * (and mt - pt) of the ghosts, rho * A (and rho_m * A), is subtracted from
+ * the particles pair by pair.
+ *
+ * Instead of running once per jet on the ghosts of the jet, SubtractEvent()
+ * subtracts all particles of the event at once using a regular ghost grid
+ * covering |y| < maxRap, which is only rebuilt when the grid parameters change.
+ * The ghosts are binned in cells of size DeltaR_max, such that each particle
+ * is only paired with the ghosts of the neighbouring cells. Subtracted jets are
+ * then obtained from the constituents of the unsubtracted jets with GetSubtractedJet().
+ *
+ * Several (alpha, DeltaR_max) settings can be subtracted in the same pass: the
+ * pairs are found and sorted once per alpha value, and the result of each DeltaR_max
+ * is taken when the sorted pairs reach it.
+ *
+ * Subtract() runs the same algorithm on any set of particles and ghosts, e.g. the
+ * constituents of one jet, which allows a direct comparison with the contrib.
+ */
+class AliEmcalFastConstituentSubtractor {
+ public:
+  AliEmcalFastConstituentSubtractor();
+  virtual ~AliEmcalFastConstituentSubtractor() {}
+
+  void               SetBackground(Double_t rho, Double_t rhom)              { fRho = rho; fRhom = rhom; }
+  void               SetGhostGrid(Double_t maxRap, Double_t ghostArea);
+  /// Add an (alpha, DeltaR_max) setting, a non-positive DeltaR_max means no limit
+  void               AddSetting(Double_t alpha, Double_t maxDelR)            { fAlpha.push_back(alpha); fMaxDelR.push_back(maxDelR); fIndexValid = kFALSE; }
+  void               ClearSettings()                                         { fAlpha.clear(); fMaxDelR.clear(); fIndexValid = kFALSE; }
+  Int_t              GetNSettings()                                    const { return fAlpha.size(); }
+  Double_t           GetAlpha(Int_t i)                                 const { return fAlpha[i]; }
+  Double_t           GetMaxDelR(Int_t i)                               const { return fMaxDelR[i]; }
+
+  void               SubtractEvent(const std::vector<fastjet::PseudoJet>& particles);
+  fastjet::PseudoJet GetSubtractedJet(const std::vector<fastjet::PseudoJet>& constituents, Int_t isetting) const;
+  /// Subtracted particles of the event, in the input order, with zero momentum when fully subtracted
+  const std::vector<fastjet::PseudoJet>& GetSubtractedParticles(Int_t isetting) const { return fSubtracted[isetting]; }
+  const std::vector<fastjet::PseudoJet>& GetGhosts()                   const { return fGhosts; }
+  /// Area of the ghosts of the grid, close to the requested one
+  Double_t           GetGhostArea()                                    const { return fGhostAreas.empty() ? 0. : fGhostAreas[0]; }
+
+  void               Subtract(const std::vector<fastjet::PseudoJet>& particles, const std::vector<fastjet::PseudoJet>& ghosts,
+                              const std::vector<Double_t>& ghostAreas, std::vector<std::vector<fastjet::PseudoJet> >& subtracted) const;
+
+ protected:
+  /// Particle-ghost pair, ordered by distance
+  struct Pair_t {
+    Double_t fDistance2;   ///< pt^(2 alpha) * DeltaR^2
+    Int_t    fParticle;    ///< particle index
+    Int_t    fGhost;       ///< ghost index
+    bool operator<(const Pair_t& o) const
+    { return fDistance2 != o.fDistance2 ? fDistance2 < o.fDistance2 : (fParticle != o.fParticle ? fParticle < o.fParticle : fGhost < o.fGhost); }
+  };
+
+  /// Ghosts binned in (y, phi) cells
+  struct GhostIndex_t {
+    GhostIndex_t() : fCellSize(-1), fRapMin(0), fNRap(0), fNPhi(0), fPhiCell(0), fCellStart(), fCellGhosts() {}
+    void Build(const std::vector<fastjet::PseudoJet>& ghosts, Double_t cellSize);
+    void FindCandidates(const fastjet::PseudoJet& p, Double_t r, std::vector<Int_t>& candidates) const;
+
+    Double_t            fCellSize;     ///< cell size in rapidity, non-positive if not built
+    Double_t            fRapMin;       ///< lower rapidity edge
+    Int_t               fNRap;         ///< number of rapidity cells
+    Int_t               fNPhi;         ///< number of phi cells
+    Double_t            fPhiCell;      ///< cell size in phi
+    std::vector<Int_t>  fCellStart;    ///< first entry of each cell in fCellGhosts
+    std::vector<Int_t>  fCellGhosts;   ///< ghost indices sorted by cell
+  };
+
+  Double_t           GetCellSize() const;
+  void               SubtractWithIndex(const std::vector<fastjet::PseudoJet>& particles, const std::vector<fastjet::PseudoJet>& ghosts,
+                                       const std::vector<Double_t>& ghostAreas, const GhostIndex_t& index,
+                                       std::vector<std::vector<fastjet::PseudoJet> >& subtracted) const;
+  void               FindPairs(const std::vector<fastjet::PseudoJet>& particles, const std::vector<fastjet::PseudoJet>& ghosts,
+                               const GhostIndex_t& index, Double_t alpha, Double_t maxDelR, std::vector<Pair_t>& pairs) const;
+
+  Double_t                                       fRho;              ///< pt background density
+  Double_t                                       fRhom;             ///< mt background density
+  std::vector<Double_t>                          fAlpha;            ///< pt weight exponent of each setting
+  std::vector<Double_t>                          fMaxDelR;          ///< max particle-ghost distance of each setting
+
+  Double_t                                       fGridMaxRap;       ///< rapidity range of the ghost grid
+  Double_t                                       fGridGhostArea;    ///< requested ghost area of the grid
+  Bool_t                                         fIndexValid;       ///< the ghost index matches the grid and the settings
+  std::vector<fastjet::PseudoJet>                fGhosts;           ///< ghost grid
+  std::vector<Double_t>                          fGhostAreas;       ///< area of each ghost of the grid
+  GhostIndex_t                                   fGhostIndex;       ///< cached index of the ghost grid
+
+  std::vector<std::vector<fastjet::PseudoJet> >  fSubtracted;       ///< subtracted particles of the event, per setting
+  std::unordered_map<Int_t, Int_t>               fParticleIndex;    ///< user index to input position
+};
+#endif
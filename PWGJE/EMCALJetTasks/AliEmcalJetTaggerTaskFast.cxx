@@ -32,12 +32,14 @@
 #include <TH3.h>
 #include <THnSparse.h>
 #include <TKDTree.h>
+#include <TMath.h>
 
 #include "AliAnalysisManager.h"
 #include "AliEmcalJet.h"
 #include "AliLog.h"
 #include "AliJetContainer.h"
 #include "AliParticleContainer.h"
+#include "AliVParticle.h"
 
 #include "AliEmcalJetTaggerTaskFast.h"
 
@@ -62,6 +64,12 @@ namespace PWGJE {
       fTypeAcc(kLimitBaseTagEtaPhi),
       fMaxDist(0.3),
       fInit(kFALSE),
+      fPairContainerBase(),
+      fPairContainerTag(),
+      fPairMaxDist(),
+      fTieBreakTolerance(-1.),
+      fSpatialIndices(),
+      fMatchedJets(),
       fh3PtJet1VsDeltaEtaDeltaPhi(nullptr),
       fh2PtJet1VsDeltaR(nullptr),
       fh2PtJet2VsFraction(nullptr),
@@ -95,6 +103,12 @@ namespace PWGJE {
       fTypeAcc(kLimitBaseTagEtaPhi),
       fMaxDist(0.3),
       fInit(kFALSE),
+      fPairContainerBase(),
+      fPairContainerTag(),
+      fPairMaxDist(),
+      fTieBreakTolerance(-1.),
+      fSpatialIndices(),
+      fMatchedJets(),
       fh3PtJet1VsDeltaEtaDeltaPhi(nullptr),
       fh2PtJet1VsDeltaR(nullptr),
       fh2PtJet2VsFraction(nullptr),
@@ -242,47 +256,94 @@ namespace PWGJE {
 
     if(fInit) return;
 
-    AliJetContainer *cont1 = GetJetContainer(fContainerBase);
-    AliJetContainer *cont2 = GetJetContainer(fContainerTag);
-    if(!cont1 || !cont2) AliError("Missing jet container");
-
-    // when full azimuth, don't do anything
-    Double_t phiMin1 = cont1->GetJetPhiMin(), phiMin2 = cont2->GetJetPhiMin();
-    Bool_t isZeroTwoPi1 = kFALSE;
-    //check only one side of phi, since the upper bound is not well defined
-    if(phiMin1 > -1.e-6 && phiMin1 < 1.e-6) isZeroTwoPi1 = kTRUE;
-    Bool_t isZeroTwoPi2 = kFALSE;
-    if(phiMin2 > -1.e-6 && phiMin2 < 1.e-6) isZeroTwoPi2 = kTRUE;
-
-    switch(fTypeAcc){
-    case kNoLimit: break;
-    case kLimitTagEta:
-      cont2->SetJetEtaLimits(cont2->GetJetEtaMin()-0.1,cont2->GetJetEtaMax()+0.1);
-      break;
-    case kLimitTagEtaPhi:
-      cont2->SetJetEtaLimits(cont2->GetJetEtaMin()-0.1,cont2->GetJetEtaMax()+0.1);
-      if(!isZeroTwoPi2) cont2->SetJetPhiLimits(cont2->GetJetPhiMin()-0.1,cont2->GetJetPhiMax()+0.1);
-      break;
-    case kLimitBaseTagEtaPhi:
-      cont1->SetJetEtaLimits(cont1->GetJetEtaMin()-0.1,cont1->GetJetEtaMax()+0.1);
-      if(!isZeroTwoPi1) cont1->SetJetPhiLimits(cont1->GetJetPhiMin()-0.1,cont1->GetJetPhiMax()+0.1);
-      cont2->SetJetEtaLimits(cont2->GetJetEtaMin()-0.1,cont2->GetJetEtaMax()+0.1);
-      if(!isZeroTwoPi2) cont2->SetJetPhiLimits(cont2->GetJetPhiMin()-0.1,cont2->GetJetPhiMax()+0.1);
-    };
+    // Limits are applied once per container, according to its role in the pairs
+    std::vector<Int_t> roles = GetContainerRoles();
+    for(Int_t icont = 0; icont < static_cast<Int_t>(roles.size()); icont++) {
+      if(!roles[icont]) continue;
+      AliJetContainer *cont = GetJetContainer(icont);
+      if(!cont) {
+        AliError("Missing jet container");
+        continue;
+      }
+      Bool_t isBase = roles[icont] & 1, isTag = roles[icont] & 2;
+
+      // when full azimuth, don't do anything
+      Double_t phiMin = cont->GetJetPhiMin();
+      Bool_t isZeroTwoPi = kFALSE;
+      //check only one side of phi, since the upper bound is not well defined
+      if(phiMin > -1.e-6 && phiMin < 1.e-6) isZeroTwoPi = kTRUE;
+
+      switch(fTypeAcc){
+      case kNoLimit: break;
+      case kLimitTagEta:
+        if(isTag) cont->SetJetEtaLimits(cont->GetJetEtaMin()-0.1,cont->GetJetEtaMax()+0.1);
+        break;
+      case kLimitTagEtaPhi:
+        if(!isTag) break;
+        cont->SetJetEtaLimits(cont->GetJetEtaMin()-0.1,cont->GetJetEtaMax()+0.1);
+        if(!isZeroTwoPi) cont->SetJetPhiLimits(cont->GetJetPhiMin()-0.1,cont->GetJetPhiMax()+0.1);
+        break;
+      case kLimitBaseTagEtaPhi:
+        if(!(isBase || isTag)) break;
+        cont->SetJetEtaLimits(cont->GetJetEtaMin()-0.1,cont->GetJetEtaMax()+0.1);
+        if(!isZeroTwoPi) cont->SetJetPhiLimits(cont->GetJetPhiMin()-0.1,cont->GetJetPhiMax()+0.1);
+      };
+    }
     fInit = kTRUE;
     return;
   }
 
+  void AliEmcalJetTaggerTaskFast::AddJetContainerPair(Int_t contBase, Int_t contTag, Double_t maxDist) {
+    fPairContainerBase.push_back(contBase);
+    fPairContainerTag.push_back(contTag);
+    fPairMaxDist.push_back(maxDist);
+  }
+
+  void AliEmcalJetTaggerTaskFast::GetJetContainerPair(Int_t ipair, Int_t &contBase, Int_t &contTag, Double_t &maxDist) const {
+    if(ipair == 0) {
+      contBase = fContainerBase;
+      contTag = fContainerTag;
+      maxDist = fMaxDist;
+      return;
+    }
+    contBase = fPairContainerBase[ipair-1];
+    contTag = fPairContainerTag[ipair-1];
+    maxDist = fPairMaxDist[ipair-1] > 0. ? fPairMaxDist[ipair-1] : fMaxDist;
+  }
+
+  std::vector<Int_t> AliEmcalJetTaggerTaskFast::GetContainerRoles() const {
+    std::vector<Int_t> roles(fJetCollArray.GetEntriesFast(), 0);
+    for(Int_t ipair = 0; ipair < GetNumberOfJetContainerPairs(); ipair++) {
+      Int_t contBase(-1), contTag(-1);
+      Double_t maxDist(0.);
+      GetJetContainerPair(ipair, contBase, contTag, maxDist);
+      if(contBase >= 0 && contBase < static_cast<Int_t>(roles.size())) roles[contBase] |= 1;
+      if(contTag >= 0 && contTag < static_cast<Int_t>(roles.size())) roles[contTag] |= 2;
+    }
+    return roles;
+  }
+
   Bool_t AliEmcalJetTaggerTaskFast::Run()
   {
     Init();
-    AliJetContainer *contBase = GetJetContainer(fContainerBase),
-                    *contTag = GetJetContainer(fContainerTag);
 
-    ResetTagging(*contBase);
-    ResetTagging(*contTag);
-
-    fMatchingDone = MatchJetsGeo(*contBase, *contTag, fMaxDist);
+    // kd-trees are built at the first request, once per container and event
+    fSpatialIndices.resize(fJetCollArray.GetEntriesFast());
+    for(auto &index : fSpatialIndices) index.Clear();
+
+    // The tags are reset before each pair and the pairs are matched from the last to the first,
+    // such that the tags in a container used in several pairs are the ones of its first pair
+    fMatchedJets.resize(GetNumberOfJetContainerPairs());
+    for(Int_t ipair = GetNumberOfJetContainerPairs() - 1; ipair >= 0; ipair--) {
+      Int_t contBase(-1), contTag(-1);
+      Double_t maxDist(0.);
+      GetJetContainerPair(ipair, contBase, contTag, maxDist);
+      AliJetContainer *base = GetJetContainer(contBase), *tag = GetJetContainer(contTag);
+      if(base) ResetTagging(*base);
+      if(tag) ResetTagging(*tag);
+      Bool_t matchingDone = MatchJetsGeo(contBase, contTag, maxDist, fMatchedJets[ipair]);
+      if(ipair == 0) fMatchingDone = matchingDone;
+    }
 
     return kTRUE;
   }
@@ -364,141 +425,171 @@ namespace PWGJE {
     }
   }
 
-  bool AliEmcalJetTaggerTaskFast::MatchJetsGeo(AliJetContainer &contBase, AliJetContainer &contTag, Float_t maxDist) const {
-    const Int_t kNacceptedBase = contBase.GetNAcceptedJets(),
-                kNacceptedTag = contTag.GetNAcceptedJets();
-    if(!(kNacceptedBase && kNacceptedTag)) return false;
-
-    // Build kd-trees
-    TArrayD etaBase(kNacceptedBase), phiBase(kNacceptedBase),
-            etaTag(kNacceptedTag), phiTag(kNacceptedTag);
-    std::vector<AliEmcalJet *> jetsBase(kNacceptedBase), jetsTag(kNacceptedTag); // the storages are needed later for applying the tagging, in order to avoid multiple occurrence of jet selection
-
-    int countBase(0), countTag(0);
-    for(auto jb : contBase.accepted()) {
-      etaBase[countBase] = jb->Eta();
-      phiBase[countBase] = jb->Phi();
-      jetsBase[countBase] = jb;
-      countBase++;
+  const AliEmcalJetTaggerTaskFast::JetSpatialIndex &AliEmcalJetTaggerTaskFast::GetSpatialIndex(Int_t icont) {
+    if(icont < 0 || icont >= static_cast<Int_t>(fSpatialIndices.size())) {
+      AliFatal(Form("Jet container %d not available", icont));
     }
-    for(auto jt : contTag.accepted()) {
-      etaTag[countTag] = jt->Eta();
-      phiTag[countTag] = jt->Phi();
-      jetsTag[countTag] = jt;
-      countTag++;
-    }
-    TKDTreeID treeBase(etaBase.GetSize(), 2, 1), treeTag(etaTag.GetSize(), 2, 1);
-    treeBase.SetData(0, etaBase.GetArray());
-    treeBase.SetData(1, phiBase.GetArray());
-    treeBase.Build();
-    treeTag.SetData(0, etaTag.GetArray());
-    treeTag.SetData(1, phiTag.GetArray());
-    treeTag.Build();
-
-    TArrayI faMatchIndexTag(kNacceptedBase), faMatchIndexBase(kNacceptedTag);
-    faMatchIndexBase.Reset(-1);
-    faMatchIndexTag.Reset(-1);
-
-    // find the closest distance to the full jet
-    countBase = 0;
-    for(auto j : contBase.accepted()) {
-      Double_t point[2] = {j->Eta(), j->Phi()};
-      Int_t index(-1); Double_t distance(-1);
-      treeTag.FindNearestNeighbors(point, 1, &index, &distance);
-      // test whether indices are matching:
-      if(index >= 0 && distance < maxDist){
-        AliDebugStream(1) << "Found closest tag jet for " << countBase << " with match index " << index << " and distance " << distance << std::endl;
-        faMatchIndexTag[countBase]=index;
-      } else {
-        AliDebugStream(1) << "Not found closest tag jet for " << countBase << ", distance to closest " << distance << std::endl;
-      }
-
-#ifdef JETTAGGERFAST_TEST
-      if(index>-1){
-        Double_t distanceTest(-1);
-        distanceTest = TMath::Sqrt(TMath::Power(etaTag[index] - j->Eta(), 2) +  TMath::Power(phiTag[index] - j->Phi(), 2));
-        if(TMath::Abs(distanceTest - distance) > DBL_EPSILON){
-          AliDebugStream(1) << "Mismatch in distance from tag jet with index from tree: " << distanceTest << ", distance from tree " << distance << std::endl;
-          fIndexErrorRateBase->Fill(1);
-        }
+    JetSpatialIndex &index = fSpatialIndices[icont];
+    if(!index.IsBuilt()) {
+      // the storage is needed later for applying the tagging, in order to avoid multiple occurrence of jet selection
+      std::vector<AliEmcalJet *> jets;
+      AliJetContainer *cont = GetJetContainer(icont);
+      if(cont) {
+        jets.reserve(cont->GetNAcceptedJets());
+        for(auto j : cont->accepted()) jets.push_back(j);
       }
-#endif
-
-      countBase++;
+      index.Build(jets);
     }
+    return index;
+  }
 
-    // other way around
-    countTag = 0;
-    for(auto j : contTag.accepted()){
-      Double_t point[2] = {j->Eta(), j->Phi()};
-      Int_t index(-1); Double_t distance(-1);
-      treeBase.FindNearestNeighbors(point, 1, &index, &distance);
-      if(index >= 0 && distance < maxDist){
-        AliDebugStream(1) << "Found closest base jet for " << countBase << " with match index " << index << " and distance " << distance << std::endl;
-        faMatchIndexBase[countTag]=index;
-      } else {
-        AliDebugStream(1) << "Not found closest tag jet for " << countBase << ", distance to closest " << distance << std::endl;
-      }
+  bool AliEmcalJetTaggerTaskFast::MatchJetsGeo(Int_t contBase, Int_t contTag, Float_t maxDist, std::vector<std::pair<AliEmcalJet *, AliEmcalJet *>> &matched) {
+    matched.clear();
+    const JetSpatialIndex &indexBase = GetSpatialIndex(contBase),
+                          &indexTag = GetSpatialIndex(contTag);
+    if(!(indexBase.GetNJets() && indexTag.GetNJets())) return false;
 
+    std::vector<std::pair<Int_t, Int_t>> matches;
+    MatchJets(indexBase, indexTag, maxDist, fTieBreakTolerance, matches);
+    AliDebugStream(1) << "Found " << matches.size() << " true matches: nbase(" << indexBase.GetNJets() << "), ntag(" << indexTag.GetNJets() << ")\n";
+
+    for(auto m : matches) {
+      AliEmcalJet *jetBase = indexBase.GetJet(m.first),
+                  *jetTag = indexTag.GetJet(m.second);
+      AliDebugStream(2) << "found a true match: base jet " << m.first << ", tag jet " << m.second << "\n";
 #ifdef JETTAGGERFAST_TEST
-      if(index>-1){
-        Double_t distanceTest(-1);
-        distanceTest = TMath::Sqrt(TMath::Power(etaBase[index] - j->Eta(), 2) +  TMath::Power(phiBase[index] - j->Phi(), 2));
-        if(TMath::Abs(distanceTest - distance) > DBL_EPSILON){
-          AliDebugStream(1) << "Mismatch in distance from base jet with index from tree: " << distanceTest << ", distance from tree " << distance << std::endl;
+      if(!jetBase) fContainerErrorRateBase->Fill(1);
+      if(!jetTag) fContainerErrorRateTag->Fill(1);
+      if(jetBase && jetTag) {
+        Double_t distanceTest = TMath::Sqrt(TMath::Power(jetBase->Eta() - jetTag->Eta(), 2) + TMath::Power(jetBase->Phi() - jetTag->Phi(), 2));
+        if(distanceTest >= maxDist) {
+          AliDebugStream(1) << "Matched jets beyond the maximum distance: " << distanceTest << "\n";
+          fIndexErrorRateBase->Fill(1);
           fIndexErrorRateTag->Fill(1);
         }
       }
 #endif
+      if(!(jetBase && jetTag)) continue;
+      Double_t dR = jetBase->DeltaR(jetTag);
+      switch(fJetTaggingType){
+      case kTag:
+        jetBase->SetTaggedJet(jetTag);
+        jetBase->SetTagStatus(1);
 
-      countTag++;
+        jetTag->SetTaggedJet(jetBase);
+        jetTag->SetTagStatus(1);
+        break;
+      case kClosest:
+        jetBase->SetClosestJet(jetTag,dR);
+        jetTag->SetClosestJet(jetBase,dR);
+        break;
+      };
+      matched.push_back(std::make_pair(jetBase, jetTag));
     }
+    return kTRUE;
+  }
+
+  void AliEmcalJetTaggerTaskFast::MatchJets(const JetSpatialIndex &base, const JetSpatialIndex &tag, Double_t maxDist, Double_t tieBreakTolerance, std::vector<std::pair<Int_t, Int_t>> &matches) {
+    matches.clear();
+    const Int_t kNbase = base.GetNJets(), kNtag = tag.GetNJets();
+    if(!(kNbase && kNtag)) return;
+
+    // find the closest jet of the other list, in both directions
+    std::vector<Int_t> matchIndexTag(kNbase, -1), matchIndexBase(kNtag, -1);
+    for(Int_t ibase = 0; ibase < kNbase; ibase++)
+      matchIndexTag[ibase] = tag.FindClosest(base.GetJet(ibase), maxDist, tieBreakTolerance, kTRUE);
+    for(Int_t itag = 0; itag < kNtag; itag++)
+      matchIndexBase[itag] = base.FindClosest(tag.GetJet(itag), maxDist, tieBreakTolerance, kFALSE);
 
     // check for "true" correlations
     // these are pairs where the base jet is the closest to the tag jet and vice versa
     // As the lists are linear a loop over the outer base jet is sufficient.
-    AliDebugStream(1) << "Starting true jet loop: nbase(" << kNacceptedBase << "), ntag(" << kNacceptedTag << ")\n";
-    for(int ibase = 0; ibase < kNacceptedBase; ibase++) {
-      AliDebugStream(2) << "base jet " << ibase << ": match index in tag jet container " << faMatchIndexTag[ibase] << "\n";
-      if(faMatchIndexTag[ibase] > -1){
-       AliDebugStream(2) << "tag jet " << faMatchIndexTag[ibase] << ": matched base jet " << faMatchIndexBase[faMatchIndexTag[ibase]] << "\n";
-      }
-      if(faMatchIndexTag[ibase] > -1 && faMatchIndexBase[faMatchIndexTag[ibase]] == ibase) {
-        AliDebugStream(2) << "found a true match \n";
-        AliEmcalJet *jetBase = jetsBase[ibase],
-                    *jetTag = jetsTag[faMatchIndexTag[ibase]];
-        if(jetBase && jetTag) {
-#ifdef JETTAGGERFAST_TEST
-          if(TMath::Abs(etaBase[ibase] - jetBase->Eta()) > DBL_EPSILON || TMath::Abs(phiBase[ibase] - jetBase->Phi()) > DBL_EPSILON){
-            AliErrorStream() << "Selected incorrect base jet for tagging : eta test(" << jetBase->Eta() << ")/true(" << etaBase[ibase]
-                             << "), phi test(" << jetBase->Phi() << ")/true(" << phiBase[ibase] << ")\n";
-            fContainerErrorRateBase->Fill(1);
-          }
-          if(TMath::Abs(etaTag[faMatchIndexTag[ibase]] - jetTag->Eta()) > DBL_EPSILON || TMath::Abs(phiTag[faMatchIndexTag[ibase]] - jetTag->Phi()) > DBL_EPSILON){
-            AliErrorStream() << "Selected incorrect tag jet for tagging : eta test(" << jetTag->Eta() << ")/true(" << etaTag[faMatchIndexTag[ibase]]
-                             << "), phi test(" << jetTag->Phi() << ")/true(" << phiTag[faMatchIndexTag[ibase]] << ")\n";
-            fContainerErrorRateTag->Fill(1);
-          }
-#endif
-          // Test if the position of the jets correp
-          Double_t dR = jetBase->DeltaR(jetTag);
-          switch(fJetTaggingType){
-          case kTag:
-            jetBase->SetTaggedJet(jetTag);
-            jetBase->SetTagStatus(1);
-
-            jetTag->SetTaggedJet(jetBase);
-            jetTag->SetTagStatus(1);
-            break;
-          case kClosest:
-            jetBase->SetClosestJet(jetTag,dR);
-            jetTag->SetClosestJet(jetBase,dR);
-            break;
-          };
-        }
+    for(Int_t ibase = 0; ibase < kNbase; ibase++) {
+      if(matchIndexTag[ibase] > -1 && matchIndexBase[matchIndexTag[ibase]] == ibase)
+        matches.push_back(std::make_pair(ibase, matchIndexTag[ibase]));
+    }
+  }
+
+  Double_t AliEmcalJetTaggerTaskFast::GetSharedPtFraction(const AliEmcalJet *jetBase, const AliEmcalJet *jetTag) {
+    if(!(jetBase && jetTag) || jetTag->Pt() <= 0.) return -1.;
+
+    Double_t sumPt = 0.;
+    for(Int_t icb = 0; icb < jetBase->GetNumberOfTracks(); icb++) {
+      if(jetTag->ContainsTrack(jetBase->TrackAt(icb)) < 0) continue;
+      AliVParticle *vp = jetBase->Track(icb);
+      if(vp) sumPt += vp->Pt();
+    }
+    return sumPt / jetTag->Pt();
+  }
+
+  AliEmcalJetTaggerTaskFast::JetSpatialIndex::JetSpatialIndex() :
+    fJets(),
+    fEta(),
+    fPhi(),
+    fTree(),
+    fBuilt(kFALSE)
+  {
+  }
+
+  AliEmcalJetTaggerTaskFast::JetSpatialIndex::JetSpatialIndex(JetSpatialIndex &&other) = default;
+
+  AliEmcalJetTaggerTaskFast::JetSpatialIndex &AliEmcalJetTaggerTaskFast::JetSpatialIndex::operator=(JetSpatialIndex &&other) = default;
+
+  AliEmcalJetTaggerTaskFast::JetSpatialIndex::~JetSpatialIndex() {
+  }
+
+  void AliEmcalJetTaggerTaskFast::JetSpatialIndex::Build(const std::vector<AliEmcalJet *> &jets) {
+    fJets = jets;
+    fEta.resize(fJets.size());
+    fPhi.resize(fJets.size());
+    for(std::size_t ijet = 0; ijet < fJets.size(); ijet++) {
+      fEta[ijet] = fJets[ijet]->Eta();
+      fPhi[ijet] = fJets[ijet]->Phi();
+    }
+    fTree.reset();
+    if(fJets.size()) {
+      // the tree does not own the data, which stays in fEta and fPhi
+      fTree.reset(new TKDTreeID(fJets.size(), 2, 1));
+      fTree->SetData(0, fEta.data());
+      fTree->SetData(1, fPhi.data());
+      fTree->Build();
+    }
+    fBuilt = kTRUE;
+  }
+
+  void AliEmcalJetTaggerTaskFast::JetSpatialIndex::Clear() {
+    fJets.clear();
+    fEta.clear();
+    fPhi.clear();
+    fTree.reset();
+    fBuilt = kFALSE;
+  }
+
+  Int_t AliEmcalJetTaggerTaskFast::JetSpatialIndex::FindClosest(const AliEmcalJet *jet, Double_t maxDist, Double_t tieBreakTolerance, Bool_t queryIsBase) const {
+    if(!fTree) return -1;
+
+    Double_t point[2] = {jet->Eta(), jet->Phi()};
+    Int_t index(-1); Double_t distance(-1);
+    fTree->FindNearestNeighbors(point, 1, &index, &distance);
+    if(!(index >= 0 && distance < maxDist)) return -1;
+    if(tieBreakTolerance < 0.) return index;
+
+    // Ambiguous candidates are decided by the shared momentum fraction
+    std::vector<Int_t> candidates;
+    fTree->FindInRange(point, distance + tieBreakTolerance, candidates);
+    Int_t best = index;
+    Double_t bestFraction = queryIsBase ? GetSharedPtFraction(jet, fJets[index]) : GetSharedPtFraction(fJets[index], jet);
+    for(auto icand : candidates) {
+      if(icand == index) continue;
+      Double_t dEta = fEta[icand] - point[0], dPhi = fPhi[icand] - point[1];
+      if(TMath::Sqrt(dEta*dEta + dPhi*dPhi) >= maxDist) continue;
+      Double_t fraction = queryIsBase ? GetSharedPtFraction(jet, fJets[icand]) : GetSharedPtFraction(fJets[icand], jet);
+      if(fraction > bestFraction) {
+        best = icand;
+        bestFraction = fraction;
       }
     }
-    return kTRUE;
+    return best;
   }
 
   Double_t AliEmcalJetTaggerTaskFast::GetDeltaPhi(const AliEmcalJet* jet1, const AliEmcalJet* jet2) {
@@ -32,8 +32,14 @@
 class TH1;
 class TH2;
 class TH3;
+class TKDTreeID;
+class AliEmcalJet;
 class AliJetContainer;
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include "AliAnalysisTaskEmcalJet.h"
 
 namespace PWGJE {
@@ -50,6 +56,16 @@ namespace EMCALJetTasks {
  * Class based on AliAnalysisTaskEmcalJetTagger. Navigation finding closest neighbor
  * however is based on a kd-tree.
  *
+ * Besides the pair of containers set with SetJetContainerBase and SetJetContainerTag,
+ * further pairs (for example detector vs. particle level and embedded vs. hybrid, at
+ * different radii) can be matched by the same task with AddJetContainerPair. The kd-tree
+ * of each container is built once per event and shared by all pairs the container is
+ * part of. The tag status of the jets is stored in the jets. The tags of both containers
+ * of a pair are reset before the pair is matched and the pairs are matched from the last
+ * to the first, so for a container used in several pairs the tags are the ones of the
+ * first pair the container is part of (jets not matched in that pair are untagged). The
+ * matches of each pair are available from GetMatchedJets. The QA histograms are filled
+ * for the first pair.
  */
 class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
  public:
@@ -105,6 +121,99 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
   void SetMaxDistance(Double_t dist)                            { fMaxDist = dist; }
   void SetSpecialParticleContainer(Int_t contnumb)              { fSpecPartContTag = contnumb; }
 
+  /**
+   * @brief Add a further pair of jet containers to be matched
+   * @param[in] contBase Index of the container with the base jets
+   * @param[in] contTag Index of the container with the jets to be tagged
+   * @param[in] maxDist Distance allowed for two jets to match. If not positive, the distance set with SetMaxDistance is used.
+   */
+  void AddJetContainerPair(Int_t contBase, Int_t contTag, Double_t maxDist = -1.);
+
+  /**
+   * @brief Resolve ambiguities in the matching using the shared momentum fraction
+   *
+   * Candidates within the tolerance of the closest distance (and within the maximum distance)
+   * are compared by the fraction of the momentum of the tag jet carried by constituents
+   * shared with the base jet, the highest fraction being chosen. Matches remain bijective.
+   * The constituents are compared by index, so the jets of both containers must be built
+   * from the same particle container. Disabled for negative tolerance (default).
+   *
+   * @param[in] tolerance Tolerance on the distance
+   */
+  void SetSharedFractionTieBreak(Double_t tolerance)            { fTieBreakTolerance = tolerance; }
+
+  /**
+   * @brief Number of pairs of jet containers matched, including the first one
+   */
+  Int_t GetNumberOfJetContainerPairs() const                    { return fPairContainerBase.size() + 1; }
+
+  /**
+   * @brief Matched (base, tag) jets of a pair of containers in the current event
+   * @param[in] ipair Index of the pair, 0 being the pair set with SetJetContainerBase and SetJetContainerTag
+   */
+  const std::vector<std::pair<AliEmcalJet *, AliEmcalJet *>> &GetMatchedJets(Int_t ipair) const { return fMatchedJets[ipair]; }
+
+  /**
+   * @class JetSpatialIndex
+   * @brief kd-tree over the \f$\eta\f$-\f$\phi\f$ positions of a list of jets
+   */
+  class JetSpatialIndex {
+  public:
+    JetSpatialIndex();
+    JetSpatialIndex(JetSpatialIndex &&other);
+    JetSpatialIndex &operator=(JetSpatialIndex &&other);
+    ~JetSpatialIndex();
+
+    /**
+     * @brief Build the index from the list of jets, the order of the jets is kept
+     */
+    void Build(const std::vector<AliEmcalJet *> &jets);
+    void Clear();
+
+    Bool_t IsBuilt() const                  { return fBuilt; }
+    Int_t GetNJets() const                  { return fJets.size(); }
+    AliEmcalJet *GetJet(Int_t i) const      { return fJets[i]; }
+
+    /**
+     * @brief Find the jet closest to a given jet
+     * @param[in] jet Jet to be matched
+     * @param[in] maxDist Distance allowed for a match
+     * @param[in] tieBreakTolerance Tolerance for the shared momentum fraction tie-break, disabled if negative
+     * @param[in] queryIsBase If true, the query jet is the base jet of the pair, otherwise the tag jet
+     * @return Index of the closest jet, -1 if none is found within maxDist
+     */
+    Int_t FindClosest(const AliEmcalJet *jet, Double_t maxDist, Double_t tieBreakTolerance, Bool_t queryIsBase) const;
+
+  private:
+    std::vector<AliEmcalJet *>        fJets;    ///< Indexed jets
+    std::vector<Double_t>             fEta;     ///< \f$\eta\f$ of the jets
+    std::vector<Double_t>             fPhi;     ///< \f$\phi\f$ of the jets
+    std::unique_ptr<TKDTreeID>        fTree;    ///< kd-tree over the jet positions
+    Bool_t                            fBuilt;   ///< Index built for the current event
+  };
+
+  /**
+   * @brief Bijective geometric matching between two lists of jets
+   *
+   * For each base jet, the closest tag jet is searched and vice versa. Pairs are
+   * accepted only if the base jet is the closest neighbor of the tag jet and vice
+   * versa at the same time, and their distance is smaller than maxDist.
+   *
+   * @param[in] base Index of the base jets
+   * @param[in] tag Index of the tag jets
+   * @param[in] maxDist Maximum distance allowed in order to accept a pair
+   * @param[in] tieBreakTolerance Tolerance for the shared momentum fraction tie-break, disabled if negative
+   * @param[out] matches Indices of the matched (base, tag) jets, ordered by base jet
+   */
+  static void MatchJets(const JetSpatialIndex &base, const JetSpatialIndex &tag, Double_t maxDist, Double_t tieBreakTolerance, std::vector<std::pair<Int_t, Int_t>> &matches);
+
+  /**
+   * @brief Fraction of the transverse momentum of the tag jet carried by constituents shared with the base jet
+   *
+   * Constituents are compared by index.
+   */
+  static Double_t GetSharedPtFraction(const AliEmcalJet *jetBase, const AliEmcalJet *jetTag);
+
 
   /**
    * @brief Factory creating new jet matching task
@@ -144,7 +253,7 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
    * @brief Run matching
    *
    * In case the task is not yet initialized, initializing first.
-   * Before matching the current match status of the jets in both
+   * Before matching each pair the current match status of the jets in both
    * the base and the tag container are reset. For the matching
    * see \ref MatchJetsGeo
    *
@@ -186,13 +295,35 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
    * in distance in the \$\eta\f$-\f$\phi\$ space, accepting only pairs
    * with a distance smaller maxDistance. True jet pairs are accepted only
    * if the base jet is the closest neighbor to the tag jet and vice versa
-   * at the same time.
+   * at the same time. See \ref MatchJets.
    *
-   * @param[in] contBase Container with base jets
-   * @param[in] contTag Container with jets to be tagged
+   * @param[in] contBase Index of the container with base jets
+   * @param[in] contTag Index of the container with jets to be tagged
    * @param[in] maxDistance Maximum distance allowed in order to accept a pair tag
+   * @param[out] matched Matched (base, tag) jets
+   */
+  Bool_t     MatchJetsGeo(Int_t contBase, Int_t contTag, Float_t maxDist, std::vector<std::pair<AliEmcalJet *, AliEmcalJet *>> &matched);
+
+  /**
+   * @brief Get the containers and the distance allowed to match of a pair
+   * @param[in] ipair Index of the pair
+   * @param[out] contBase Index of the base jet container
+   * @param[out] contTag Index of the tag jet container
+   * @param[out] maxDist Distance allowed for two jets to match
+   */
+  void       GetJetContainerPair(Int_t ipair, Int_t &contBase, Int_t &contTag, Double_t &maxDist) const;
+
+  /**
+   * @brief Role of each jet container in the matched pairs
+   * @return Per jet container, bit 0 set if used as base, bit 1 set if used as tag
+   */
+  std::vector<Int_t> GetContainerRoles() const;
+
+  /**
+   * @brief Spatial index of the accepted jets of a container, built at the first request in the event
+   * @param[in] icont Index of the jet container
    */
-  Bool_t     MatchJetsGeo(AliJetContainer &contBase, AliJetContainer &contTag, Float_t maxDist = 0.3) const;
+  const JetSpatialIndex &GetSpatialIndex(Int_t icont);
 
   /**
    * @brief Reset tagging for all jets in jet container
@@ -213,6 +344,12 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
   AcceptanceType                      fTypeAcc;                    ///< acceptance cut for the jet containers, see method MatchJetsGeo in .cxx for possibilities
   Double_t                            fMaxDist;                    ///< distance allowed for two jets to match
   Bool_t                              fInit;                       ///< true when the containers are initialized
+  std::vector<Int_t>                  fPairContainerBase;          ///< base jet containers of the further pairs
+  std::vector<Int_t>                  fPairContainerTag;           ///< tag jet containers of the further pairs
+  std::vector<Double_t>               fPairMaxDist;                ///< distance allowed to match of the further pairs
+  Double_t                            fTieBreakTolerance;          ///< tolerance of the shared momentum fraction tie-break, disabled if negative
+  std::vector<JetSpatialIndex>        fSpatialIndices;             //!<! spatial index per jet container, rebuilt each event
+  std::vector<std::vector<std::pair<AliEmcalJet *, AliEmcalJet *>>> fMatchedJets; //!<! matched jets per pair of containers
   TH3            **fh3PtJet1VsDeltaEtaDeltaPhi;  //!<! \f$ p_{t}\f$ jet 1 vs deta vs dphi
   TH2            **fh2PtJet1VsDeltaR;            //!<! \f$ p_{t}\f$ jet 1 vs dR
   TH2            **fh2PtJet2VsFraction;          //!<! \f$ p_{t}\f$ jet 1 vs shared fraction
@@ -235,7 +372,7 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
   AliEmcalJetTaggerTaskFast &operator=(const AliEmcalJetTaggerTaskFast&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTaggerTaskFast, 2);
+  ClassDef(AliEmcalJetTaggerTaskFast, 3);
   /// \endcond
 };
 }
@@ -2,6 +2,7 @@
 #include "AliEmcalJet.h"
 #include "AliRhoParameter.h"
 #include "AliEmcalJetTask.h"
+#include "AliEmcalFastConstituentSubtractor.h"
 
 ClassImp(AliEmcalJetUtilityConstSubtractor)
 
@@ -18,7 +19,15 @@ AliEmcalJetUtilityConstSubtractor::AliEmcalJetUtilityConstSubtractor() :
   fJetsSub(0x0),
   fParticlesSub(0x0),
   fRhoParam(0),
-  fRhomParam(0)
+  fRhomParam(0),
+  fAlpha(0),
+  fMaxDelR(-1),
+  fEventWideSubtraction(kFALSE),
+  fScanAlpha(),
+  fScanMaxDelR(),
+  fFastSubtractor(0),
+  fJetsSubScan(),
+  fParticlesSubScan()
 {
   // Dummy constructor.
 
@@ -39,7 +48,13 @@ AliEmcalJetUtilityConstSubtractor::AliEmcalJetUtilityConstSubtractor(const char*
   fRhoParam(0),
   fRhomParam(0),
   fAlpha(0),
-  fMaxDelR(-1)
+  fMaxDelR(-1),
+  fEventWideSubtraction(kFALSE),
+  fScanAlpha(),
+  fScanMaxDelR(),
+  fFastSubtractor(0),
+  fJetsSubScan(),
+  fParticlesSubScan()
 {
   // Default constructor.
 }
@@ -58,12 +73,26 @@ AliEmcalJetUtilityConstSubtractor::AliEmcalJetUtilityConstSubtractor(const AliEm
   fParticlesSub(other.fParticlesSub),
   fRhoParam(other.fRhoParam),
   fRhomParam(other.fRhomParam),
-  fAlpha(0),
-  fMaxDelR(-1)
+  fAlpha(other.fAlpha),
+  fMaxDelR(other.fMaxDelR),
+  fEventWideSubtraction(other.fEventWideSubtraction),
+  fScanAlpha(other.fScanAlpha),
+  fScanMaxDelR(other.fScanMaxDelR),
+  fFastSubtractor(0),
+  fJetsSubScan(other.fJetsSubScan),
+  fParticlesSubScan(other.fParticlesSubScan)
 {
   // Copy constructor.
 }
 
+//______________________________________________________________________________
+AliEmcalJetUtilityConstSubtractor::~AliEmcalJetUtilityConstSubtractor()
+{
+  // Destructor.
+
+  delete fFastSubtractor;
+}
+
 //______________________________________________________________________________
 AliEmcalJetUtilityConstSubtractor& AliEmcalJetUtilityConstSubtractor::operator=(const AliEmcalJetUtilityConstSubtractor &other)
 {
@@ -82,6 +111,15 @@ AliEmcalJetUtilityConstSubtractor& AliEmcalJetUtilityConstSubtractor::operator=(
   fParticlesSub = other.fParticlesSub;
   fRhoParam = other.fRhoParam;
   fRhomParam = other.fRhomParam;
+  fAlpha = other.fAlpha;
+  fMaxDelR = other.fMaxDelR;
+  fEventWideSubtraction = other.fEventWideSubtraction;
+  fScanAlpha = other.fScanAlpha;
+  fScanMaxDelR = other.fScanMaxDelR;
+  fJetsSubScan = other.fJetsSubScan;
+  fParticlesSubScan = other.fParticlesSubScan;
+  delete fFastSubtractor;
+  fFastSubtractor = 0;
   return *this;
 }
 
@@ -130,6 +168,40 @@ void AliEmcalJetUtilityConstSubtractor::Init()
     }
   }
 
+  if (fEventWideSubtraction) {
+    // Setting 0 is the main one, the others are the scan points
+    if (fRhoName.IsNull()) {
+      AliWarning(Form("%s: Event-wide subtraction uses the rho of the event but no rho name was given, rho = %e", GetName(), fRho));
+    }
+    delete fFastSubtractor;
+    fFastSubtractor = new AliEmcalFastConstituentSubtractor();
+    fFastSubtractor->AddSetting(fAlpha, fMaxDelR);
+    fJetsSubScan.clear();
+    fParticlesSubScan.clear();
+    for (UInt_t i = 0; i < fScanAlpha.size() && i < fScanMaxDelR.size(); i++) {
+      fFastSubtractor->AddSetting(fScanAlpha[i], fScanMaxDelR[i]);
+      TString jetsName = GetScanName(fJetsSubName, i), particlesName = GetScanName(fParticlesSubName, i);
+      TClonesArray *jets = 0, *particles = 0;
+      if (!jetsName.IsNull() && !fJetTask->InputEvent()->FindListObject(jetsName)) {
+        jets = new TClonesArray("AliEmcalJet");
+        jets->SetName(jetsName);
+        fJetTask->InputEvent()->AddObject(jets);
+      }
+      if (!particlesName.IsNull() && !fJetTask->InputEvent()->FindListObject(particlesName)) {
+        particles = new TClonesArray("AliEmcalParticle");
+        particles->SetName(particlesName);
+        fJetTask->InputEvent()->AddObject(particles);
+        fJetTask->AddParticleContainer(particlesName);
+      }
+      fJetsSubScan.push_back(jets);
+      fParticlesSubScan.push_back(particles);
+      AliInfo(Form("%s: alpha = %f, max delta R = %f written to %s", GetName(), fScanAlpha[i], fScanMaxDelR[i], jetsName.Data()));
+    }
+  }
+  else if (!fScanAlpha.empty()) {
+    AliWarning(Form("%s: Scans of alpha and max delta R need the event-wide subtraction, ignoring them", GetName()));
+  }
+
   // Create particle container in the main jet task so the indices of the constituents
   // added later are properly mapped by the jet task.
   // It is safe to create it before the actual jet finding because the underlying array
@@ -164,6 +236,18 @@ void AliEmcalJetUtilityConstSubtractor::Prepare(AliFJWrapper& fjw)
   }
  
   if (fJetsSub) fJetsSub->Delete();
+  for (UInt_t i = 0; i < fJetsSubScan.size(); i++) {
+    if (fJetsSubScan[i]) fJetsSubScan[i]->Delete();
+    if (fParticlesSubScan[i]) fParticlesSubScan[i]->Delete();
+  }
+
+  if (fFastSubtractor) {
+    // Ghost grid, rho and rhom are shared by all the jets and settings
+    fFastSubtractor->SetGhostGrid(fjw.GetMaxRap(), fjw.GetGhostArea());
+    fFastSubtractor->SetBackground(fRho, fRhom);
+    fFastSubtractor->SubtractEvent(fjw.GetInputVectors());
+    return;
+  }
 
   fjw.SetUseExternalBkg(fUseExternalBkg, fRho, fRhom);
   fjw.SetAlpha(fAlpha);
@@ -190,13 +274,37 @@ void AliEmcalJetUtilityConstSubtractor::Terminate(AliFJWrapper& fjw)
   }
 
 #ifdef FASTJET_VERSION
-  std::vector<fastjet::PseudoJet> jets_sub;
-  jets_sub = fjw.GetConstituentSubtrJets();
+  if (!fFastSubtractor) {
+    FillSubtractedJets(fJetsSub, fParticlesSubName, fjw.GetConstituentSubtrJets(), fjw);
+    return;
+  }
+
+  Int_t nSettings = fFastSubtractor->GetNSettings();
+  std::vector<std::vector<fastjet::PseudoJet> > jets_sub(nSettings);
+  for (UInt_t ijet = 0; ijet < fjw.GetInclusiveJets().size(); ++ijet) {
+    std::vector<fastjet::PseudoJet> constituents_unsub(fjw.GetJetConstituents(ijet));
+    for (Int_t is = 0; is < nSettings; is++) jets_sub[is].push_back(fFastSubtractor->GetSubtractedJet(constituents_unsub, is));
+  }
+  AliDebug(1,Form("%d event-wide constituent subtracted jets found", (Int_t)jets_sub[0].size()));
+
+  FillSubtractedJets(fJetsSub, fParticlesSubName, jets_sub[0], fjw);
+  for (Int_t is = 1; is < nSettings; is++) {
+    if (fJetsSubScan[is - 1]) FillSubtractedJets(fJetsSubScan[is - 1], GetScanName(fParticlesSubName, is - 1), jets_sub[is], fjw);
+  }
+#endif
+}
+
+#ifdef FASTJET_VERSION
+//______________________________________________________________________________
+void AliEmcalJetUtilityConstSubtractor::FillSubtractedJets(TClonesArray* jetsSub, const TString& particlesSubName, const std::vector<fastjet::PseudoJet>& jets_sub, AliFJWrapper& fjw)
+{
+  // Write the subtracted jets, in the order of the unsubtracted ones, and their constituents.
+
   AliDebug(1,Form("%d constituent subtracted jets found", (Int_t)jets_sub.size()));
   for (UInt_t ijet = 0, jetCount = 0; ijet < jets_sub.size(); ++ijet) {
     //Only storing 4-vector and jet area of unsubtracted jet
     if(jets_sub[ijet].E()>0.) {
-      AliEmcalJet *jet_sub = new ((*fJetsSub)[ijet])
+      AliEmcalJet *jet_sub = new ((*jetsSub)[ijet])
         AliEmcalJet(jets_sub[ijet].perp(), jets_sub[ijet].eta(), jets_sub[ijet].phi(), jets_sub[ijet].m());
       jet_sub->SetLabel(ijet);
       jet_sub->SetJetAcceptanceType(fJetTask->FindJetAcceptanceType(jet_sub->Eta(), jet_sub->Phi_0_2pi(), fJetTask->GetRadius()));
@@ -210,12 +318,9 @@ void AliEmcalJetUtilityConstSubtractor::Terminate(AliFJWrapper& fjw)
       // Fill constituent info
       std::vector<fastjet::PseudoJet> constituents_unsub(fjw.GetJetConstituents(ijet));
       std::vector<fastjet::PseudoJet> constituents_sub = jets_sub[ijet].constituents();
-      fJetTask->FillJetConstituents(jet_sub, constituents_sub, constituents_unsub, 1, fParticlesSubName);
+      fJetTask->FillJetConstituents(jet_sub, constituents_sub, constituents_unsub, 1, particlesSubName);
       jetCount++;
     }
   }
-
-#endif
-
 }
-
+#endif
@@ -1,6 +1,8 @@
 #ifndef ALIEMCALJETUTILITYCONSTSUBTRACTOR_H
 #define ALIEMCALJETUTILITYCONSTSUBTRACTOR_H
 
+#include <vector>
+
 #include <TNamed.h>
 
 #include "AliEmcalJetUtility.h"
@@ -11,6 +13,7 @@ class AliEmcalJetTask;
 class AliEmcalJet;
 class AliFJWrapper;
 class AliRhoParameter;
+class AliEmcalFastConstituentSubtractor;
 
 class AliEmcalJetUtilityConstSubtractor : public AliEmcalJetUtility
 {
@@ -20,7 +23,7 @@ class AliEmcalJetUtilityConstSubtractor : public AliEmcalJetUtility
   AliEmcalJetUtilityConstSubtractor(const char* name);
   AliEmcalJetUtilityConstSubtractor(const AliEmcalJetUtilityConstSubtractor &jet);
   AliEmcalJetUtilityConstSubtractor& operator=(const AliEmcalJetUtilityConstSubtractor &jet);
-  ~AliEmcalJetUtilityConstSubtractor() {;}
+  ~AliEmcalJetUtilityConstSubtractor();
 
   void                   SetRhoName(const char *n)           { fRhoName      = n         ; }
   void                   SetRhomName(const char *n)          { fRhomName     = n         ; }
@@ -30,6 +33,10 @@ class AliEmcalJetUtilityConstSubtractor : public AliEmcalJetUtility
   void                   SetParticlesSubName(const char *n)  { fParticlesSubName = n     ; }
   void                   SetAlpha(const Double_t a)            { fAlpha            = a     ; }
   void                   SetMaxDelR(const Double_t r)          { fMaxDelR          = r     ; }
+  // Event-wide subtraction with a regular ghost grid and the rho/rhom of the event, see AliEmcalFastConstituentSubtractor
+  void                   SetEventWideSubtraction(Bool_t b)     { fEventWideSubtraction = b ; }
+  // Additional (alpha, max delta R) setting of the event-wide subtraction, written to <JetsSubName>_Scan<i>
+  void                   AddScanPoint(Double_t a, Double_t r)  { fScanAlpha.push_back(a); fScanMaxDelR.push_back(r); }
 
   void Init();
   void InitEvent(AliFJWrapper& fjw);
@@ -38,6 +45,10 @@ class AliEmcalJetUtilityConstSubtractor : public AliEmcalJetUtility
   void Terminate(AliFJWrapper& fjw);
 
  protected:
+  TString GetScanName(const TString& name, Int_t i) const { return name.IsNull() ? name : TString::Format("%s_Scan%d", name.Data(), i); }
+#ifdef FASTJET_VERSION
+  void FillSubtractedJets(TClonesArray* jetsSub, const TString& particlesSubName, const std::vector<fastjet::PseudoJet>& jets_sub, AliFJWrapper& fjw);
+#endif
 
   TString                fJetsSubName;                        // name of subtracted jet collection
   TString                fParticlesSubName;                   // name of subtracted particle collection
@@ -48,12 +59,18 @@ class AliEmcalJetUtilityConstSubtractor : public AliEmcalJetUtility
   Double_t               fRhom;                               // mT background density
   Double_t               fAlpha;                              // pT weight exponent applied in const sub
   Double_t               fMaxDelR;                            // Max distance between ghost and constituent pair in subtraction
+  Bool_t                 fEventWideSubtraction;               // subtract all particles of the event at once instead of each jet
+  std::vector<Double_t>  fScanAlpha;                          // alpha of the additional settings (event-wide subtraction only)
+  std::vector<Double_t>  fScanMaxDelR;                        // max distance of the additional settings (event-wide subtraction only)
 
   TClonesArray          *fJetsSub;                            //!subtracted jet collection
   TClonesArray          *fParticlesSub;                       //!subtracted particle collection
   AliRhoParameter       *fRhoParam;                           //!event rho
   AliRhoParameter       *fRhomParam;                          //!event rhom
+  AliEmcalFastConstituentSubtractor *fFastSubtractor;         //!event-wide subtractor
+  std::vector<TClonesArray*> fJetsSubScan;                    //!subtracted jet collections of the additional settings
+  std::vector<TClonesArray*> fParticlesSubScan;               //!subtracted particle collections of the additional settings
 
-  ClassDef(AliEmcalJetUtilityConstSubtractor, 2) // Emcal jet utility that implements the constituent subtractor form the fastjet contrib
+  ClassDef(AliEmcalJetUtilityConstSubtractor, 3) // Emcal jet utility that implements the constituent subtractor form the fastjet contrib
 };
 #endif
@@ -38,6 +38,8 @@ class AliFJWrapper
   std::vector<fastjet::PseudoJet>         GetEventSubJetConstituents(UInt_t idx) const;
   std::vector<fastjet::PseudoJet>         GetFilteredJetConstituents(UInt_t idx) const;
   Double_t                                GetMedianUsedForBgSubtraction() const { return fMedUsedForBgSub; }
+  Double_t                                GetGhostArea()       const { return fGhostArea;                  }
+  Double_t                                GetMaxRap()          const { return fMaxRap;                     }
   const char*                             GetName()            const { return fName;                       }
   const char*                             GetTitle()           const { return fTitle;                      }
   Double_t                                GetJetArea         (UInt_t idx) const;
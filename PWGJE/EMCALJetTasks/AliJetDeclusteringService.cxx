@@ -0,0 +1,251 @@
+/************************************************************************************
+ * Copyright (C) 2019, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <algorithm>
+#include <string>
+#include <TMath.h>
+#include "fastjet/AreaDefinition.hh"
+#include "fastjet/ClusterSequence.hh"
+#include "fastjet/ClusterSequenceArea.hh"
+#include "fastjet/JetDefinition.hh"
+
+#include "AliAnalysisManager.h"
+#include "AliEmcalJet.h"
+#include "AliJetContainer.h"
+#include "AliLog.h"
+#include "AliParticleContainer.h"
+#include "AliVEvent.h"
+#include "AliVParticle.h"
+
+#include "AliJetDeclusteringService.h"
+
+ClassImp(PWGJE::EMCALJetTasks::AliJetDeclusteringService)
+
+using namespace PWGJE::EMCALJetTasks;
+
+namespace {
+  /// Services of the process, by jet branch, particle branch, algorithm and ghost area
+  std::map<std::string, std::unique_ptr<AliJetDeclusteringService>> gDeclusteringServices;
+}
+
+AliJetDeclusteringService::AliJetDeclusteringService():
+  TObject(),
+  fJetBranch(),
+  fTracks(nullptr),
+  fAlgorithm(kCA),
+  fGhostArea(0.),
+  fEvent(nullptr),
+  fEntry(-1),
+  fTrees(),
+  fNReclustered(0),
+  fNReused(0)
+{
+
+}
+
+AliJetDeclusteringService::AliJetDeclusteringService(const char *jetbranch, const AliParticleContainer *tracks, ReclusterAlgo_t algo, Double_t ghostArea):
+  TObject(),
+  fJetBranch(jetbranch),
+  fTracks(tracks),
+  fAlgorithm(algo),
+  fGhostArea(ghostArea),
+  fEvent(nullptr),
+  fEntry(-1),
+  fTrees(),
+  fNReclustered(0),
+  fNReused(0)
+{
+
+}
+
+AliJetDeclusteringService::~AliJetDeclusteringService() {
+  // The trees hold the cluster sequences, to be deleted before the service
+  Reset();
+}
+
+AliJetDeclusteringService *AliJetDeclusteringService::Get(const AliJetContainer *jets, ReclusterAlgo_t algo, Double_t ghostArea) {
+  if(!jets) return nullptr;
+  const AliParticleContainer *tracks = jets->GetParticleContainer();
+  std::string key = Form("%s:%s:%d:%g", jets->GetArrayName().Data(), tracks ? tracks->GetArrayName().Data() : "", algo, ghostArea);
+  auto found = gDeclusteringServices.find(key);
+  if(found != gDeclusteringServices.end()) return found->second.get();
+  AliInfoGeneralStream("AliJetDeclusteringService") << "Creating declustering service " << key << std::endl;
+  AliJetDeclusteringService *service = new AliJetDeclusteringService(jets->GetArrayName().Data(), tracks, algo, ghostArea);
+  gDeclusteringServices[key] = std::unique_ptr<AliJetDeclusteringService>(service);
+  return service;
+}
+
+void AliJetDeclusteringService::Reset() {
+  fTrees.clear();
+}
+
+void AliJetDeclusteringService::NewEvent(const AliVEvent *event) {
+  // The trees are keyed by the jet objects, which are reused from one event to
+  // the next, so they are only kept when the event is known to be the same
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  if(event != fEvent || entry != fEntry || entry < 0) Reset();
+  fEvent = event;
+  fEntry = entry;
+}
+
+const AliJetDeclusteringService::DeclusteringTree &AliJetDeclusteringService::GetTree(const AliEmcalJet *jet) {
+  auto found = fTrees.find(jet);
+  if(found != fTrees.end()) {
+    fNReused++;
+    return *(found->second);
+  }
+
+  // Same input as in the tasks, such that the trees are identical
+  std::vector<fastjet::PseudoJet> inputs;
+  if(fTracks) {
+    for(Int_t i = 0; i < jet->GetNumberOfTracks(); i++) {
+      AliVParticle *track = jet->TrackAt(i, fTracks->GetArray());
+      if(!track) continue;
+      fastjet::PseudoJet constituent(track->Px(), track->Py(), track->Pz(), track->E());
+      constituent.set_user_index(jet->TrackAt(i) + 100);
+      inputs.push_back(constituent);
+    }
+  }
+
+  fastjet::JetAlgorithm jetalgo(fastjet::cambridge_algorithm);
+  if(fAlgorithm == kKt) jetalgo = fastjet::kt_algorithm;
+  else if(fAlgorithm == kAntiKt) jetalgo = fastjet::antikt_algorithm;
+  fastjet::JetDefinition jetdef(jetalgo, 1., static_cast<fastjet::RecombinationScheme>(0), fastjet::BestFJ30);
+
+  DeclusteringTree *tree = new DeclusteringTree;
+  tree->fValid = kFALSE;
+  fTrees[jet] = std::unique_ptr<DeclusteringTree>(tree);
+  fNReclustered++;
+  if(!inputs.size()) return *tree;
+
+  try {
+    if(fGhostArea > 0.) {
+      // As in the tasks reclustering with area
+      fastjet::GhostedAreaSpec ghostspec(1, 1, fGhostArea);
+      fastjet::AreaDefinition areadef(fastjet::passive_area, ghostspec);
+      tree->fClusterSequence = std::unique_ptr<fastjet::ClusterSequence>(new fastjet::ClusterSequenceArea(inputs, jetdef, areadef));
+    } else {
+      tree->fClusterSequence = std::unique_ptr<fastjet::ClusterSequence>(new fastjet::ClusterSequence(inputs, jetdef));
+    }
+    std::vector<fastjet::PseudoJet> outputjets = tree->fClusterSequence->inclusive_jets(0);
+    if(!outputjets.size()) return *tree;
+    tree->fJet = outputjets[0];
+
+    fastjet::PseudoJet jj = tree->fJet, j1, j2;
+    while(jj.has_parents(j1, j2)) {
+      if(j1.perp() < j2.perp()) std::swap(j1, j2);
+      Splitting split;
+      split.fHarder = j1;
+      split.fSofter = j2;
+      tree->fPrimary.push_back(split);
+      jj = j1;
+    }
+    tree->fValid = kTRUE;
+  } catch (fastjet::Error &e) {
+    AliErrorStream() << "Fastjet error during reclustering: " << e.message() << std::endl;
+    tree->fPrimary.clear();
+  }
+  return *tree;
+}
+
+const fastjet::PseudoJet *AliJetDeclusteringService::GetReclusteredJet(const AliEmcalJet *jet) {
+  const DeclusteringTree &tree = GetTree(jet);
+  return tree.fValid ? &tree.fJet : nullptr;
+}
+
+const std::vector<AliJetDeclusteringService::Splitting> &AliJetDeclusteringService::GetPrimarySplittings(const AliEmcalJet *jet) {
+  return GetTree(jet).fPrimary;
+}
+
+Bool_t AliJetDeclusteringService::PassSoftDrop(const Splitting &split, Double_t zcut, Double_t beta, Double_t r0) const {
+  // Written as in the tasks for beta = 0 (z > zcut), to get the same decisions
+  if(beta == 0.) return split.Z() > zcut;
+  return split.Z() > zcut * TMath::Power(split.DeltaR() / r0, beta);
+}
+
+Int_t AliJetDeclusteringService::GetSoftDropSplitting(const AliEmcalJet *jet, Double_t zcut, Double_t beta, Double_t r0) {
+  const std::vector<Splitting> &splittings = GetPrimarySplittings(jet);
+  for(UInt_t i = 0; i < splittings.size(); i++) {
+    if(PassSoftDrop(splittings[i], zcut, beta, r0)) return i;
+  }
+  return -1;
+}
+
+std::vector<Int_t> AliJetDeclusteringService::GetIterativeSoftDropSplittings(const AliEmcalJet *jet, Double_t zcut, Double_t beta, Double_t r0, Int_t nmax) {
+  std::vector<Int_t> result;
+  const std::vector<Splitting> &splittings = GetPrimarySplittings(jet);
+  for(UInt_t i = 0; i < splittings.size(); i++) {
+    if(nmax >= 0 && (Int_t)result.size() >= nmax) break;
+    if(PassSoftDrop(splittings[i], zcut, beta, r0)) result.push_back(i);
+  }
+  return result;
+}
+
+std::vector<AliJetDeclusteringService::Splitting> AliJetDeclusteringService::GetRecursiveSoftDropSplittings(const AliEmcalJet *jet, Double_t zcut, Double_t beta, Double_t r0, Int_t nmax) {
+  std::vector<Splitting> result;
+  const fastjet::PseudoJet *reclustered = GetReclusteredJet(jet);
+  if(!reclustered) return result;
+
+  // Prongs still to be declustered, with the splitting they are declustered into.
+  // A prong failing the condition is replaced by its harder subjet, both subjets
+  // of a prong passing the condition are declustered further
+  std::vector<Splitting> prongs;
+  Splitting split;
+  fastjet::PseudoJet j1, j2;
+  if(reclustered->has_parents(j1, j2)) {
+    if(j1.perp() < j2.perp()) std::swap(j1, j2);
+    split.fHarder = j1;
+    split.fSofter = j2;
+    prongs.push_back(split);
+  }
+  while(prongs.size() && (nmax < 0 || (Int_t)result.size() < nmax)) {
+    // Splitting at the largest angle first
+    auto next = prongs.begin();
+    for(auto it = prongs.begin(); it != prongs.end(); ++it) {
+      if(it->DeltaR() > next->DeltaR()) next = it;
+    }
+    split = *next;
+    prongs.erase(next);
+    std::vector<fastjet::PseudoJet> subjets;
+    if(PassSoftDrop(split, zcut, beta, r0)) {
+      result.push_back(split);
+      subjets.push_back(split.fHarder);
+      subjets.push_back(split.fSofter);
+    } else {
+      subjets.push_back(split.fHarder);
+    }
+    for(auto &subjet : subjets) {
+      if(!subjet.has_parents(j1, j2)) continue;
+      if(j1.perp() < j2.perp()) std::swap(j1, j2);
+      Splitting child;
+      child.fHarder = j1;
+      child.fSofter = j2;
+      prongs.push_back(child);
+    }
+  }
+  return result;
+}
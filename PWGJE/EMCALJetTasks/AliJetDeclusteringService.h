@@ -0,0 +1,262 @@
+/************************************************************************************
+ * Copyright (C) 2019, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef __ALIJETDECLUSTERINGSERVICE_H__
+#define __ALIJETDECLUSTERINGSERVICE_H__
+#include <TObject.h>
+#include <TString.h>
+#include <map>
+#include <memory>
+#include <vector>
+#include "fastjet/PseudoJet.hh"
+
+class AliEmcalJet;
+class AliJetContainer;
+class AliParticleContainer;
+class AliVEvent;
+
+namespace fastjet {
+class ClusterSequence;
+}
+
+namespace PWGJE {
+
+namespace EMCALJetTasks {
+
+/**
+ * @class AliJetDeclusteringService
+ * @brief Declustering trees of the jets of a jet container, shared by the substructure tasks
+ * @ingroup PWGJEBASE
+ * @since October 18, 2026
+ *
+ * The constituents of each jet are reclustered once per event with the
+ * Cambridge/Aachen (or kt, anti-kt) algorithm, R = 1, E-scheme, as the
+ * substructure tasks do by themselves. Tasks running on the same jet
+ * container in a train obtain the same service from Get() and query
+ * - the reclustered jet, to traverse the full cluster tree,
+ * - the primary Lund plane splittings, following the harder branch,
+ * - the iterative SoftDrop splittings among them,
+ * - the recursive SoftDrop splittings, following both branches.
+ *
+ * The input is identical to the one of the tasks (all track constituents,
+ * in the jet order, with user index TrackAt(i)+100), so the results are
+ * identical to a reclustering in the task. Tasks modifying the constituents
+ * (two-track cuts, added background) must still recluster by themselves.
+ * Trees with ghosts, for tasks reclustering with a passive area, are built
+ * by a separate service (ghost area argument of Get()). The ghosts are placed
+ * by the random generator of fastjet, so that these trees are equivalent,
+ * but not identical, to the ones of a reclustering in the task.
+ *
+ * Each task calls NewEvent() before querying the trees of an event, the trees
+ * are dropped when the event changes.
+ */
+class AliJetDeclusteringService : public TObject {
+public:
+
+  /**
+   * @brief Reclustering algorithms, numbering as in the substructure tasks
+   */
+  enum ReclusterAlgo_t {
+    kKt = 0,            ///< kt algorithm
+    kCA = 1,            ///< Cambridge/Aachen algorithm
+    kAntiKt = 2         ///< anti-kt algorithm
+  };
+
+  /**
+   * @struct Splitting
+   * @brief Splitting of a declustering sequence, subjets ordered in \f$p_{t}\f$
+   */
+  struct Splitting {
+    fastjet::PseudoJet    fHarder;      ///< Subjet with the higher \f$p_{t}\f$, declustered further along the primary branch
+    fastjet::PseudoJet    fSofter;      ///< Subjet with the lower \f$p_{t}\f$
+
+    /**
+     * @brief Momentum fraction of the softer subjet
+     * @return \f$z = p_{t,2}/(p_{t,2}+p_{t,1})\f$
+     */
+    Double_t Z() const { return fSofter.perp() / (fSofter.perp() + fHarder.perp()); }
+
+    /**
+     * @brief Opening angle between the subjets
+     * @return \f$\Delta R\f$
+     */
+    Double_t DeltaR() const { return fHarder.delta_R(fSofter); }
+  };
+
+  /**
+   * @brief Dummy constructor, for I/O purpose, services are obtained with Get()
+   */
+  AliJetDeclusteringService();
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~AliJetDeclusteringService();
+
+  /**
+   * @brief Get the service of a jet container, created at first request
+   *
+   * Services are shared by all the tasks using a jet container on the same
+   * jet branch, with the same particle branch, reclustering algorithm and
+   * ghost area.
+   *
+   * @param jets Jet container (with particle container)
+   * @param algo Reclustering algorithm
+   * @param ghostArea Area of the ghosts of a passive area reclustering (|y| < 1), 0 for no area
+   * @return Service (owned by the service registry)
+   */
+  static AliJetDeclusteringService *Get(const AliJetContainer *jets, ReclusterAlgo_t algo = kCA, Double_t ghostArea = 0.);
+
+  /**
+   * @brief Start a new event, to be called by each task before querying the trees of the event
+   *
+   * The trees are dropped when the event or the entry of the analysis manager
+   * differs from the one of the previous call. Without the entry (no analysis
+   * manager), the trees are always dropped, since a reused event object cannot
+   * be told apart from the previous event.
+   *
+   * @param event Input event of the task
+   */
+  void NewEvent(const AliVEvent *event);
+
+  /**
+   * @brief Get the reclustered jet, root of the cluster tree
+   * @param jet Jet of the container
+   * @return Reclustered jet, nullptr if the reclustering failed or the jet has no track constituent
+   */
+  const fastjet::PseudoJet *GetReclusteredJet(const AliEmcalJet *jet);
+
+  /**
+   * @brief Get the primary declustering sequence of a jet
+   *
+   * Declustering follows the harder subjet, starting from the reclustered jet.
+   *
+   * @param jet Jet of the container
+   * @return Splittings, first one at the largest angle for C/A
+   */
+  const std::vector<Splitting> &GetPrimarySplittings(const AliEmcalJet *jet);
+
+  /**
+   * @brief Get the SoftDrop splitting of a jet
+   *
+   * First primary splitting with \f$z > z_{cut} (\Delta R/R_{0})^{\beta}\f$. The
+   * index is also the number of splittings dropped.
+   *
+   * @param jet Jet of the container
+   * @param zcut \f$z_{cut}\f$
+   * @param beta \f$\beta\f$
+   * @param r0 \f$R_{0}\f$
+   * @return Index of the splitting in GetPrimarySplittings(), -1 if the jet is groomed away
+   */
+  Int_t GetSoftDropSplitting(const AliEmcalJet *jet, Double_t zcut, Double_t beta = 0., Double_t r0 = 1.);
+
+  /**
+   * @brief Get the iterative SoftDrop splittings of a jet
+   *
+   * All primary splittings passing the SoftDrop condition, in declustering order
+   *
+   * @param jet Jet of the container
+   * @param zcut \f$z_{cut}\f$
+   * @param beta \f$\beta\f$
+   * @param r0 \f$R_{0}\f$
+   * @param nmax Maximum number of splittings (-1: all)
+   * @return Indices of the splittings in GetPrimarySplittings()
+   */
+  std::vector<Int_t> GetIterativeSoftDropSplittings(const AliEmcalJet *jet, Double_t zcut, Double_t beta = 0., Double_t r0 = 1., Int_t nmax = -1);
+
+  /**
+   * @brief Get the recursive SoftDrop splittings of a jet
+   *
+   * Recursive SoftDrop (Dreyer, Necib, Soyez, Thaler, JHEP 06 (2018) 093): the
+   * softer branch of a splitting failing the SoftDrop condition is dropped and
+   * the harder one is declustered further, while both branches of a splitting
+   * passing the condition are declustered further. The prong with the largest
+   * opening angle of its next splitting is declustered first, until nmax
+   * splittings passed the condition.
+   *
+   * @param jet Jet of the container
+   * @param zcut \f$z_{cut}\f$
+   * @param beta \f$\beta\f$
+   * @param r0 \f$R_{0}\f$
+   * @param nmax Maximum number of splittings (-1: all, i.e. \f$N = \infty\f$)
+   * @return Splittings passing the SoftDrop condition, in declustering order
+   */
+  std::vector<Splitting> GetRecursiveSoftDropSplittings(const AliEmcalJet *jet, Double_t zcut, Double_t beta = 0., Double_t r0 = 1., Int_t nmax = -1);
+
+  /**
+   * @brief Get the number of jets reclustered
+   * @return Number of reclusterings done by the service
+   */
+  Long64_t GetNReclustered() const { return fNReclustered; }
+
+  /**
+   * @brief Get the number of requests served with an existing tree
+   * @return Number of reclusterings saved
+   */
+  Long64_t GetNReused() const { return fNReused; }
+
+  /**
+   * @brief Drop all the declustering trees of the current event
+   */
+  void Reset();
+
+private:
+
+  /**
+   * @struct DeclusteringTree
+   * @brief Cluster sequence of a jet, with its primary declustering sequence
+   */
+  struct DeclusteringTree {
+    std::unique_ptr<fastjet::ClusterSequence>  fClusterSequence;    ///< Cluster sequence, keeps the tree alive
+    fastjet::PseudoJet                         fJet;                ///< Reclustered jet
+    Bool_t                                     fValid;              ///< Reclustering successful
+    std::vector<Splitting>                     fPrimary;            ///< Primary declustering sequence
+  };
+
+  AliJetDeclusteringService(const char *jetbranch, const AliParticleContainer *tracks, ReclusterAlgo_t algo, Double_t ghostArea);
+  AliJetDeclusteringService(const AliJetDeclusteringService &);
+  AliJetDeclusteringService &operator=(const AliJetDeclusteringService &);
+
+  const DeclusteringTree &GetTree(const AliEmcalJet *jet);
+  Bool_t PassSoftDrop(const Splitting &split, Double_t zcut, Double_t beta, Double_t r0) const;
+
+  TString                                                    fJetBranch;          ///< Name of the jet branch
+  const AliParticleContainer                                *fTracks;             //!<! Container with the jet constituents
+  ReclusterAlgo_t                                            fAlgorithm;          ///< Reclustering algorithm
+  Double_t                                                   fGhostArea;          ///< Ghost area of the passive area reclustering, 0 for no area
+  const AliVEvent                                           *fEvent;              //!<! Event of the trees
+  Long64_t                                                   fEntry;              //!<! Entry of the event of the trees
+  std::map<const AliEmcalJet *, std::unique_ptr<DeclusteringTree>> fTrees;        //!<! Trees of the current event
+  Long64_t                                                   fNReclustered;       //!<! Number of reclusterings
+  Long64_t                                                   fNReused;            //!<! Number of reclusterings saved
+
+  ClassDef(AliJetDeclusteringService, 2);
+};
+
+}
+
+}
+#endif
@@ -0,0 +1,131 @@
+/**************************************************************************************
+ * Copyright (C) 2020, Copyright Holders of the ALICE Collaboration                   *
+ * All rights reserved.                                                               *
+ *                                                                                    *
+ * Redistribution and use in source and binary forms, with or without                 *
+ * modification, are permitted provided that the following conditions are met:        *
+ *     * Redistributions of source code must retain the above copyright               *
+ *       notice, this list of conditions and the following disclaimer.                *
+ *     * Redistributions in binary form must reproduce the above copyright            *
+ *       notice, this list of conditions and the following disclaimer in the          *
+ *       documentation and/or other materials provided with the distribution.         *
+ *     * Neither the name of the <organization> nor the                               *
+ *       names of its contributors may be used to endorse or promote products         *
+ *       derived from this software without specific prior written permission.        *
+ *                                                                                    *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND    *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED      *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE             *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY                *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES         *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;       *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND        *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT         *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS      *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                       *
+ **************************************************************************************/
+
+#include <TAxis.h>
+#include <TF1.h>
+#include <TH1.h>
+#include <TMath.h>
+#include <TMatrixDSym.h>
+#include <TString.h>
+#include <TVectorD.h>
+
+#include "AliRhoModulationFit.h"
+
+//_____________________________________________________________________________
+Bool_t AliRhoModulationFit::Fit(const TH1& histo, TF1* modulation, Int_t nFree, Double_t min, Double_t max, Bool_t unitWeights)
+{
+    // least squares estimate of the modulation parameters, see header for the parametrization
+    // on success the parameters, their errors, the chi2 and ndf of the modulation are set, as
+    // TH1::Fit would do, and kTRUE is returned. if the system cannot be solved, the modulation
+    // is left untouched and kFALSE is returned
+    if(!modulation || nFree < 0 || nFree > 2) return kFALSE;
+    if((nFree == 1 && modulation->GetNpar() < 5) || (nFree == 2 && modulation->GetNpar() < 8)) return kFALSE;
+    const Int_t nPar(nFree+1);
+    // fixed parameters of the modulation: constant, prefactor, harmonics and event plane angles
+    Double_t c0(0), c1(0), n1(0), psi1(0), n2(0), psi2(0);
+    if(nFree > 0) {
+        c0 = modulation->GetParameter(1);
+        c1 = modulation->GetParameter(2);
+        n1 = modulation->GetParameter(2);
+        psi1 = modulation->GetParameter(4);
+    }
+    if(nFree > 1) {
+        n2 = modulation->GetParameter(5);
+        psi2 = modulation->GetParameter(6);
+    }
+
+    // normal equations, A p = B
+    TMatrixDSym A(nPar);
+    TVectorD B(nPar);
+    Double_t g[3] = {0., 0., 0.};
+    Int_t nPoints(0);
+    for(Int_t i(1); i <= histo.GetNbinsX(); i++) {
+        Double_t x(histo.GetXaxis()->GetBinCenter(i));
+        if(x < min || x > max) continue;
+        Double_t y(histo.GetBinContent(i)), e(histo.GetBinError(i));
+        if(y == 0. && e == 0.) continue;        // empty bins are not used by the fit either
+        if(!unitWeights && e <= 0.) continue;
+        nPoints++;
+        if(nFree == 0) continue;
+        Double_t w(unitWeights ? 1. : 1./(e*e));
+        g[0] = c0;
+        g[1] = c1*TMath::Cos(n1*(x-psi1));
+        g[2] = c1*TMath::Cos(n2*(x-psi2));
+        for(Int_t j(0); j < nPar; j++) {
+            B(j) += w*g[j]*y;
+            for(Int_t k(0); k <= j; k++) A(j, k) += w*g[j]*g[k];
+        }
+    }
+    if(nPoints < nPar) return kFALSE;
+
+    if(nFree > 0) {
+        for(Int_t j(0); j < nPar; j++) for(Int_t k(0); k < j; k++) A(k, j) = A(j, k);
+        Double_t det(0);
+        A.Invert(&det);         // A now holds the covariance of (a, b, c)
+        if(det == 0.) return kFALSE;
+        TVectorD p(A*B);
+        Double_t a(p(0));
+        if(a == 0.) return kFALSE;
+        modulation->SetParameter(0, a);
+        modulation->SetParError(0, TMath::Sqrt(TMath::Max(A(0, 0), 0.)));
+        // vn = b/a and vn' = c/a, errors from linear propagation
+        const Int_t vnPar[2] = {3, 7};
+        for(Int_t j(1); j < nPar; j++) {
+            Double_t vn(p(j)/a);
+            Double_t var((A(j, j) - 2.*vn*A(0, j) + vn*vn*A(0, 0))/(a*a));
+            modulation->SetParameter(vnPar[j-1], vn);
+            modulation->SetParError(vnPar[j-1], TMath::Sqrt(TMath::Max(var, 0.)));
+        }
+    }
+
+    // goodness of fit. the chi2 is always computed with the bin errors, also for unit
+    // weights, as it is converted into a p-value by the tasks
+    Double_t chi2(0);
+    for(Int_t i(1); i <= histo.GetNbinsX(); i++) {
+        Double_t x(histo.GetXaxis()->GetBinCenter(i));
+        if(x < min || x > max) continue;
+        Double_t y(histo.GetBinContent(i)), e(histo.GetBinError(i));
+        if(e <= 0.) continue;
+        Double_t r(y - modulation->Eval(x));
+        chi2 += r*r/(e*e);
+    }
+    modulation->SetChisquare(chi2);
+    modulation->SetNumberFitPoints(nPoints);
+    modulation->SetNDF(nPoints - (nFree > 0 ? nPar : 0));
+    return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliRhoModulationFit::UnitWeights(const char* options)
+{
+    // translate the TH1::Fit options of the tasks into the weighting of the least squares:
+    // W alone sets all bin errors to 1 in a chi2 fit, while WL is the weighted likelihood fit
+    // for histograms filled with weights, approximated here by weighting with 1/error^2
+    TString opt(options);
+    opt.ToUpper();
+    return opt.Contains("W") && !opt.Contains("L");
+}
@@ -0,0 +1,57 @@
+/**************************************************************************************
+ * Copyright (C) 2020, Copyright Holders of the ALICE Collaboration                   *
+ * All rights reserved.                                                               *
+ *                                                                                    *
+ * Redistribution and use in source and binary forms, with or without                 *
+ * modification, are permitted provided that the following conditions are met:        *
+ *     * Redistributions of source code must retain the above copyright               *
+ *       notice, this list of conditions and the following disclaimer.                *
+ *     * Redistributions in binary form must reproduce the above copyright            *
+ *       notice, this list of conditions and the following disclaimer in the          *
+ *       documentation and/or other materials provided with the distribution.         *
+ *     * Neither the name of the <organization> nor the                               *
+ *       names of its contributors may be used to endorse or promote products         *
+ *       derived from this software without specific prior written permission.        *
+ *                                                                                    *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND    *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED      *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE             *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY                *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES         *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;       *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND        *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT         *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS      *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                       *
+ **************************************************************************************/
+#ifndef ALIRHOMODULATIONFIT_H
+#define ALIRHOMODULATIONFIT_H
+
+#include <Rtypes.h>
+
+class TF1;
+class TH1;
+
+// closed form estimate of the parameters of the rho(phi) modulation used by
+// AliAnalysisTaskLocalRho and AliAnalysisTaskJetV2, as an alternative to TH1::Fit
+//
+// with the event plane angles fixed, the modulation functions
+//   [0]*([1]+[2]*[3]*cos([2]*(x-[4])))                                  (kV2, kV3)
+//   [0]*([1]+[2]*([3]*cos([2]*(x-[4]))+[7]*cos([5]*(x-[6]))))           (kCombined)
+// are linear in a = [0], b = [0]*[3] and c = [0]*[7], so that the chi2 is minimized
+// by solving the normal equations of a weighted linear least squares problem.
+// the solution is the chi2 fit at the bin centers (TH1::Fit without the I option), which
+// approximates the likelihood fit of the L option for well populated bins
+class AliRhoModulationFit {
+    public:
+        // nFree: number of free flow coefficients of the modulation, 0 ([0] fixed, only
+        // the chi2 is evaluated), 1 ([0] and [3]) or 2 ([0], [3] and [7])
+        // unitWeights: all bins have weight 1 (as the W fit option without L), otherwise the
+        // bins are weighted with 1/error^2, which is also the chi2 approximation of the
+        // likelihood fit requested by the L option. see UnitWeights()
+        static Bool_t   Fit(const TH1& histo, TF1* modulation, Int_t nFree, Double_t min, Double_t max, Bool_t unitWeights);
+        // unit weights only for a pure W fit: WL is a weighted likelihood fit
+        static Bool_t   UnitWeights(const char* options);
+};
+
+#endif
@@ -146,6 +146,7 @@ class AliAnalysisTaskJetV2 : public AliAnalysisTaskEmcalJet {
         void                    SetExcludeJetsWithTrackPt(Float_t n)            {fExcludeJetsWithTrackPt = n; }
         void                    SetRebinSwapHistoOnTheFly(Bool_t r)             {fRebinSwapHistoOnTheFly = r; }
         void                    SetSaveThisPercentageOfFits(Float_t p)          {fPercentageOfFits = p; }
+        void                    SetUseLinearModulationFit(Bool_t l)             {fUseLinearModulationFit = l; }
         void                    SetChi2VZEROA(TArrayD* a)                       { fChi2A = a;}
         void                    SetChi2VZEROC(TArrayD* a)                       { fChi2C = a;}
         void                    SetChi3VZEROA(TArrayD* a)                       { fChi3A = a;}
@@ -336,6 +337,7 @@ class AliAnalysisTaskJetV2 : public AliAnalysisTaskEmcalJet {
         Float_t                 fExcludeJetsWithTrackPt;// exclude jets with a track with pt higher than this
         Bool_t                  fRebinSwapHistoOnTheFly;       // rebin swap histo on the fly
         Float_t                 fPercentageOfFits;      // save this percentage of fits
+        Bool_t                  fUseLinearModulationFit;// closed form least squares estimate of the modulation instead of TH1::Fit
         // transient object pointers
         TList*                  fOutputList;            //! output list
         TList*                  fOutputListGood;        //! output list for local analysis
@@ -451,7 +453,7 @@ class AliAnalysisTaskJetV2 : public AliAnalysisTaskEmcalJet {
         AliAnalysisTaskJetV2(const AliAnalysisTaskJetV2&);                  // not implemented
         AliAnalysisTaskJetV2& operator=(const AliAnalysisTaskJetV2&);       // not implemented
 
-        ClassDef(AliAnalysisTaskJetV2, 8);
+        ClassDef(AliAnalysisTaskJetV2, 9);
 };
 
 #endif
@@ -10,6 +10,7 @@
 #include "AliEmcalPythiaInfo.h"
 #include "AliGenPythiaEventHeader.h"
 #include "AliJetContainer.h"
+#include "AliJetDeclusteringService.h"
 #include "AliLog.h"
 #include "AliMCEvent.h"
 #include "AliParticleContainer.h"
@@ -59,7 +60,8 @@ ClassImp(AliAnalysisTaskNewJetSubstructure)
       fEtaCutValue(0.02), fMagFieldPolarity(1), fDerivSubtrOrder(0),
       fPtJet(0x0), fHLundIterative(0x0), fHLundIterativeMC(0x0),
       fHLundIterativeMCDet(0x0), fHCheckResolutionSubjets(0x0),
-  fStoreDetLevelJets(0), fTreeSubstructure(0), fDoSubJet(0)
+  fStoreDetLevelJets(0), fTreeSubstructure(0), fDoSubJet(0),
+  fUseDeclusteringService(kFALSE)
 
 {
   for (Int_t i = 0; i < 10; i++) {
@@ -84,7 +86,8 @@ AliAnalysisTaskNewJetSubstructure::AliAnalysisTaskNewJetSubstructure(
       fEtaCutValue(0.02), fMagFieldPolarity(1), fDerivSubtrOrder(0),
       fPtJet(0x0), fHLundIterative(0x0), fHLundIterativeMC(0x0),
       fHLundIterativeMCDet(0x0), fHCheckResolutionSubjets(0x0),
-      fStoreDetLevelJets(0), fTreeSubstructure(0), fDoSubJet(0)
+      fStoreDetLevelJets(0), fTreeSubstructure(0), fDoSubJet(0),
+      fUseDeclusteringService(kFALSE)
 
 {
   // Standard constructor.
@@ -771,46 +774,72 @@ void AliAnalysisTaskNewJetSubstructure::IterativeParentsAreaBased(
 void AliAnalysisTaskNewJetSubstructure::IterativeParents(
 							 AliEmcalJet *fJet, AliJetContainer *fJetCont,fastjet::PseudoJet *sub1,  fastjet::PseudoJet *sub2, std::vector < fastjet::PseudoJet > *const1, std::vector < fastjet::PseudoJet > *const2) {
 
-  std::vector<fastjet::PseudoJet> fInputVectors;
-  fInputVectors.clear();
-  fastjet::PseudoJet PseudoTracks;
-
-  AliParticleContainer *fTrackCont = fJetCont->GetParticleContainer();
-  if (fTrackCont)
-    for (Int_t i = 0; i < fJet->GetNumberOfTracks(); i++) {
-      AliVParticle *fTrk = fJet->TrackAt(i, fTrackCont->GetArray());
-      if (!fTrk)
-        continue;
-      if (fDoTwoTrack == kTRUE && CheckClosePartner(i, fJet, fTrk, fTrackCont))
-        continue;
-      PseudoTracks.reset(fTrk->Px(), fTrk->Py(), fTrk->Pz(), fTrk->E());
-      PseudoTracks.set_user_index(fJet->TrackAt(i) + 100);
-      fInputVectors.push_back(PseudoTracks);
-    }
-   fastjet::JetAlgorithm jetalgo(fastjet::cambridge_algorithm);
-   fastjet::JetDefinition fJetDef(jetalgo, 1.,
-                                 static_cast<fastjet::RecombinationScheme>(0),
-                                 fastjet::BestFJ30);
+  // the C/A tree with ghosts is either shared with the other tasks using the
+  // same jet container, or built here. with the two-track cut the constituents
+  // differ from the ones of the jet, and the tree is always built here
+  typedef PWGJE::EMCALJetTasks::AliJetDeclusteringService DeclusteringService;
+  std::unique_ptr<fastjet::ClusterSequenceArea> fClustSeqSA;
+  std::vector<DeclusteringService::Splitting> fOwnSplittings;
+  const std::vector<DeclusteringService::Splitting> *fSplittings = &fOwnSplittings;
+  double jetPt = 0;
 
-  
-  fastjet::GhostedAreaSpec ghost_spec(1, 1, 0.05);
-  // fastjet::JetAlgorithm jetalgo(fastjet::genkt_algorithm);
-  // fastjet::JetDefinition fJetDef(jetalgo, 1., fPowerAlgo,
-  //                              static_cast<fastjet::RecombinationScheme>(0),
-  //                             fastjet::BestFJ30);
-  fastjet::AreaDefinition fAreaDef(fastjet::passive_area, ghost_spec);
   try {
-    fastjet::ClusterSequenceArea fClustSeqSA(fInputVectors, fJetDef, fAreaDef);
-    std::vector<fastjet::PseudoJet> fOutputJets;
-    fOutputJets.clear();
-    fOutputJets = fClustSeqSA.inclusive_jets(0);
+    if (fUseDeclusteringService && !fDoTwoTrack) {
+      DeclusteringService *service = DeclusteringService::Get(fJetCont, DeclusteringService::kCA, 0.05);
+      service->NewEvent(InputEvent());
+      const fastjet::PseudoJet *reclustered = service->GetReclusteredJet(fJet);
+      if (!reclustered)
+        return;
+      jetPt = reclustered->perp();
+      fSplittings = &(service->GetPrimarySplittings(fJet));
+    } else {
+      std::vector<fastjet::PseudoJet> fInputVectors;
+      fastjet::PseudoJet PseudoTracks;
+
+      AliParticleContainer *fTrackCont = fJetCont->GetParticleContainer();
+      if (fTrackCont)
+        for (Int_t i = 0; i < fJet->GetNumberOfTracks(); i++) {
+          AliVParticle *fTrk = fJet->TrackAt(i, fTrackCont->GetArray());
+          if (!fTrk)
+            continue;
+          if (fDoTwoTrack == kTRUE && CheckClosePartner(i, fJet, fTrk, fTrackCont))
+            continue;
+          PseudoTracks.reset(fTrk->Px(), fTrk->Py(), fTrk->Pz(), fTrk->E());
+          PseudoTracks.set_user_index(fJet->TrackAt(i) + 100);
+          fInputVectors.push_back(PseudoTracks);
+        }
+      fastjet::JetAlgorithm jetalgo(fastjet::cambridge_algorithm);
+      fastjet::JetDefinition fJetDef(jetalgo, 1.,
+                                     static_cast<fastjet::RecombinationScheme>(0),
+                                     fastjet::BestFJ30);
+
+      fastjet::GhostedAreaSpec ghost_spec(1, 1, 0.05);
+      // fastjet::JetAlgorithm jetalgo(fastjet::genkt_algorithm);
+      // fastjet::JetDefinition fJetDef(jetalgo, 1., fPowerAlgo,
+      //                              static_cast<fastjet::RecombinationScheme>(0),
+      //                             fastjet::BestFJ30);
+      fastjet::AreaDefinition fAreaDef(fastjet::passive_area, ghost_spec);
+      fClustSeqSA.reset(new fastjet::ClusterSequenceArea(fInputVectors, fJetDef, fAreaDef));
+      std::vector<fastjet::PseudoJet> fOutputJets;
+      fOutputJets = fClustSeqSA->inclusive_jets(0);
+      jetPt = fOutputJets[0].perp();
+
+      fastjet::PseudoJet jj = fOutputJets[0], j1, j2;
+      while (jj.has_parents(j1, j2)) {
+        if (j1.perp() < j2.perp())
+          swap(j1, j2);
+        DeclusteringService::Splitting split;
+        split.fHarder = j1;
+        split.fSofter = j2;
+        fOwnSplittings.push_back(split);
+        jj = j1;
+      }
+    }
 
-    fastjet::PseudoJet jj;
     fastjet::PseudoJet j1;
     fastjet::PseudoJet j2;
     fastjet::PseudoJet j1first;
     fastjet::PseudoJet j2first;
-    jj = fOutputJets[0];
 
     double nall = 0;
     double nsd = 0;
@@ -821,11 +850,11 @@ void AliAnalysisTaskNewJetSubstructure::IterativeParents(
     double zg = 0;
     double xktg = 0;
     double cumtf = 0;
-    while (jj.has_parents(j1, j2)) {
+    for (UInt_t isplit = 0; isplit < fSplittings->size(); isplit++) {
       nall = nall + 1;
 
-      if (j1.perp() < j2.perp())
-        swap(j1, j2);
+      j1 = (*fSplittings)[isplit].fHarder;
+      j2 = (*fSplittings)[isplit].fSofter;
       flagConst=0;
       double delta_R = j1.delta_R(j2);
       double xkt = j2.perp() * sin(delta_R);
@@ -859,10 +888,8 @@ void AliAnalysisTaskNewJetSubstructure::IterativeParents(
       }
 
       Double_t LundEntries[8] = {
-	y, lnpt_rel, fOutputJets[0].perp(), nall, form, rad, cumtf,flagConst};
+	y, lnpt_rel, jetPt, nall, form, rad, cumtf,flagConst};
       fHLundIterative->Fill(LundEntries);
-
-      jj = j1;
     }
     if (sub1->has_constituents()) *const1 = sub1->constituents();
     if (sub2->has_constituents()) *const2 = sub2->constituents();
@@ -884,42 +911,67 @@ void AliAnalysisTaskNewJetSubstructure::IterativeParentsMCAverage(
     AliEmcalJet *fJet, Int_t km, Double_t &average1, Double_t &average2,
     Double_t &average3, Double_t &average4, fastjet::PseudoJet *sub1,  fastjet::PseudoJet *sub2, std::vector < fastjet::PseudoJet > *const1, std::vector < fastjet::PseudoJet > *const2) {
   AliJetContainer *jetCont = GetJetContainer(km);
-  std::vector<fastjet::PseudoJet> fInputVectors;
-  fInputVectors.clear();
-  fastjet::PseudoJet PseudoTracks;
-
-  AliParticleContainer *fTrackCont = jetCont->GetParticleContainer();
-  
-  if (fTrackCont)
-    for (Int_t i = 0; i < fJet->GetNumberOfTracks(); i++) {
-      AliVParticle *fTrk = fJet->TrackAt(i, fTrackCont->GetArray());
-      if (!fTrk)
-        continue;
-
-      PseudoTracks.reset(fTrk->Px(), fTrk->Py(), fTrk->Pz(), fTrk->E());
-      PseudoTracks.set_user_index(fJet->TrackAt(i) + 100);
-      fInputVectors.push_back(PseudoTracks);
-    }
-  fastjet::JetAlgorithm jetalgo(fastjet::cambridge_algorithm);
-
-  fastjet::JetDefinition fJetDef(jetalgo, 1.,
-                                 static_cast<fastjet::RecombinationScheme>(0),
-                                 fastjet::BestFJ30);
 
+  // the C/A tree is either shared with the other tasks using the same jet
+  // container, or built here; both give the same declustering sequence
+  typedef PWGJE::EMCALJetTasks::AliJetDeclusteringService DeclusteringService;
+  std::unique_ptr<fastjet::ClusterSequence> fClustSeqSA;
+  std::vector<DeclusteringService::Splitting> fOwnSplittings;
+  const std::vector<DeclusteringService::Splitting> *fSplittings = &fOwnSplittings;
+  double jetPt = 0;
 
   try {
-    fastjet::ClusterSequence fClustSeqSA(fInputVectors, fJetDef);
-    std::vector<fastjet::PseudoJet> fOutputJets;
-    fOutputJets.clear();
-    fOutputJets = fClustSeqSA.inclusive_jets(0);
+    if (fUseDeclusteringService) {
+      DeclusteringService *service = DeclusteringService::Get(jetCont, DeclusteringService::kCA);
+      service->NewEvent(InputEvent());
+      const fastjet::PseudoJet *reclustered = service->GetReclusteredJet(fJet);
+      if (!reclustered)
+        return;
+      jetPt = reclustered->perp();
+      fSplittings = &(service->GetPrimarySplittings(fJet));
+    } else {
+      std::vector<fastjet::PseudoJet> fInputVectors;
+      fastjet::PseudoJet PseudoTracks;
+
+      AliParticleContainer *fTrackCont = jetCont->GetParticleContainer();
+
+      if (fTrackCont)
+        for (Int_t i = 0; i < fJet->GetNumberOfTracks(); i++) {
+          AliVParticle *fTrk = fJet->TrackAt(i, fTrackCont->GetArray());
+          if (!fTrk)
+            continue;
 
+          PseudoTracks.reset(fTrk->Px(), fTrk->Py(), fTrk->Pz(), fTrk->E());
+          PseudoTracks.set_user_index(fJet->TrackAt(i) + 100);
+          fInputVectors.push_back(PseudoTracks);
+        }
+      fastjet::JetAlgorithm jetalgo(fastjet::cambridge_algorithm);
+
+      fastjet::JetDefinition fJetDef(jetalgo, 1.,
+                                     static_cast<fastjet::RecombinationScheme>(0),
+                                     fastjet::BestFJ30);
+
+      fClustSeqSA.reset(new fastjet::ClusterSequence(fInputVectors, fJetDef));
+      std::vector<fastjet::PseudoJet> fOutputJets;
+      fOutputJets = fClustSeqSA->inclusive_jets(0);
+      jetPt = fOutputJets[0].perp();
+
+      fastjet::PseudoJet jj = fOutputJets[0], j1, j2;
+      while (jj.has_parents(j1, j2)) {
+        if (j1.perp() < j2.perp())
+          swap(j1, j2);
+        DeclusteringService::Splitting split;
+        split.fHarder = j1;
+        split.fSofter = j2;
+        fOwnSplittings.push_back(split);
+        jj = j1;
+      }
+    }
 
-    fastjet::PseudoJet jj;
     fastjet::PseudoJet j1;
     fastjet::PseudoJet j2;
     fastjet::PseudoJet j1first;
     fastjet::PseudoJet j2first;
-    jj = fOutputJets[0];
     int flagSubjet = 0;
     int flagSubjetkT = 0;
     double nall = 0;
@@ -930,11 +982,10 @@ void AliAnalysisTaskNewJetSubstructure::IterativeParentsMCAverage(
     double Rg = 0;
 
     double cumtf = 0;
-    while (jj.has_parents(j1, j2)) {
+    for (UInt_t isplit = 0; isplit < fSplittings->size(); isplit++) {
       nall = nall + 1;
-      if (j1.perp() < j2.perp())
-        swap(j1, j2);
-      std::vector<fastjet::PseudoJet> v1 = j1.constituents();
+      j1 = (*fSplittings)[isplit].fHarder;
+      j2 = (*fSplittings)[isplit].fSofter;
       double delta_R = j1.delta_R(j2);
       double xkt = j2.perp() * sin(delta_R);
       double lnpt_rel = log(xkt);
@@ -963,14 +1014,12 @@ void AliAnalysisTaskNewJetSubstructure::IterativeParentsMCAverage(
       }
       if (fDoFillMCLund == kTRUE) {
         Double_t LundEntries[7] = {
-            y, lnpt_rel, fOutputJets[0].perp(), nall, form, rad, cumtf};
+            y, lnpt_rel, jetPt, nall, form, rad, cumtf};
         fHLundIterativeMC->Fill(LundEntries);
         if (fStoreDetLevelJets) {
           fHLundIterativeMCDet->Fill(LundEntries);
         }
       }
-
-      jj = j1;
     }
 
     average1 = xktg;
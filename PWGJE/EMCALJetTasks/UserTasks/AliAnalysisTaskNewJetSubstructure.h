@@ -58,6 +58,7 @@ public:
   void SetMinPtConst(Float_t t) { fMinPtConst = t;}
   void SetHardCutoff(Float_t t) { fHardCutoff = t; }
   void SetDoTwoTrack(Bool_t t) { fDoTwoTrack = t; }
+  void SetUseDeclusteringService(Bool_t t) { fUseDeclusteringService = t; }
   void SetCutDoubleCounts(Bool_t t) {fCutDoubleCounts = t;}
   void SetDoAreaIterative(Bool_t t) { fDoAreaIterative = t; }
   void SetPowerAlgorithm(Float_t t) { fPowerAlgo = t; }
@@ -117,6 +118,7 @@ protected:
   Int_t fDerivSubtrOrder;
   Bool_t fStoreDetLevelJets; // store the detector level jet quantities
   Bool_t fDoSubJet; // store the detector level jet quantities
+  Bool_t fUseDeclusteringService; // take the declustering trees from the shared AliJetDeclusteringService (not with the two-track cut)
 
 
   TH1F *fPtJet;
@@ -137,6 +139,6 @@ private:
   AliAnalysisTaskNewJetSubstructure &
   operator=(const AliAnalysisTaskNewJetSubstructure &); // not implemented
 
-  ClassDef(AliAnalysisTaskNewJetSubstructure, 8)
+  ClassDef(AliAnalysisTaskNewJetSubstructure, 9)
 };
 #endif
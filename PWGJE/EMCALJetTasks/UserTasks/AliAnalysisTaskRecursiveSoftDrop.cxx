@@ -38,6 +38,7 @@
 #include "AliMCEvent.h"
 #include "AliAnalysisManager.h"
 #include "AliJetContainer.h"
+#include "AliJetDeclusteringService.h"
 #include "AliParticleContainer.h"
 //#include "AliPythiaInfo.h"
 #include "TRandom3.h"
@@ -75,7 +76,8 @@ AliAnalysisTaskRecursiveSoftDrop::AliAnalysisTaskRecursiveSoftDrop() :
   fAddMedScat(kFALSE),
   fAddMedScatPtFrac(1),
   fAddMedScatN(100),
-  fDoSubJetAreaSub(kFALSE)
+  fDoSubJetAreaSub(kFALSE),
+  fUseDeclusteringService(kFALSE)
 
 {
   for(Int_t i=0;i<5;i++){
@@ -109,7 +111,8 @@ AliAnalysisTaskRecursiveSoftDrop::AliAnalysisTaskRecursiveSoftDrop(const char *n
   fAddMedScat(kFALSE),
   fAddMedScatPtFrac(1),
   fAddMedScatN(100),
-  fDoSubJetAreaSub(kFALSE)
+  fDoSubJetAreaSub(kFALSE),
+  fUseDeclusteringService(kFALSE)
 
 {
   // Standard constructor.
@@ -335,6 +338,20 @@ Bool_t AliAnalysisTaskRecursiveSoftDrop::FillHistograms()
 
 //_________________________________________________________________________
 void AliAnalysisTaskRecursiveSoftDrop::RecursiveParents(AliEmcalJet *fJet,AliJetContainer *fJetCont,Bool_t bTruth){
+  // the tree of the jet constituents is shared with the other tasks using the same jet container
+  typedef PWGJE::EMCALJetTasks::AliJetDeclusteringService DeclusteringService;
+  if(fUseDeclusteringService && !fAddMedScat && fReclusteringAlgo>=0 && fReclusteringAlgo<=2){
+    DeclusteringService *service = DeclusteringService::Get(fJetCont, static_cast<DeclusteringService::ReclusterAlgo_t>(fReclusteringAlgo));
+    service->NewEvent(InputEvent());
+    try {
+      const fastjet::PseudoJet *reclustered = service->GetReclusteredJet(fJet);
+      if(reclustered) FillRecursiveParents(*reclustered,bTruth);
+    } catch (fastjet::Error) {
+      AliError(" [w] FJ Exception caught.");
+    }
+    return;
+  }
+
   std::vector<fastjet::PseudoJet>  fInputVectors;
   fInputVectors.clear();
   fastjet::PseudoJet  PseudoTracks;
@@ -384,48 +401,52 @@ void AliAnalysisTaskRecursiveSoftDrop::RecursiveParents(AliEmcalJet *fJet,AliJet
     std::vector<fastjet::PseudoJet>   fOutputJets;
     fOutputJets.clear();
     fOutputJets=fClustSeqSA.inclusive_jets(0);
+    FillRecursiveParents(fOutputJets[0],bTruth);
+
+  } catch (fastjet::Error) {
+    AliError(" [w] FJ Exception caught.");
+    //return -1;
+  }
+  return;
+}
 
-    fastjet::PseudoJet jj;
-    fastjet::PseudoJet j1;
-    fastjet::PseudoJet j2;
-    jj=fOutputJets[0];
-    Int_t n = 0;
-    Double_t jet_pT=jj.perp();
-    while(jj.has_parents(j1,j2)){
-      n++;
-      double area1 = j1.area();
-      double area2 = j2.area();
-      if((j1.perp()-area1*GetRhoVal(0)) < (j2.perp()-area2*GetRhoVal(0))) swap(j1,j2);
-      area1 = j1.area();
-      area2 = j2.area();
-      double delta_R=j1.delta_R(j2);
-      double z = 0;
-      if(fJetShapeSub==kNoSub && fDoSubJetAreaSub == kTRUE) z = (j2.perp()-area2*GetRhoVal(0))/((j1.perp()-area1*GetRhoVal(0))+(j2.perp()-area2*GetRhoVal(0)));
-      else z=j2.perp()/(j1.perp()+j2.perp());
-      if(bTruth) {
+//_________________________________________________________________________
+void AliAnalysisTaskRecursiveSoftDrop::FillRecursiveParents(const fastjet::PseudoJet &jet,Bool_t bTruth){
+  fastjet::PseudoJet jj;
+  fastjet::PseudoJet j1;
+  fastjet::PseudoJet j2;
+  jj=jet;
+  Int_t n = 0;
+  Double_t jet_pT=jj.perp();
+  while(jj.has_parents(j1,j2)){
+    n++;
+    double area1 = j1.area();
+    double area2 = j2.area();
+    if((j1.perp()-area1*GetRhoVal(0)) < (j2.perp()-area2*GetRhoVal(0))) swap(j1,j2);
+    area1 = j1.area();
+    area2 = j2.area();
+    double delta_R=j1.delta_R(j2);
+    double z = 0;
+    if(fJetShapeSub==kNoSub && fDoSubJetAreaSub == kTRUE) z = (j2.perp()-area2*GetRhoVal(0))/((j1.perp()-area1*GetRhoVal(0))+(j2.perp()-area2*GetRhoVal(0)));
+    else z=j2.perp()/(j1.perp()+j2.perp());
+    if(bTruth) {
 	fShapesVar_True[0]=jet_pT;
 	fShapesVar_True[1]=z;
 	fShapesVar_True[2]=delta_R;
 	fShapesVar_True[3]=n;
 	fShapesVar_True[4]=jj.perp();
 	fTreeRecursive_True->Fill();
-      }
-      else {
+    }
+    else {
 	fShapesVar_Det[0]=jet_pT;
 	fShapesVar_Det[1]=z;
 	fShapesVar_Det[2]=delta_R;
 	fShapesVar_Det[3]=n;
 	fShapesVar_Det[4]=jj.perp();
 	fTreeRecursive_Det->Fill();
-      }
-      jj=j1;
     }
-
-  } catch (fastjet::Error) {
-    AliError(" [w] FJ Exception caught.");
-    //return -1;
+    jj=j1;
   }
-  return;
 }
 
 
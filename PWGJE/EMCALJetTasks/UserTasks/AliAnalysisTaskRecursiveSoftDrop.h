@@ -51,6 +51,7 @@ class AliAnalysisTaskRecursiveSoftDrop : public AliAnalysisTaskEmcalJet {
   void SetReclusterAlgo(Int_t a)                            { fReclusteringAlgo = a;}
   void AddMedScat(Bool_t b, Float_t f,Int_t n)              { fAddMedScat = b; fAddMedScatPtFrac = f; fAddMedScatN = n;}
   void DoSubJetAreaSub(Bool_t b)                            { fDoSubJetAreaSub = b;}
+  void SetUseDeclusteringService(Bool_t b)                  { fUseDeclusteringService = b;}
 
   static AliAnalysisTaskRecursiveSoftDrop* AddTaskRecursiveSoftDrop(
 
@@ -82,6 +83,7 @@ class AliAnalysisTaskRecursiveSoftDrop : public AliAnalysisTaskEmcalJet {
   Bool_t                              Run();
   Bool_t                              FillHistograms();
   void                                RecursiveParents(AliEmcalJet *fJet,AliJetContainer *fJetCont,Bool_t bTruth);
+  void                                FillRecursiveParents(const fastjet::PseudoJet &jet,Bool_t bTruth);
 
   
   Int_t                               fContainer;              // jets to be analyzed 0 for Base, 1 for subtracted. 
@@ -101,6 +103,7 @@ class AliAnalysisTaskRecursiveSoftDrop : public AliAnalysisTaskEmcalJet {
   Float_t                             fAddMedScatN;
   Bool_t                              fAddMedScat;
   Bool_t                              fDoSubJetAreaSub;
+  Bool_t                              fUseDeclusteringService;      // take the trees from the shared AliJetDeclusteringService (not with added scattering centres)
   
   TH1F                                *fhJetPt;
   TH1F                                *fhJetPhi;
@@ -114,7 +117,7 @@ class AliAnalysisTaskRecursiveSoftDrop : public AliAnalysisTaskEmcalJet {
   AliAnalysisTaskRecursiveSoftDrop(const AliAnalysisTaskRecursiveSoftDrop&);            // not implemented
   AliAnalysisTaskRecursiveSoftDrop &operator=(const AliAnalysisTaskRecursiveSoftDrop&); // not implemented
 
-  ClassDef(AliAnalysisTaskRecursiveSoftDrop, 1)
+  ClassDef(AliAnalysisTaskRecursiveSoftDrop, 2)
 };
 #endif
 
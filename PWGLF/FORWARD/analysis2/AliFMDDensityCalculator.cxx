@@ -60,7 +60,15 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fUseWeightTable(false),
+    fWeightTableNPoints(4001),
+    fWeightTableMin(0),
+    fWeightTableMax(10),
+    fWeightTableTolerance(1e-3),
+    fWeightTableOffset(0),
+    fWeightTable(0),
+    fWeightTableError(0)
 {
   // 
   // Constructor 
@@ -98,7 +106,15 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fUseWeightTable(false),
+    fWeightTableNPoints(4001),
+    fWeightTableMin(0),
+    fWeightTableMax(10),
+    fWeightTableTolerance(1e-3),
+    fWeightTableOffset(0),
+    fWeightTable(0),
+    fWeightTableError(0)
 {
   // 
   // Constructor 
@@ -167,7 +183,15 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fDoTiming(o.fDoTiming),
     fHTiming(o.fHTiming), 
   fMaxOutliers(o.fMaxOutliers),
-  fOutlierCut(o.fOutlierCut)
+  fOutlierCut(o.fOutlierCut),
+  fUseWeightTable(o.fUseWeightTable),
+  fWeightTableNPoints(o.fWeightTableNPoints),
+  fWeightTableMin(o.fWeightTableMin),
+  fWeightTableMax(o.fWeightTableMax),
+  fWeightTableTolerance(o.fWeightTableTolerance),
+  fWeightTableOffset(o.fWeightTableOffset),
+  fWeightTable(o.fWeightTable),
+  fWeightTableError(o.fWeightTableError)
 {
   // 
   // Copy constructor 
@@ -232,6 +256,14 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fHTiming            = o.fHTiming;
   fMaxOutliers        = o.fMaxOutliers;
   fOutlierCut         = o.fOutlierCut;
+  fUseWeightTable       = o.fUseWeightTable;
+  fWeightTableNPoints   = o.fWeightTableNPoints;
+  fWeightTableMin       = o.fWeightTableMin;
+  fWeightTableMax       = o.fWeightTableMax;
+  fWeightTableTolerance = o.fWeightTableTolerance;
+  fWeightTableOffset    = o.fWeightTableOffset;
+  fWeightTable          = o.fWeightTable;
+  fWeightTableError     = o.fWeightTableError;
 
   fRingHistos.Delete();
   TIter    next(&o.fRingHistos);
@@ -771,6 +803,130 @@ AliFMDDensityCalculator::CacheMaxWeights(const TAxis& axis)
 
   // Cache cuts in histogram
   fCuts.FillHistogram(fLowCuts);
+
+  if (fUseWeightTable) CacheWeightTables(cor, nEta);
+}
+
+//_____________________________________________________________________
+void
+AliFMDDensityCalculator::CacheWeightTables(const AliFMDCorrELossFit* cor,
+					   Int_t nEta)
+{
+  // 
+  // Tabulate the weighted mean number of particles for all rings and
+  // eta bins with a good fit.  The table of a bin is dropped if the
+  // linear interpolation deviates by more than the tolerance from the
+  // exact evaluation at the mid-point between any two nodes.
+  // 
+  // Parameters:
+  //    cor   Correction
+  //    nEta  Number of eta bins 
+  //
+  DGUARD(fDebug, 2, "Cache weight tables in FMD density calculator");
+  const Int_t    nRing = 5;
+  const Int_t    nPts  = fWeightTableNPoints;
+  const Double_t dx    = (fWeightTableMax-fWeightTableMin) / (nPts-1);
+  if (dx <= 0) { 
+    AliWarning(Form("Invalid weight table range [%f,%f], using exact "
+		    "evaluation", fWeightTableMin, fWeightTableMax));
+    fWeightTableOffset.Set(0);
+    fWeightTable.Set(0);
+    return;
+  }
+  
+  fWeightTableOffset.Set(nRing*nEta);
+  fWeightTableOffset.Reset(-1);
+  fWeightTableError.Set(nRing);
+  fWeightTableError.Reset(0);
+
+  // First count the bins with a fit, so we allocate only once 
+  Int_t nTables = 0;
+  for (Int_t q = 0; q < nRing; q++) { 
+    UShort_t d = (q == 0 ? 1 : (q+1)/2+1);
+    Char_t   r = (q == 0 || q % 2 == 1 ? 'I' : 'O');
+    for (Int_t i = 0; i < nEta; i++) { 
+      if (GetMaxWeight(d, r, i) < 1)       continue;
+      if (!cor->FindFit(d, r, i+1, -1))    continue;
+      fWeightTableOffset[q*nEta+i] = nTables * nPts;
+      nTables++;
+    }
+  }
+  fWeightTable.Set(nTables * nPts);
+
+  Int_t nRejected = 0;
+  for (Int_t q = 0; q < nRing; q++) { 
+    UShort_t d = (q == 0 ? 1 : (q+1)/2+1);
+    Char_t   r = (q == 0 || q % 2 == 1 ? 'I' : 'O');
+    for (Int_t i = 0; i < nEta; i++) { 
+      Int_t off = fWeightTableOffset[q*nEta+i];
+      if (off < 0) continue;
+
+      AliFMDCorrELossFit::ELossFit* fit = cor->FindFit(d, r, i+1, -1);
+      UShort_t n   = TMath::Min(fMaxParticles, 
+				UShort_t(GetMaxWeight(d, r, i)));
+      Double_t* t  = &(fWeightTable.fArray[off]);
+      for (Int_t k = 0; k < nPts; k++) 
+	t[k] = fit->EvaluateWeighted(fWeightTableMin + k * dx, n);
+
+      // Check the interpolation where the error is largest 
+      Double_t maxErr = 0;
+      for (Int_t k = 0; k < nPts-1; k++) { 
+	Double_t x   = fWeightTableMin + (k + .5) * dx;
+	Double_t err = TMath::Abs(.5*(t[k]+t[k+1]) - 
+				  fit->EvaluateWeighted(x, n));
+	maxErr       = TMath::Max(maxErr, err);
+      }
+      if (maxErr > fWeightTableTolerance) { 
+	// Leave the (unused) storage, but fall back to exact evaluation
+	fWeightTableOffset[q*nEta+i] = -1;
+	nRejected++;
+	continue;
+      }
+      fWeightTableError[q] = TMath::Max(fWeightTableError[q], maxErr);
+    }
+  }
+  AliInfo(Form("Tabulated weights in %d of %d eta bins with %d nodes in "
+	       "[%f,%f], %d bins use exact evaluation", nTables-nRejected, 
+	       nTables, nPts, fWeightTableMin, fWeightTableMax, nRejected));
+}
+
+//_____________________________________________________________________
+Bool_t
+AliFMDDensityCalculator::LookupNParticles(Float_t  mult, 
+					  UShort_t d, 
+					  Char_t   r, 
+					  Int_t    iEta, 
+					  Double_t& ret) const
+{
+  // 
+  // Look up the number of particles in the table 
+  // 
+  // Parameters:
+  //    mult  Signal 
+  //    d     Detector
+  //    r     Ring 
+  //    iEta  Eta bin (0 based) 
+  //    ret   On return, the number of particles 
+  // 
+  // Return:
+  //    false if there's no table for the bin, or the signal is
+  //    outside the table
+  //
+  if (mult < fWeightTableMin || mult >= fWeightTableMax) return false;
+  Int_t nEta = fWeightTableOffset.fN / 5;
+  if (iEta < 0 || iEta >= nEta) return false;
+
+  Int_t q   = (d == 1 ? 0 : (d - 2) * 2 + 1 + (r=='I' || r=='i' ? 0 : 1));
+  Int_t off = fWeightTableOffset.fArray[q*nEta+iEta];
+  if (off < 0) return false;
+
+  Double_t u  = ((mult - fWeightTableMin) * (fWeightTableNPoints - 1) / 
+		 (fWeightTableMax - fWeightTableMin));
+  Int_t    k  = TMath::Min(Int_t(u), fWeightTableNPoints - 2);
+  Double_t f  = u - k;
+  const Double_t* t = &(fWeightTable.fArray[off]);
+  ret = (1 - f) * t[k] + f * t[k+1];
+  return true;
 }
 
 //_____________________________________________________________________
@@ -864,6 +1020,19 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   if (lowFlux) return 1;
   
   AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
+  Double_t ret = 0;
+  if (fUseWeightTable && 
+      LookupNParticles(mult, d, r, fcm.GetELossFit()->FindEtaBin(eta)-1, ret)) {
+    if (fDebug > 10) {
+      AliInfo(Form("FMD%d%c, eta=%7.4f, %8.5f -> %8.5f (table)", 
+		   d, r, eta, mult, ret));
+    }
+    fWeightedSum->Fill(ret);
+    fSumOfWeights->Fill(ret);
+  
+    return ret;
+  }
+
   AliFMDCorrELossFit::ELossFit* fit = fcm.GetELossFit()->FindFit(d,r,eta, -1);
   if (!fit) { 
     AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
@@ -878,7 +1047,7 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   }
   
   UShort_t n   = TMath::Min(fMaxParticles, UShort_t(m));
-  Double_t ret = fit->EvaluateWeighted(mult, n);
+  ret          = fit->EvaluateWeighted(mult, n);
   
   if (fDebug > 10) {
     AliInfo(Form("FMD%d%c, eta=%7.4f, %8.5f -> %8.5f", d, r, eta, mult, ret));
@@ -1120,6 +1289,7 @@ AliFMDDensityCalculator::CreateOutputObjects(TList* dir)
   d->Add(AliForwardUtil::MakeParameter("maxOutliers",  fMaxOutliers));
   d->Add(AliForwardUtil::MakeParameter("outlierCut",   fOutlierCut));
   d->Add(AliForwardUtil::MakeParameter("hitThreshold", fHitThreshold));
+  d->Add(AliForwardUtil::MakeParameter("weightTable",  fUseWeightTable));
   d->Add(nFiles);
   // d->Add(nxi);
   fCuts.Output(d,"lCuts");
@@ -1201,6 +1371,15 @@ AliFMDDensityCalculator::Print(Option_t* option) const
   PFV("Threshold(hit)",         fHitThreshold);
   PFV("Max(outliers)",          fMaxOutliers);
   PFV("Cut(outlier)",           fOutlierCut);
+  PFB("Tabulated weights",      fUseWeightTable);
+  if (fUseWeightTable) { 
+    PFV("Weight table nodes",   fWeightTableNPoints);
+    PF("Weight table range",    "[%f,%f]", fWeightTableMin, fWeightTableMax);
+    PFV("Weight table tolerance", fWeightTableTolerance);
+    const char* rings[] = { "FMD1i", "FMD2i", "FMD2o", "FMD3i", "FMD3o" };
+    for (Int_t q = 0; q < fWeightTableError.fN && q < 5; q++) 
+      PF(Form("Max error %s", rings[q]), "%g", fWeightTableError[q]);
+  }
   PFV("Lower cut", "");
   fCuts.Print();
 
@@ -16,6 +16,7 @@
 #include <TNamed.h>
 #include <TList.h>
 #include <TArrayI.h>
+#include <TArrayD.h>
 #include <TVector3.h>
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
@@ -141,6 +142,37 @@ public:
    * @param m 
    */
   void SetMaxParticles(UShort_t m) { fMaxParticles = m; }  
+  /** 
+   * Set whether to tabulate the weighted mean number of particles
+   * @f$ f_W(\Delta/\Delta_{mip})@f$ (see
+   * AliFMDCorrELossFit::ELossFit::EvaluateWeighted) per ring and
+   * @f$\eta@f$ bin when the energy loss fits are loaded, and
+   * interpolate linearly in that table instead of evaluating the
+   * Landau-Gauss sums for each strip.
+   *
+   * The interpolation error is checked against the exact evaluation
+   * at the mid-point between all nodes.  Bins where it exceeds the
+   * tolerance, and signals outside the tabulated range, use the exact
+   * evaluation.
+   * 
+   * @param use       Whether to use the table 
+   * @param nPoints   Number of nodes 
+   * @param min       Least @f$\Delta/\Delta_{mip}@f$ tabulated
+   * @param max       Largest @f$\Delta/\Delta_{mip}@f$ tabulated
+   * @param tolerance Largest allowed absolute interpolation error 
+   */
+  void SetUseWeightTable(Bool_t   use=true, 
+			 Int_t    nPoints=4001, 
+			 Double_t min=0, 
+			 Double_t max=10,
+			 Double_t tolerance=1e-3) 
+  { 
+    fUseWeightTable       = use;
+    fWeightTableNPoints   = (nPoints < 2 ? 2 : nPoints);
+    fWeightTableMin       = min;
+    fWeightTableMax       = max;
+    fWeightTableTolerance = tolerance;
+  }
   /** 
    * Set whether to use poisson statistics to estimate the 
    * number of particles that has hit within a region.  If this is true, 
@@ -319,6 +351,28 @@ protected:
    * @return max weight or <= 0 in case of problems 
    */
   Int_t GetMaxWeight(UShort_t d, Char_t r, Float_t eta) const;
+  /** 
+   * Tabulate @f$ f_W(\Delta/\Delta_{mip})@f$ for all rings and
+   * @f$\eta@f$ bins with a good fit.  Called from CacheMaxWeights. 
+   * 
+   * @param cor   Correction
+   * @param nEta  Number of @f$\eta@f$ bins 
+   */
+  void CacheWeightTables(const AliFMDCorrELossFit* cor, Int_t nEta);
+  /** 
+   * Look up the number of particles in the table 
+   * 
+   * @param mult  Signal 
+   * @param d     Detector
+   * @param r     Ring 
+   * @param iEta  Eta bin (0 based) 
+   * @param ret   On return, the number of particles 
+   * 
+   * @return false if there's no table for the bin, or the signal is
+   * outside the table
+   */
+  Bool_t LookupNParticles(Float_t mult, UShort_t d, Char_t r, 
+			  Int_t iEta, Double_t& ret) const;
 
   /** 
    * Get the number of particles corresponding to the signal mult
@@ -504,8 +558,16 @@ protected:
   TProfile*              fHTiming;
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
+  Bool_t   fUseWeightTable;       // Whether to use tabulated weights
+  Int_t    fWeightTableNPoints;   // Number of nodes per table 
+  Double_t fWeightTableMin;       // Least tabulated signal 
+  Double_t fWeightTableMax;       // Largest tabulated signal 
+  Double_t fWeightTableTolerance; // Largest interpolation error 
+  TArrayI  fWeightTableOffset;    //! Offset of table per ring and eta bin
+  TArrayD  fWeightTable;          //! Tabulated weighted mean 
+  TArrayD  fWeightTableError;     //! Largest interpolation error per ring 
 
-  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,17); // Calculate Nch density 
 };
 
 #endif
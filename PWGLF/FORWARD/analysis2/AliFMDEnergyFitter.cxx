@@ -16,8 +16,13 @@
 #include <TFitResult.h>
 #include <THStack.h>
 #include <TROOT.h>
+#include <TDirectory.h>
+#include <Math/MinimizerOptions.h>
 #include <iostream>
 #include <iomanip>
+#include <vector>
+#include <atomic>
+#include <thread>
 
 ClassImp(AliFMDEnergyFitter)
 #if 0
@@ -49,7 +54,9 @@ AliFMDEnergyFitter::AliFMDEnergyFitter()
     fDebug(0),
     fResidualMethod(kNoResiduals),
     fSkips(0),
-    fRegularizationCut(3e6)
+    fRegularizationCut(3e6),
+    fNThreads(1),
+    fUseNeighbourSeeds(false)
 {
   // 
   // Default Constructor - do not use 
@@ -79,7 +86,9 @@ AliFMDEnergyFitter::AliFMDEnergyFitter(const char* title)
     fDebug(0),
     fResidualMethod(kNoResiduals),
     fSkips(0),
-    fRegularizationCut(3e6)
+    fRegularizationCut(3e6),
+    fNThreads(1),
+    fUseNeighbourSeeds(false)
 {
   // 
   // Constructor 
@@ -200,6 +209,7 @@ AliFMDEnergyFitter::CreateOutputObjects(TList* dir)
   d->Add(AliForwardUtil::MakeParameter("maxChi2PerNDF", fMaxChi2PerNDF));
   d->Add(AliForwardUtil::MakeParameter("minWeight",     fMinWeight));
   d->Add(AliForwardUtil::MakeParameter("regCut",        fRegularizationCut));
+  d->Add(AliForwardUtil::MakeParameter("neighbourSeeds",fUseNeighbourSeeds));
   d->Add(AliForwardUtil::MakeParameter("deltaShift", 
 				       AliLandauGaus::EnableSigmaShift()));
 
@@ -415,6 +425,8 @@ AliFMDEnergyFitter::Fit(const TList* dir)
       AliWarningF("Skipping FMD%d%c for fitting", o->fDet, o->fRing);
       continue;
     }
+    o->fNThreads          = fNThreads;
+    o->fUseNeighbourSeeds = fUseNeighbourSeeds;
     
     TObjArray* l = o->Fit(d, fLowCut, fNParticles,
 			  fMinEntries, fFitRangeBinWidth,
@@ -530,6 +542,7 @@ AliFMDEnergyFitter::ReadParameters(const TCollection* col)
   GetParam(ret,col,"minWeight",     fMinWeight);
   Bool_t dummy;
   GetParam(dummy,col,"regCut",      fRegularizationCut);
+  GetParam(dummy,col,"neighbourSeeds",fUseNeighbourSeeds);
 
   return ret;
 }
@@ -583,6 +596,8 @@ AliFMDEnergyFitter::Print(Option_t*) const
   PFV("max(chi^2/nu)",	        fMaxChi2PerNDF);
   PFV("min(a_i)",	        fMinWeight);
   PFV("Regularization cut",     fRegularizationCut);
+  PFV("Fit threads",            fNThreads);
+  PFB("Neighbour seeds",        fUseNeighbourSeeds);
   TString r = "";
   switch (fResidualMethod) { 
   case kNoResiduals:              r = "None";       break;
@@ -603,8 +618,9 @@ AliFMDEnergyFitter::RingHistos::RingHistos()
     fHist(0),
     fList(0),
     fBest(0),
-    fFits("AliFMDCorrELossFit::ELossFit", 200),
-    fDebug(0)
+    fDebug(0),
+    fNThreads(1),
+    fUseNeighbourSeeds(false)
 {
   // 
   // Default CTOR
@@ -622,8 +638,9 @@ AliFMDEnergyFitter::RingHistos::RingHistos(UShort_t d, Char_t r)
     fHist(0),
     fList(0),
     fBest(0),
-    fFits("AliFMDCorrELossFit::ELossFit", 200),
-    fDebug(0)
+    fDebug(0),
+    fNThreads(1),
+    fUseNeighbourSeeds(false)
 {
   // 
   // Constructor
@@ -1057,36 +1074,127 @@ AliFMDEnergyFitter::RingHistos::FitSlices(TList*           dir,
     best->Clear();
     best->SetOwner(false);
   }
+  // Collect the distributions first.  Projections are made here,
+  // serially, as they are registered in the current directory.
+  std::vector<TH1D*> input(nDists, 0);
+  std::vector<TH1D*> pristine(nDists, 0);
   for (Int_t i = 0; i < nDists; i++) { 
     // Ignore empty histograms altoghether 
     Int_t b    = i+1;
     TH1D* dist = (h ? h->ProjectionY(Form(fgkEDistFormat,GetName(),b),b,b,"e") 
 		  : static_cast<TH1D*>(dists->At(i)));
-    if (!dist) { 
-      // If we got the null pointer, return 0
-      nEmpty++;
-      continue;
-    }
+    if (!dist) continue;
     // Then releasing the histogram from the it's directory
     dist->SetDirectory(0);
     // Set a meaningful title
     dist->SetTitle(Form("#Delta/#Delta_{mip} for %s in %6.2f<#eta<%6.2f",
 			GetName(), eta.GetBinLowEdge(b),
 			eta.GetBinUpEdge(b)));
+    input[i] = dist;
+    // Keep an unscaled copy in case we need to retry the fit 
+    if (fUseNeighbourSeeds) { 
+      pristine[i] = static_cast<TH1D*>(dist->Clone());
+      pristine[i]->SetDirectory(0);
+    }
+  }
 
-    // Now fit 
-    UShort_t    status1 = 0;
-    ELossFit_t* res     = FitHist(dist,
-				  lowCut, 
-				  nParticles,
-				  minEntries,
-				  minusBins,   
-				  relErrorCut,
-				  chi2nuCut,
-				  minWeight,
-				  regCut,
-				  scaleToPeak,
-				  status1);
+  // Now fit.  The eta bins are independent, so they may be fitted
+  // concurrently.  Each fit uses its own fitter and functions, and
+  // results are stored per bin, so the output does not depend on the
+  // scheduling.
+  std::vector<ELossFit_t*> results(nDists, 0);
+  std::vector<UShort_t>    statuses(nDists, 0);
+  auto fitOne = [&](Int_t i) { 
+    if (!input[i]) return;
+    results[i] = FitHist(input[i],
+			 lowCut, 
+			 nParticles,
+			 minEntries,
+			 minusBins,   
+			 relErrorCut,
+			 chi2nuCut,
+			 minWeight,
+			 regCut,
+			 scaleToPeak,
+			 statuses[i]);
+  };
+  Int_t nThreads = TMath::Min(Int_t(fNThreads), nDists);
+  if (nThreads <= 1) 
+    for (Int_t i = 0; i < nDists; i++) fitOne(i);
+  else { 
+    ROOT::EnableThreadSafety();
+    TString defMinimizer = 
+      ROOT::Math::MinimizerOptions::DefaultMinimizerType();
+    // TMinuit is not reentrant 
+    ROOT::Math::MinimizerOptions::SetDefaultMinimizer("Minuit2");
+    // Keep the fit functions out of the global list 
+    Bool_t addToGlobal = TF1::DefaultAddToGlobalList(false);
+    printf("%s: fitting %d distributions on %d threads\n", 
+	   GetName(), nDists, nThreads);
+    std::atomic<Int_t>       next(0);
+    std::vector<std::thread> workers;
+    for (Int_t t = 0; t < nThreads; t++) 
+      workers.push_back(std::thread([&]() { 
+	    TDirectory::TContext context(nullptr);
+	    Int_t i;
+	    while ((i = next++) < nDists) fitOne(i);
+	  }));
+    for (size_t t = 0; t < workers.size(); t++) workers[t].join();
+    TF1::DefaultAddToGlobalList(addToGlobal);
+    ROOT::Math::MinimizerOptions::SetDefaultMinimizer(defMinimizer.Data());
+  }
+
+  // Retry failed fits, starting from the nearest converged bin 
+  Int_t               nSeeded = 0;
+  std::vector<Bool_t> seeded(nDists, false);
+  if (fUseNeighbourSeeds) { 
+    for (Int_t i = 0; i < nDists; i++) { 
+      if (results[i] || statuses[i] != 3 || !pristine[i]) continue;
+      // Only use fits that were not themselves seeded 
+      const ELossFit_t* seed = 0;
+      for (Int_t k = 1; k < nDists && !seed; k++) { 
+	Int_t lo = i - k;
+	Int_t hi = i + k;
+	if      (lo >= 0     && results[lo] && !seeded[lo]) seed = results[lo];
+	else if (hi < nDists && results[hi] && !seeded[hi]) seed = results[hi];
+      }
+      if (!seed) continue;
+      UShort_t    status2 = 0;
+      ELossFit_t* res     = FitHist(pristine[i],
+				    lowCut, 
+				    nParticles,
+				    minEntries,
+				    minusBins,   
+				    relErrorCut,
+				    chi2nuCut,
+				    minWeight,
+				    regCut,
+				    scaleToPeak,
+				    status2,
+				    seed);
+      if (!res) continue;
+      // Use the re-fitted copy from now on 
+      if (h) delete input[i];
+      input[i]    = pristine[i];
+      pristine[i] = 0;
+      results[i]  = res;
+      statuses[i] = status2;
+      seeded[i]   = true;
+      nSeeded++;
+    }
+  }
+
+  for (Int_t i = 0; i < nDists; i++) { 
+    Int_t       b       = i+1;
+    TH1D*       dist    = input[i];
+    UShort_t    status1 = statuses[i];
+    ELossFit_t* res     = results[i];
+    if (pristine[i]) delete pristine[i];
+    if (!dist) { 
+      // If we got the null pointer, return 0
+      nEmpty++;
+      continue;
+    }
     if (!res) {
       switch (status1) { 
       case 1: nEmpty++; break;
@@ -1141,8 +1249,10 @@ AliFMDEnergyFitter::RingHistos::FitSlices(TList*           dir,
     }
   }
   printf("%s: Out of %d histograms, %d where empty, %d had too little data,"
-	 "leaving %d to be fitted, of which %d succeeded\n",  
-	 GetName(), nDists, nEmpty, nLow, nDists-nEmpty-nLow, nFitted);
+	 "leaving %d to be fitted, of which %d succeeded (%d seeded from a "
+	 "neighbour)\n",  
+	 GetName(), nDists, nEmpty, nLow, nDists-nEmpty-nLow, nFitted, 
+	 nSeeded);
 
   // Fit the full-ring histogram 
   TH1*        total   = GetOutputHist(l, Form("%s_edist", fName.Data()));
@@ -1228,7 +1338,8 @@ AliFMDEnergyFitter::RingHistos::FitHist(TH1*      dist,
 					Double_t  minWeight,
 					Double_t  regCut,
 					Bool_t    scaleToPeak,
-					UShort_t& status) const
+					UShort_t& status,
+					const ELossFit_t* seed) const
 {
   // 
   // Fit a signal histogram.  First, the bin @f$ b_{min}@f$ with
@@ -1251,6 +1362,7 @@ AliFMDEnergyFitter::RingHistos::FitHist(TH1*      dist,
   //                    is loosend by a factor of 2 
   //    chi2nuCut   Cut on @f$ \chi^2/\nu@f$ - 
   //                    the reduced @f$\chi^2@f$ 
+  //    seed        If not null, initial values of the 1-particle fit
   // 
   // Return:
   //    The best fit function 
@@ -1298,6 +1410,7 @@ AliFMDEnergyFitter::RingHistos::FitHist(TH1*      dist,
   AliLandauGausFitter f(lowCut, maxRange, minusBins); 
   f.Clear();
   f.SetDebug(fDebug > 3); 
+  if (seed) f.SetSeed(seed->fDelta, seed->fXi, seed->fSigma);
 
   // regularization cut - should be a parameter of the class 
   if (dist->GetEntries() > regCut) { 
@@ -1370,7 +1483,9 @@ AliFMDEnergyFitter::RingHistos::FindBestFit(const TH1* dist,
   TF1*   func  = 0;
   Int_t  i     = 0;
   TIter  next(funcs);
-  fFits.Clear(); // This is only ever used here
+  // Local, since the eta bins may be fitted concurrently 
+  TClonesArray fits("AliFMDCorrELossFit::ELossFit", 
+		    TMath::Max(funcs->GetEntries(), 1));
 
   if (fDebug) printf("Find best fit for %s ... ", dist->GetName());
   if (fDebug > 2) printf("\n");
@@ -1378,7 +1493,7 @@ AliFMDEnergyFitter::RingHistos::FindBestFit(const TH1* dist,
   // Loop over all functions stored in distribution, 
   // and calculate the quality 
   while ((func = static_cast<TF1*>(next()))) { 
-    ELossFit_t* fit = new(fFits[i++]) ELossFit_t(0,*func);
+    ELossFit_t* fit = new(fits[i++]) ELossFit_t(0,*func);
     fit->fDet  = fDet;
     fit->fRing = fRing;
     // fit->fBin  = b;
@@ -1390,11 +1505,11 @@ AliFMDEnergyFitter::RingHistos::FindBestFit(const TH1* dist,
   }
 
   // Sort all the found fit objects in increasing quality 
-  fFits.Sort();
-  if (fDebug > 2) fFits.Print("s");
+  fits.Sort();
+  if (fDebug > 2) fits.Print("s");
 
   // Get the top-most fit
-  ELossFit_t* ret = static_cast<ELossFit_t*>(fFits.At(i-1));
+  ELossFit_t* ret = static_cast<ELossFit_t*>(fits.At(i-1));
   if (!ret) {
     AliWarningF("No fit found for %s", GetName());
     return 0;
@@ -287,6 +287,23 @@ public:
     fRegularizationCut = cut;
   }
   void SetSkips(UShort_t skip) { fSkips = skip; }
+  /** 
+   * Set the number of threads used to fit the @f$\eta@f$ bins of a
+   * ring.  The bins are independent, and the results do not depend
+   * on the number of threads.  With more than one thread, ROOT thread
+   * safety is enabled and Minuit2 is used as minimizer.
+   * 
+   * @param n Number of threads (1, the default, fits serially)
+   */
+  void SetNumberOfThreads(UShort_t n=1) { fNThreads = (n < 1 ? 1 : n); }
+  /** 
+   * Set whether to retry failed fits, starting the 1-particle fit from
+   * the result of the nearest converged @f$\eta@f$ bin of the same
+   * ring rather than from the peak of the distribution. 
+   * 
+   * @param use If true, retry failed fits with neighbour seeds 
+   */
+  void SetUseNeighbourSeeds(Bool_t use=true) { fUseNeighbourSeeds = use; }
   /** 
    * Set the debug level.  The higher the value the more output 
    * 
@@ -580,6 +597,7 @@ public:
      * @param scaleToPeak If true, scale distribution to peak value
      * @param status      On return, contain the status code (0: OK, 1:
      *                    empty, 2: low statistics, 3: fit failed)
+     * @param seed        If not null, initial values of the 1-particle fit
      * 
      * @return The best fit function 
      */
@@ -593,7 +611,8 @@ public:
 				Double_t  minWeight,
 				Double_t  regCut,
 				Bool_t    scaleToPeak,
-				UShort_t& status) const;
+				UShort_t& status,
+				const ELossFit_t* seed=0) const;
     /** 
      * Find the best fit 
      * 
@@ -677,9 +696,10 @@ public:
     // TList*               fEtaEDists; // Energy distributions per eta bin. 
     TList*               fList;
     mutable TObjArray    fBest;
-    mutable TClonesArray fFits;
     Int_t                fDebug;
-    ClassDef(RingHistos,4);
+    UShort_t             fNThreads;          // Number of fit threads
+    Bool_t               fUseNeighbourSeeds; // Retry with neighbour seeds
+    ClassDef(RingHistos,5);
   };
 protected:
   /** 
@@ -750,8 +770,10 @@ protected:
   EResidualMethod fResidualMethod;    // Whether to store residuals (debugging)
   UShort_t        fSkips;             // Rings to skip when fitting 
   Double_t        fRegularizationCut; // When to regularize the chi^2
+  UShort_t        fNThreads;          // Number of threads for the fits
+  Bool_t          fUseNeighbourSeeds; // Retry failed fits with neighbour seeds
 
-  ClassDef(AliFMDEnergyFitter,8); //
+  ClassDef(AliFMDEnergyFitter,9); //
 };
 
 #endif
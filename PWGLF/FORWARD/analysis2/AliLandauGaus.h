@@ -13,6 +13,7 @@
 #include <TObject.h>
 #include <TF1.h>
 #include <TMath.h>
+#include <vector>
 
 /** 
  * This class contains static member functions to calculate the energy
@@ -324,6 +325,16 @@ public:
    * @return The shift 
    */
   static Double_t SigmaShift(Int_t i, Double_t xi, Double_t sigma);
+  /** 
+   * Get the Gaussian weights of the sample points used in F.  The
+   * sample points are placed at fixed multiples of @f$\sigma'@f$
+   * away from the evaluation point, so the weights only depend on
+   * NSteps() and NSigma().  They are calculated once, and shared by
+   * all evaluations (and all @f$ i@f$ particle terms).
+   * 
+   * @return Array of NSteps()/2+1 weights 
+   */
+  static const Double_t* GausKernel();
   /* @} */
 
   
@@ -516,6 +527,25 @@ AliLandauGaus::SigmaShift(Int_t i, Double_t xi, Double_t sigma)
   return c * sigma / TMath::Power(1+1./i, q);
 }
 //____________________________________________________________________
+inline const Double_t*
+AliLandauGaus::GausKernel()
+{
+  struct Kernel {
+    Kernel() : fW(NSteps()/2+1) {
+      const Int_t    nSteps = NSteps();
+      const Double_t nSigma = NSigma();
+      for (Int_t i = 0; i <= nSteps/2; i++) { 
+	// (x - x_i) / sigma' for sample i, see F
+	const Double_t u = nSigma * (1 - (2. * i - 1) / nSteps);
+	fW[i] = TMath::Exp(-.5 * u * u);
+      }
+    }
+    std::vector<Double_t> fW;
+  };
+  static const Kernel kernel;
+  return &(kernel.fW[0]);
+}
+//____________________________________________________________________
 inline Double_t 
 AliLandauGaus::Fl(Double_t x, Double_t delta, Double_t xi)
 {
@@ -537,13 +567,17 @@ AliLandauGaus::F(Double_t x, Double_t delta, Double_t xi,
   const Double_t xlow   = x - nSigma * sigma1;
   const Double_t xhigh  = x + nSigma * sigma1;
   const Double_t step   = (xhigh - xlow) / nSteps;
+  const Double_t mpv    = deltaP - xi * MPShift();
+  const Double_t* w     = GausKernel();
   Double_t       sum    = 0;
   
+  // The Gaussian weight of the two samples x1 and x2 is the same, and
+  // does not depend on the parameters - see GausKernel
   for (Int_t i = 0; i <= nSteps/2; i++) { 
     const Double_t x1 = xlow  + (i - .5) * step;
     const Double_t x2 = xhigh - (i - .5) * step;
-    sum += Fl(x1, deltaP, xi) * TMath::Gaus(x, x1, sigma1);
-    sum += Fl(x2, deltaP, xi) * TMath::Gaus(x, x2, sigma1);
+    sum += w[i] * (TMath::Landau(x1, mpv, xi, true) + 
+		   TMath::Landau(x2, mpv, xi, true));
   }
   return step * sum * InvSq2Pi() / sigma1;
 }
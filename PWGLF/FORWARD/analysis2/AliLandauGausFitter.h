@@ -65,7 +65,8 @@ public:
    */
   AliLandauGausFitter(Double_t lowCut, Double_t maxRange, UShort_t minusBins)
     : fLowCut(lowCut), fMaxRange(maxRange), fMinusBins(minusBins), 
-      fFitResults(0), fFunctions(0), fDebug(false) 
+      fFitResults(0), fFunctions(0), fDebug(false), 
+      fSeedDelta(-1), fSeedXi(-1), fSeedSigma(-1)
   {
     fFitResults.SetOwner();
     fFunctions.SetOwner();
@@ -85,6 +86,24 @@ public:
    * @param debug If true, enable debugging output
    */
   void SetDebug(Bool_t debug=true) { fDebug = debug; }
+  /** 
+   * Set the initial values of the 1-particle fit, for example from
+   * the converged fit of a neighbouring @f$\eta@f$ bin.  By default
+   * (or if @a delta is 0 or less) the initial values are derived from
+   * the peak of the distribution.  The fit range is always derived
+   * from the distribution, and seeds outside the parameter limits of
+   * the distribution are moved to the closest limit (with a warning).
+   * 
+   * @param delta  Initial @f$\Delta_p@f$ 
+   * @param xi     Initial @f$\xi@f$ 
+   * @param sigma  Initial @f$\sigma@f$ 
+   */
+  void SetSeed(Double_t delta, Double_t xi, Double_t sigma) 
+  {
+    fSeedDelta = delta;
+    fSeedXi    = xi;
+    fSeedSigma = sigma;
+  }
   /** 
    * Clear internal arrays
    * 
@@ -190,7 +209,8 @@ protected:
 		    Double_t low, Double_t high) 
   {
     if (test < low || test > high) {
-      ::Warning("","Initial value of %s=%f not in [%f,%f]", 
+      ::Warning("SetParLimits","Initial value of %s=%f not in [%f,%f], "
+		"parameter not limited", 
 		f->GetParName(iPar), test, low, high);
       return;
     }
@@ -199,12 +219,35 @@ protected:
 	     f->GetParName(iPar), test, low, high);
     f->SetParLimits(iPar, low, high);
   }
+  /** 
+   * Move a seed into the limits of its parameter, such that the
+   * limits are applied to the seeded fit
+   * 
+   * @param name  Name of the parameter 
+   * @param seed  Seed value
+   * @param low   Lower limit 
+   * @param high  Upper limit 
+   * 
+   * @return The seed, or the closest limit if the seed is outside 
+   */
+  Double_t ClampSeed(const char* name, Double_t seed, 
+		     Double_t low, Double_t high) const
+  {
+    if (seed >= low && seed <= high) return seed;
+    Double_t clamped = TMath::Min(TMath::Max(seed, low), high);
+    ::Warning("ClampSeed", "Seed of %s=%f not in [%f,%f], starting from %f",
+	      name, seed, low, high, clamped);
+    return clamped;
+  }
   const Double_t fLowCut;     // Lower cut on data 
   const Double_t fMaxRange;   // Maximum range to fit 
   const UShort_t fMinusBins;  // Number of bins from maximum to fit 1st peak
   TObjArray fFitResults;      // Array of fit results 
   TObjArray fFunctions;       // Array of functions 
   Bool_t    fDebug;           // Debug flag
+  Double_t  fSeedDelta;       // Initial Delta_p, if larger than 0
+  Double_t  fSeedXi;          // Initial xi 
+  Double_t  fSeedSigma;       // Initial sigma
 };
 
 
@@ -246,11 +289,22 @@ AliLandauGausFitter::Fit1Particle(TH1* dist, Double_t sigman)
   // Restore the range 
   dist->GetXaxis()->SetRange(1, maxBin);
   
+  // Initial values - from the peak, or the seed if set 
+  Double_t delta0 = peakE;
+  Double_t xi0    = peakE/10;
+  Double_t sigma0 = peakE/5;
+  if (fSeedDelta > 0) { 
+    // Seeds from another bin may be outside the limits of this one 
+    delta0 = ClampSeed("Delta", fSeedDelta, minE, fMaxRange);
+    xi0    = ClampSeed("xi",    fSeedXi,    0,    2*rmsE);
+    sigma0 = ClampSeed("sigma", fSeedSigma, 1e-5, rmsE);
+  }
+
   // Define the function to fit 
-  TF1* f = AliLandauGaus::MakeF1(intg,peakE,peakE/10,peakE/5,sigman,minE,maxE);
-  SetParLimits(f, kDelta, peakE,   minE, fMaxRange);
+  TF1* f = AliLandauGaus::MakeF1(intg,delta0,xi0,sigma0,sigman,minE,maxE);
+  SetParLimits(f, kDelta, delta0,  minE, fMaxRange);
   SetParLimits(f, kXi,    peakE,   0,    2*rmsE); // 0.1
-  SetParLimits(f, kSigma, peakE/5, 1e-5, rmsE); // 0.1
+  SetParLimits(f, kSigma, sigma0,  1e-5, rmsE); // 0.1
   if (sigman <= 0)  
     f->FixParameter(kSigmaN, 0);
   else 
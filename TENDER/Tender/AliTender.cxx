@@ -23,6 +23,7 @@
 #include "AliAnalysisManager.h"
 #include "AliCDBManager.h"
 #include "AliESDEvent.h"
+#include "AliESDtrack.h"
 #include "AliESDInputHandler.h"
 #include "AliLog.h"
 
@@ -41,7 +42,9 @@ AliTender::AliTender():
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fFuseTrackLoops(kTRUE),
+           fTrackGroup(NULL)
 {
 // Dummy constructor
 }
@@ -58,7 +61,9 @@ AliTender::AliTender(const char* name):
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fFuseTrackLoops(kTRUE),
+           fTrackGroup(NULL)
 {
 // Default constructor
   DefineOutput(1,  AliESDEvent::Class());
@@ -72,6 +77,7 @@ AliTender::~AliTender()
     fSupplies->Delete();
     delete fSupplies;
   }
+  delete fTrackGroup;
 }
 
 //______________________________________________________________________________
@@ -170,9 +176,13 @@ void AliTender::UserExec(Option_t* option)
       fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
     } 
   }
-  TIter next(fSupplies);
-  AliTenderSupply *supply;
-  while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  if (fFuseTrackLoops) {
+    ProcessSuppliesFused();
+  } else {
+    TIter next(fSupplies);
+    AliTenderSupply *supply;
+    while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  }
   fRunChanged = kFALSE;
 
   if (TObject::TestBit(kCheckEventSelection)) fESDhandler->CheckSelectionMask();
@@ -181,6 +191,57 @@ void AliTender::UserExec(Option_t* option)
   if (!opt.Contains("NoPost")) PostData(1, fESD);
 }
 
+//______________________________________________________________________________
+void AliTender::ProcessSuppliesFused()
+{
+// Run the supplies in order, sharing one loop over the tracks between
+// consecutive supplies implementing the split interface. The event step of a
+// supply runs before the pending track steps only if it does not read data
+// they write and does not write data they read or write; otherwise the pending
+// track loop is run first. The result is the same as the sequential chain.
+  if (!fSupplies) return;
+  if (!fTrackGroup) fTrackGroup = new TObjArray();
+  fTrackGroup->Clear();
+  UInt_t groupReads = 0;
+  UInt_t groupWrites = 0;
+  Int_t nsupplies = fSupplies->GetEntriesFast();
+  for (Int_t isupply=0; isupply<nsupplies; isupply++) {
+    AliTenderSupply *supply = (AliTenderSupply*)fSupplies->UncheckedAt(isupply);
+    if (!supply->SupportsTrackLoop()) {
+      RunTrackLoop();
+      groupReads = groupWrites = 0;
+      supply->ProcessEvent();
+      continue;
+    }
+    if ((supply->GetEventStepReads() & groupWrites) ||
+        (supply->GetEventStepWrites() & (groupReads | groupWrites))) {
+      RunTrackLoop();
+      groupReads = groupWrites = 0;
+    }
+    if (!supply->BeginEvent()) continue;
+    fTrackGroup->Add(supply);
+    groupReads |= supply->GetTrackStepReads();
+    groupWrites |= supply->GetTrackStepWrites();
+  }
+  RunTrackLoop();
+}
+
+//______________________________________________________________________________
+void AliTender::RunTrackLoop()
+{
+// Run the track steps of the pending supplies, all supplies for one track
+// before moving to the next.
+  Int_t nsupplies = fTrackGroup ? fTrackGroup->GetEntriesFast() : 0;
+  if (!nsupplies) return;
+  Int_t ntracks = fESD->GetNumberOfTracks();
+  for (Int_t itrack=0; itrack<ntracks; itrack++) {
+    AliESDtrack *track = fESD->GetTrack(itrack);
+    for (Int_t isupply=0; isupply<nsupplies; isupply++)
+      ((AliTenderSupply*)fTrackGroup->UncheckedAt(isupply))->ProcessTrack(track);
+  }
+  fTrackGroup->Clear();
+}
+
 //______________________________________________________________________________
 void AliTender::SetDefaultCDBStorage(const char *dbString)
 {
@@ -43,10 +43,15 @@ private:
   AliESDEvent              *fESD;            //! Pointer to current ESD event
   TObjArray                *fSupplies;       // Array of tender supplies
   TObjArray                *fCDBSettings;    // Array with CDB configuration
+  Bool_t                    fFuseTrackLoops; // Run the track steps of the supplies in a shared loop
+  TObjArray                *fTrackGroup;     //! Supplies waiting for the shared track loop
   
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
 
+  void                      ProcessSuppliesFused();
+  void                      RunTrackLoop();
+
 public:  
   AliTender();
   AliTender(const char *name);
@@ -68,6 +73,13 @@ public:
    */
   void 			    SetHandleOCDB(Bool_t doHandle) { fHandleCDB = doHandle; }
   void SetESDhandler(AliESDInputHandler*esdH) {fESDhandler = esdH;}
+  /**
+   * Run the per-track steps of consecutive supplies in one loop over the tracks (default: true).
+   * Supplies not implementing the split interface of AliTenderSupply are always run alone.
+   * @param[in] fuse If false, each supply processes the full event in turn
+   */
+  void                      SetFuseTrackLoops(Bool_t fuse=kTRUE) {fFuseTrackLoops = fuse;}
+  Bool_t                    GetFuseTrackLoops() const {return fFuseTrackLoops;}
 
   // Run control
   virtual void              ConnectInputData(Option_t *option = "");
@@ -75,6 +87,6 @@ public:
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,5)  // Class describing the tender car for ESD analysis
 };
 #endif
@@ -15,9 +15,23 @@
 #endif
 
 class AliTender;
+class AliESDtrack;
 
 class AliTenderSupply : public TNamed {
 
+public:
+// Event data touched by the steps of a supply, used by the tender to check
+// which supplies can share one loop over the tracks
+enum ETenderData {
+   kTPCdata      = BIT(0), // TPC signal and TPC PID (tracks and PID response)
+   kTOFdata      = BIT(1), // TOF signal, integrated times, event time zero and TOF PID
+   kTRDdata      = BIT(2), // TRD slices, TRD matching and TRD PID
+   kTrackParams  = BIT(3), // Track parameters and status
+   kVertexData   = BIT(4), // Primary vertices and diamond
+   kCombinedPID  = BIT(5), // Combined and cached detector PID
+   kAllData      = 0xFFFF
+};
+
 protected:
   const AliTender          *fTender;         // Tender car
   
@@ -31,6 +45,18 @@ public:
   // Run control
   virtual void              Init() = 0;
   virtual void              ProcessEvent() = 0;
+
+  // Split processing for the fused track loop of AliTender. A supply which
+  // returns kTRUE from SupportsTrackLoop() must make ProcessEvent() equivalent
+  // to BeginEvent() followed, if it returned kTRUE, by ProcessTrack() on all
+  // tracks in order. ProcessTrack() may only touch the track it is given.
+  virtual Bool_t            SupportsTrackLoop() const {return kFALSE;}
+  virtual Bool_t            BeginEvent() {return kFALSE;}
+  virtual void              ProcessTrack(AliESDtrack */*track*/) {}
+  virtual UInt_t            GetEventStepReads() const {return kAllData;}
+  virtual UInt_t            GetEventStepWrites() const {return kAllData;}
+  virtual UInt_t            GetTrackStepReads() const {return kAllData;}
+  virtual UInt_t            GetTrackStepWrites() const {return kAllData;}
   
   void                      SetTender(const AliTender *tender) {fTender = tender;}
     
@@ -33,6 +33,7 @@ ClassImp(AliPIDTenderSupply)
 
 AliPIDTenderSupply::AliPIDTenderSupply() :
   AliTenderSupply(),
+  fESDpid(0x0),
   fCachePID(kFALSE)
 {
   //
@@ -43,6 +44,7 @@ AliPIDTenderSupply::AliPIDTenderSupply() :
 //_____________________________________________________
 AliPIDTenderSupply::AliPIDTenderSupply(const char *name, const AliTender *tender) :
   AliTenderSupply(name,tender),
+  fESDpid(0x0),
   fCachePID(kFALSE)
 {
   //
@@ -56,22 +58,51 @@ void AliPIDTenderSupply::ProcessEvent()
   //
   // Combine PID information
   //
+  if (!BeginEvent()) return;
 
+  //
+  // recalculate combined PID probabilities
+  //
   AliESDEvent *event=fTender->GetEvent();
-  if (!event) return;
+  Int_t ntracks=event->GetNumberOfTracks();
+  for(Int_t itrack = 0; itrack < ntracks; itrack++)
+    ProcessTrack(event->GetTrack(itrack));
+  
+}
 
-  AliESDpid *pid=fTender->GetESDhandler()->GetESDpid();
-  if (!pid) return;
+//_____________________________________________________
+Bool_t AliPIDTenderSupply::BeginEvent()
+{
+  //
+  // Get the PID object and fill the detector PID cache if requested
+  //
+
+  AliESDEvent *event=fTender->GetEvent();
+  if (!event) return kFALSE;
+
+  fESDpid=fTender->GetESDhandler()->GetESDpid();
+  if (!fESDpid) return kFALSE;
   // chache pid if requested
   if (fCachePID) {
-    pid->FillTrackDetectorPID();
+    fESDpid->FillTrackDetectorPID();
   }
-  
+  return kTRUE;
+}
+
+//_____________________________________________________
+void AliPIDTenderSupply::ProcessTrack(AliESDtrack *track)
+{
   //
-  // recalculate combined PID probabilities
+  // Recalculate combined PID probabilities of one track
   //
-  Int_t ntracks=event->GetNumberOfTracks();
-  for(Int_t itrack = 0; itrack < ntracks; itrack++)
-    pid->CombinePID(event->GetTrack(itrack));
-  
+  fESDpid->CombinePID(track);
+}
+
+//_____________________________________________________
+UInt_t AliPIDTenderSupply::GetEventStepReads() const
+{
+  //
+  // Caching the detector PID reads the detector signals of all tracks
+  //
+  return fCachePID ? kTPCdata|kTOFdata|kTRDdata|kTrackParams : 0;
 }
@@ -14,6 +14,8 @@
 
 #include <AliTenderSupply.h>
 
+class AliESDpid;
+
 class AliPIDTenderSupply: public AliTenderSupply {
   
 public:
@@ -25,8 +27,17 @@ public:
   virtual void              Init(){;}
   virtual void              ProcessEvent();
 
+  virtual Bool_t            SupportsTrackLoop() const {return kTRUE;}
+  virtual Bool_t            BeginEvent();
+  virtual void              ProcessTrack(AliESDtrack *track);
+  virtual UInt_t            GetEventStepReads() const;
+  virtual UInt_t            GetEventStepWrites() const {return fCachePID ? kCombinedPID : 0;}
+  virtual UInt_t            GetTrackStepReads() const {return kTPCdata|kTOFdata|kTRDdata|kTrackParams|kCombinedPID;}
+  virtual UInt_t            GetTrackStepWrites() const {return kCombinedPID;}
+
   void SetCachePID(Bool_t cachePID) { fCachePID=cachePID; }
 private:
+  AliESDpid *fESDpid;                  //! ESD pid object of the current event
   Bool_t fCachePID;                    // Cache PID values in transient object
   
   AliPIDTenderSupply(const AliPIDTenderSupply&c);
@@ -30,6 +30,14 @@ public:
   virtual void              Init();
   virtual void              ProcessEvent();
 
+  virtual Bool_t            SupportsTrackLoop() const {return kTRUE;}
+  virtual Bool_t            BeginEvent();
+  virtual void              ProcessTrack(AliESDtrack *track) {fESDpid->MakeTOFPID(track,0);}
+  virtual UInt_t            GetEventStepReads() const {return kTOFdata|kTrackParams|kVertexData;}
+  virtual UInt_t            GetEventStepWrites() const {return kTOFdata;}
+  virtual UInt_t            GetTrackStepReads() const {return kTOFdata|kTrackParams;}
+  virtual UInt_t            GetTrackStepWrites() const {return kTOFdata;}
+
   // TOF tender methods
   void SetIsMC(Bool_t flag=kFALSE){fIsMC=flag;}
   void SetCorrectExpTimes(Bool_t flag=kTRUE){fCorrectExpTimes=flag;}
@@ -72,7 +72,10 @@ fGRP(0x0),
 fBeamType("PP"),
 fLHCperiod(),
 fMCperiod(),
-fRecoPass(0)
+fRecoPass(0),
+fCorrGainScale(1.),
+fCorrAttachSlope(0.),
+fCorrGainMultiplicity(1.)
 {
   //
   // default ctor
@@ -101,7 +104,10 @@ fGRP(0x0),
 fBeamType("PP"),
 fLHCperiod(),
 fMCperiod(),
-fRecoPass(0)
+fRecoPass(0),
+fCorrGainScale(1.),
+fCorrAttachSlope(0.),
+fCorrGainMultiplicity(1.)
 {
   //
   // named ctor
@@ -154,9 +160,22 @@ void AliTPCTenderSupply::ProcessEvent()
   //
   // Reapply pid information
   //
+  if (!BeginEvent()) return;
+
+  AliESDEvent *event=fTender->GetEvent();
+  Int_t ntracks=event->GetNumberOfTracks();
+  for(Int_t itrack = 0; itrack < ntracks; itrack++) ProcessTrack(event->GetTrack(itrack));
+}
+
+//_____________________________________________________
+Bool_t AliTPCTenderSupply::BeginEvent()
+{
+  //
+  // Run dependent setup and event wise gain correction factors
+  //
   
   AliESDEvent *event=fTender->GetEvent();
-  if (!event) return;
+  if (!event) return kFALSE;
   
   //load gain correction if run has changed
   if (fTender->RunChanged()){
@@ -173,37 +192,39 @@ void AliTPCTenderSupply::ProcessEvent()
   // get gain correction factor
   //
   Double_t corrFactor = GetGainCorrection();
-  Double_t corrAttachSlope = 0;
-  Double_t corrGainMultiplicityPbPb=1;
-  if (fAttachmentCorrection && fGainAttachment) corrAttachSlope = fGainAttachment->Eval(event->GetTimeStamp());
-  if (fMultiCorrection&&fMultiCorrMean) corrGainMultiplicityPbPb = fMultiCorrMean->Eval(GetTPCMultiplicityBin());
-  
+  fCorrAttachSlope = 0;
+  fCorrGainMultiplicity = 1;
+  if (fAttachmentCorrection && fGainAttachment) fCorrAttachSlope = fGainAttachment->Eval(event->GetTimeStamp());
+  if (fMultiCorrection&&fMultiCorrMean) fCorrGainMultiplicity = fMultiCorrMean->Eval(GetTPCMultiplicityBin());
+  fCorrGainScale = corrFactor*(1 + fCorrAttachSlope*180.);
+  return kTRUE;
+}
+
+//_____________________________________________________
+void AliTPCTenderSupply::ProcessTrack(AliESDtrack *track)
+{
   //
   // - correct TPC signals
   // - recalculate PID probabilities for TPC
   // - correct TPC signal multiplicity dependence
+  //
+  const AliExternalTrackParam *inner=track->GetInnerParam();
+  
+  // skip tracks without TPC information
+  if (!inner) return;
 
-  Int_t ntracks=event->GetNumberOfTracks();
-  for(Int_t itrack = 0; itrack < ntracks; itrack++){
-    AliESDtrack *track=event->GetTrack(itrack);
-    const AliExternalTrackParam *inner=track->GetInnerParam();
-    
-    // skip tracks without TPC information
-    if (!inner) continue;
-
-    //calculate total gain correction factor given by
-    // o gain calibration factor
-    // o attachment correction
-    // o multiplicity correction in PbPb
-    Float_t meanDrift= 250. - 0.5*TMath::Abs(2*inner->GetZ() + (247-83)*inner->GetTgl());
-    Double_t corrGainTotal=corrFactor*(1 + corrAttachSlope*180.)/(1 + corrAttachSlope*meanDrift)/corrGainMultiplicityPbPb;
+  //calculate total gain correction factor given by
+  // o gain calibration factor
+  // o attachment correction
+  // o multiplicity correction in PbPb
+  Float_t meanDrift= 250. - 0.5*TMath::Abs(2*inner->GetZ() + (247-83)*inner->GetTgl());
+  Double_t corrGainTotal=fCorrGainScale/(1 + fCorrAttachSlope*meanDrift)/fCorrGainMultiplicity;
 
-    // apply gain correction
-    track->SetTPCsignal(track->GetTPCsignal()*corrGainTotal ,track->GetTPCsignalSigma(), track->GetTPCsignalN());
+  // apply gain correction
+  track->SetTPCsignal(track->GetTPCsignal()*corrGainTotal ,track->GetTPCsignalSigma(), track->GetTPCsignalN());
 
-    // recalculate pid probabilities
-    fESDpid->MakeTPCPID(track);
-  }
+  // recalculate pid probabilities
+  fESDpid->MakeTPCPID(track);
 }
 
 //_____________________________________________________
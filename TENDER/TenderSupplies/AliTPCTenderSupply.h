@@ -21,6 +21,7 @@ class AliGRPObject;
 class TGraphErrors;
 class AliAnalysisManager;
 class TF1;
+class AliESDtrack;
 
 class AliTPCTenderSupply: public AliTenderSupply {
   
@@ -42,6 +43,14 @@ public:
 
   virtual void              Init();
   virtual void              ProcessEvent();
+
+  virtual Bool_t            SupportsTrackLoop() const {return kTRUE;}
+  virtual Bool_t            BeginEvent();
+  virtual void              ProcessTrack(AliESDtrack *track);
+  virtual UInt_t            GetEventStepReads() const {return kVertexData;}
+  virtual UInt_t            GetEventStepWrites() const {return kTPCdata;}
+  virtual UInt_t            GetTrackStepReads() const {return kTPCdata|kTrackParams;}
+  virtual UInt_t            GetTrackStepWrites() const {return kTPCdata;}
   
 private:
   AliESDpid          *fESDpid;         //! ESD pid object
@@ -69,6 +78,10 @@ private:
   TString fMCperiod;                 //! corresponding MC period to use for the splines
   Int_t   fRecoPass;                 //! reconstruction pass
 
+  Double_t fCorrGainScale;           //! gain times attachment normalisation of the current event
+  Double_t fCorrAttachSlope;         //! attachment correction slope of the current event
+  Double_t fCorrGainMultiplicity;    //! multiplicity gain correction of the current event
+
   void SetSplines();
   Double_t GetGainCorrection();
 
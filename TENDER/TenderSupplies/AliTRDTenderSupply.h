@@ -16,6 +16,7 @@
 
 class AliTRDCalDet;
 class AliESDEvent;
+class AliESDtrack;
 class AliOADBContainer;
 class AliTRDonlineTrackMatching;
 
@@ -45,6 +46,14 @@ public:
 
   virtual void              Init();
   virtual void              ProcessEvent();
+
+  virtual Bool_t            SupportsTrackLoop() const {return kTRUE;}
+  virtual Bool_t            BeginEvent();
+  virtual void              ProcessTrack(AliESDtrack *track);
+  virtual UInt_t            GetEventStepReads() const {return kTRDdata|kTrackParams;}
+  virtual UInt_t            GetEventStepWrites() const {return kTRDdata;}
+  virtual UInt_t            GetTrackStepReads() const {return kTRDdata|kTrackParams;}
+  virtual UInt_t            GetTrackStepWrites() const {return kTRDdata;}
   
   void SwitchOnGainCorrection() { fGainCorrection = kTRUE; }
   void SwitchOffGainCorrection() { fGainCorrection = kFALSE; }
@@ -33,6 +33,14 @@ public:
   virtual  void ProcessEvent();
   virtual  void Init() {}
   //
+  virtual  Bool_t SupportsTrackLoop()   const  { return kTRUE; }
+  virtual  Bool_t BeginEvent();
+  virtual  void   ProcessTrack(AliESDtrack* trc);
+  virtual  UInt_t GetEventStepReads()   const  { return kVertexData; }
+  virtual  UInt_t GetEventStepWrites()  const  { return 0; }
+  virtual  UInt_t GetTrackStepReads()   const  { return kTrackParams|kVertexData; }
+  virtual  UInt_t GetTrackStepWrites()  const  { return kTrackParams; }
+  //
   Double_t GetSideAFraction(const AliESDtrack* track) const;
   void     CorrectTrackPtInv(AliExternalTrackParam* trc, int mode, double sideAfraction, double phi) const;
   Bool_t   GetRunCorrections(int run);
@@ -57,6 +65,8 @@ private:
   TString           fOADBObjPath;            // path of file with parameters to use, starting from OADB dir
   TString           fOADBObjName;            // name of the corrections object in the OADB container
   AliOADBContainer* fOADBCont;               // OADB container with parameters collection
+  const AliESDVertex* fVtx;                  //! vertex for the update of the main parameterization
+  const AliESDVertex* fVtxTPC;               //! vertex for the update of the TPCinner parameterization
   //
   ClassDef(AliTrackFixTenderSupply, 1);  // track fixing tender task 
 };
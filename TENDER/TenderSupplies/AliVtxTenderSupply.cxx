@@ -56,19 +56,19 @@ AliVtxTenderSupply::AliVtxTenderSupply(const char *name, const AliTender *tender
 }
 
 //_____________________________________________________
-void AliVtxTenderSupply::ProcessEvent()
+Bool_t AliVtxTenderSupply::BeginEvent()
 {
   //
-  // Recalculate the Vertex with constraint
+  // Recalculate the Vertex with constraint, nothing is left for the track loop
   //
 
   AliESDEvent *event=fTender->GetEvent();
-  if (!event) return;
+  if (!event) return kFALSE;
 
   //
   if (fRefitAlgo >=0 ) { // refit with user supplied algo and using the diamond stored in ESD
     AliESDUtils::RefitESDVertexTracks(event, fRefitAlgo);
-    return;
+    return kFALSE;
   }
   //
 
@@ -77,14 +77,14 @@ void AliVtxTenderSupply::ProcessEvent()
     AliCDBEntry *meanVertex=fTender->GetCDBManager()->Get("GRP/Calib/MeanVertex",fTender->GetRun());
     if (!meanVertex) {
       AliError("No new MeanVertex entry found");
-      return;
+      return kFALSE;
     } else {
       fDiamond=(AliESDVertex*)meanVertex->GetObject();
     }
     //printf("\nRun %d, sigmaX %f, sigmaY %f\n",fTender->GetRun(),fDiamond->GetXRes(),fDiamond->GetYRes());
   }
 
-  if (!fDiamond) return;
+  if (!fDiamond) return kFALSE;
 
   // Redo the primary with the constraint ONLY if the updated mean vertex was found in the OCDB
   if ( (fDiamond->GetXRes())<2){ 
@@ -98,4 +98,5 @@ void AliVtxTenderSupply::ProcessEvent()
     event->SetDiamond(fDiamond);
     delete pvertex;
   }  
+  return kFALSE;
 }
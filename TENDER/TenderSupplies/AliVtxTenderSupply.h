@@ -23,7 +23,15 @@ public:
   virtual ~AliVtxTenderSupply(){;}
   
   virtual void              Init(){;}
-  virtual void              ProcessEvent();
+  virtual void              ProcessEvent() {BeginEvent();}
+  // the vertex refit has no per-track step
+  virtual Bool_t            SupportsTrackLoop() const {return kTRUE;}
+  virtual Bool_t            BeginEvent();
+  virtual UInt_t            GetEventStepReads() const {return kTrackParams|kVertexData;}
+  // the refit with a user algorithm (AliESDUtils::RefitESDVertexTracks) also relates the tracks to the new vertex
+  virtual UInt_t            GetEventStepWrites() const {return fRefitAlgo>=0 ? kVertexData|kTrackParams : kVertexData;}
+  virtual UInt_t            GetTrackStepReads() const {return 0;}
+  virtual UInt_t            GetTrackStepWrites() const {return 0;}
   //
   Int_t   GetRefitAlgo()              const {return fRefitAlgo;}
   void    SetRefitAlgo(Int_t alg=-1)        {fRefitAlgo = alg;}